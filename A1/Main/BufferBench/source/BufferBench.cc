@@ -0,0 +1,115 @@
+
+#ifndef BUFFER_BENCH_H
+#define BUFFER_BENCH_H
+
+#include "MyDB_BufferManager.h"
+#include "MyDB_PageHandle.h"
+#include "MyDB_Table.h"
+#include <chrono>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <mutex>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+
+// the number of frames in the buffer
+#define NUM_FRAMES 1024
+
+// the table is this many times bigger than the buffer, so most requests are misses
+#define TABLE_FACTOR 4
+
+#define PAGE_SIZE 4096
+
+// the total number of page requests in each run, split evenly between the threads
+#define NUM_OPS 400000
+
+// the manager used to do all of its work in one thread; the only way to share it was to put
+// one big latch around every call, which is what this is for
+mutex bigLatch;
+
+// the work done by each thread: random page requests, writing one in every eight
+void worker(MyDB_BufferManager *myMgr, MyDB_TablePtr table, int seed, long numOps, bool serialized)
+{
+	unsigned int state = seed;
+	volatile void *bytes;
+	for (long i = 0; i < numOps; i++)
+	{
+		state = state * 1103515245 + 12345;
+		long which = (state >> 8) % (NUM_FRAMES * TABLE_FACTOR);
+		if (serialized)
+		{
+			lock_guard<mutex> guard(bigLatch);
+			MyDB_PageHandle temp = myMgr->getPage(table, which);
+			bytes = temp->getBytes();
+			if (i % 8 == 0)
+				temp->wroteBytes();
+		}
+		else
+		{
+			MyDB_PageHandle temp = myMgr->getPage(table, which);
+			bytes = temp->getBytes();
+			if (i % 8 == 0)
+				temp->wroteBytes();
+		}
+	}
+	(void)bytes;
+}
+
+// runs the workload with the given number of threads, and returns millions of requests per second
+double run(MyDB_TablePtr table, int numThreads, bool serialized)
+{
+	MyDB_BufferManager myMgr(PAGE_SIZE, NUM_FRAMES, "benchTemp");
+
+	auto start = chrono::steady_clock::now();
+	vector<thread> threads;
+	for (int t = 0; t < numThreads; t++)
+	{
+		threads.push_back(thread(worker, &myMgr, table, 530 + t, NUM_OPS / numThreads, serialized));
+	}
+	for (auto &t : threads)
+	{
+		t.join();
+	}
+	auto end = chrono::steady_clock::now();
+
+	return NUM_OPS / chrono::duration<double>(end - start).count() / 1e6;
+}
+
+int main()
+{
+	MyDB_TablePtr table1 = make_shared<MyDB_Table>("benchTable", "benchFile");
+
+	// write the table out first, so that the misses actually read something
+	{
+		char page[PAGE_SIZE];
+		memset(page, 'x', PAGE_SIZE);
+		int fd = open("benchFile", O_CREAT | O_RDWR | O_TRUNC, 0666);
+		for (int i = 0; i < NUM_FRAMES * TABLE_FACTOR; i++)
+		{
+			if (write(fd, page, PAGE_SIZE) != PAGE_SIZE)
+			{
+				cout << "could not write the table\n";
+				return 1;
+			}
+		}
+		close(fd);
+	}
+
+	int numThreads[] = {1, 4, 16};
+	for (int n : numThreads)
+	{
+		double serialized = run(table1, n, true);
+		double concurrent = run(table1, n, false);
+		cout << n << " thread(s): single latch " << serialized << " million ops/sec, concurrent clock "
+			 << concurrent << " million ops/sec (" << concurrent / serialized << "x)\n"
+			 << flush;
+	}
+
+	remove("benchFile");
+}
+
+#endif
@@ -6,6 +6,8 @@
 #include <unordered_map>
 #include <utility>
 #include <memory>
+#include <atomic>
+#include <mutex>
 #include <cstdio>
 #include <fcntl.h>
 #include <unistd.h>
@@ -19,6 +21,10 @@ class MyDB_BufferManager;
 class MyDB_PageHandleBase;
 
 typedef shared_ptr<MyDB_BufferManager> MyDB_BufferManagerPtr;
+
+// the number of pieces the page table is cut into, each with its own latch
+#define NUM_SHARDS 16
+
 // A hash function used to hash the pair
 struct hashPair
 {
@@ -79,18 +85,44 @@ private:
 	friend class MyDB_Page;
 	// YOUR STUFF HERE
 
+	// one unit on the clock face; the sweep reads the atomics without any latch, so that
+	// threads can skip pinned and recently used frames without looking at the pages
+	struct Frame
+	{
+		Frame() : referenced(false), pinCount(0), claimed(false) {}
+
+		// the page whose bytes live here, only touched by the thread that has claimed the frame
+		MyDB_PagePtr page;
+
+		// second chance
+		atomic<bool> referenced;
+
+		// non-zero while the page here is pinned
+		atomic<int> pinCount;
+
+		// set while a thread is evicting from this frame and putting its own page in
+		atomic<bool> claimed;
+	};
+
+	// a piece of the page table, and the latch protecting it
+	struct Shard
+	{
+		mutex latch;
+		std::unordered_map<pair<MyDB_TablePtr, size_t>, MyDB_PagePtr, hashPair> pages;
+	};
+
 	// use a whole chunck of space is cooler
 	// the idea is to map all the pages on the clock directly to the pointers by calculation
 	void *memory;
 
 	// wheather the clock is fiiled up (to determine the init reference value)
-	bool initialized;
+	atomic<bool> initialized;
 
 	// clock "face"
-	vector<MyDB_PagePtr> clock;
+	vector<Frame> frames;
 
-	// current position of the clock hand
-	size_t clockHand;
+	// current position of the clock hand, every thread that sweeps just bumps it
+	atomic<size_t> clockHand;
 
 	// size of page
 	size_t pageSize;
@@ -99,25 +131,28 @@ private:
 	size_t numPages;
 
 	// the page table, from table and index to the page
-	std::unordered_map<pair<MyDB_TablePtr, size_t>, MyDB_PagePtr, hashPair> pageTable;
+	vector<Shard> pageTable;
 
 	// keep the file for anonymous pages
 	string tempFile;
 
 	// keep track of the anonymous page index
-	size_t tempIndex;
+	atomic<size_t> tempIndex;
 
 	// maintain a file table for faster performance
 	std::unordered_map<MyDB_TablePtr, int> fileTable;
 
+	// protects the file table
+	mutex fileLatch;
+
 	// say goodbye to somebody on clock
-	// free the memory and return points clock hand to this unit
+	// returns a frame that the caller now owns, with its old page written back
 	size_t evict();
 
-	// get the page read on ram
-	void retrivePage(MyDB_PagePtr page);
+	// get the page read on ram, the caller holds no latches; returns the bytes
+	void *retrivePage(MyDB_PagePtr page);
 
-	// wrtie back page
+	// wrtie back page, the caller holds the page latch
 	void writeBackPage(MyDB_PagePtr page);
 
 	// open the file if it is not yet opened, return the fd
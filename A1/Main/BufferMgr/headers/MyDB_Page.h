@@ -2,7 +2,9 @@
 #ifndef PAGE_H
 #define PAGE_H
 
+#include <atomic>
 #include <memory>
+#include <mutex>
 // #include "MyDB_BufferManager.h"
 // #include "MyDB_Page.h"
 #include "MyDB_Table.h"
@@ -28,17 +30,28 @@ public:
   // increments the ref count
   void addRef();
 
+  // pins and unpins the page, also updating the frame that it sits in
+  void pin();
+  void unPin();
+
 private:
   friend class MyDB_BufferManager;
   friend class MyDB_PageHandleBase;
+
+  // unPin, for a caller already holding the latch
+  void unPinLocked();
+
+  // protects bytes, frame and pinned; it is held while the page is read in or written back
+  mutex latch;
+
   // the meat
   void *bytes;
 
-  // second chance
-  bool doNotKill;
+  // the frame on the clock holding the bytes, if there are any
+  size_t frame;
 
   // dirty or not
-  bool dirty;
+  atomic<bool> dirty;
 
   // pinned?
   bool pinned;
@@ -53,7 +66,7 @@ private:
   size_t pageIndex;
 
   // the number of references
-  int ref;
+  atomic<int> ref;
 };
 
 #endif
\ No newline at end of file
@@ -11,6 +11,8 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <iostream>
+#include <mutex>
+#include <thread>
 #include "MyDB_Page.h"
 #include "MyDB_PageHandle.h"
 #include "MyDB_Table.h"
@@ -43,10 +45,8 @@ void MyDB_BufferManager ::unpin(MyDB_PageHandle unpinMe)
   unpinMe->unPin();
 }
 
-MyDB_BufferManager ::MyDB_BufferManager(size_t pageSize, size_t numPages, string tempFile) : clockHand(0), pageSize(pageSize), numPages(numPages), tempFile(tempFile), tempIndex(0)
+MyDB_BufferManager ::MyDB_BufferManager(size_t pageSize, size_t numPages, string tempFile) : initialized(false), frames(numPages), clockHand(0), pageSize(pageSize), numPages(numPages), pageTable(NUM_SHARDS), tempFile(tempFile), tempIndex(0)
 {
-  // init the clock
-  clock.resize(numPages, nullptr);
   // create the memory
   this->memory = malloc(pageSize * numPages);
   // open the temp file
@@ -62,11 +62,15 @@ MyDB_BufferManager ::MyDB_BufferManager(size_t pageSize, size_t numPages, string
 MyDB_BufferManager ::~MyDB_BufferManager()
 {
   // write back all pages
-  for (auto pair : this->pageTable)
+  for (auto &shard : this->pageTable)
   {
-    auto currentPage = pair.second;
+    for (auto pair : shard.pages)
+    {
+      auto currentPage = pair.second;
 
-    this->writeBackPage(currentPage);
+      lock_guard<mutex> guard(currentPage->latch);
+      this->writeBackPage(currentPage);
+    }
   }
 
   // free all memory
@@ -83,30 +87,40 @@ MyDB_BufferManager ::~MyDB_BufferManager()
   remove(tempFile.c_str());
 }
 
-void MyDB_BufferManager::retrivePage(MyDB_PagePtr page)
+void *MyDB_BufferManager::retrivePage(MyDB_PagePtr page)
 {
+  // only one thread reads a given page in, the others wait here for it
+  lock_guard<mutex> guard(page->latch);
+
   if (page->bytes == nullptr)
   // check the pointer to see if it is buffered
   {
     size_t evictIndex = evict();
+    Frame &frame = this->frames[evictIndex];
 
     // calculate the byte position by offset
     page->bytes = (void *)((char *)this->memory + evictIndex * this->pageSize);
+    page->frame = evictIndex;
 
-    // read from file
+    // read from file, pread does not move the shared file offset, so other threads can
+    // read the same file at the same time
     int fd = this->openFile(page->table);
-    lseek(fd, page->pageIndex * this->pageSize, SEEK_SET);
-    read(fd, page->bytes, this->pageSize);
+    pread(fd, page->bytes, this->pageSize, page->pageIndex * this->pageSize);
 
-    // update
-    this->clock.at(evictIndex) = page;
+    // update, the old page (if nobody else wants it) goes away here
+    frame.pinCount = page->pinned ? 1 : 0;
+    frame.referenced = false;
+    frame.page = page;
+    frame.claimed = false;
   }
 
   // update the "do not kill bit" according to stage
   if (this->initialized)
   {
-    page->doNotKill = true;
+    this->frames[page->frame].referenced = true;
   }
+
+  return page->bytes;
 }
 
 void MyDB_BufferManager::writeBackPage(MyDB_PagePtr page)
@@ -116,13 +130,11 @@ void MyDB_BufferManager::writeBackPage(MyDB_PagePtr page)
   if (page->bytes != nullptr)
   // nothing todo if the page has no bytes at all
   {
-    if (page->dirty)
+    if (page->dirty.exchange(false))
     // dirty page write back
     {
       int fd = this->openFile(page->table);
-      lseek(fd, page->pageIndex * pageSize, SEEK_SET);
-      write(fd, page->bytes, pageSize);
-      page->dirty = false;
+      pwrite(fd, page->bytes, pageSize, page->pageIndex * pageSize);
     }
     page->bytes = nullptr;
   }
@@ -131,6 +143,8 @@ void MyDB_BufferManager::writeBackPage(MyDB_PagePtr page)
 // encapsulats the file table away from the outside, proxy pattern
 int MyDB_BufferManager::openFile(MyDB_TablePtr whichTable)
 {
+  lock_guard<mutex> guard(this->fileLatch);
+
   if (this->fileTable.count(whichTable) == 0)
   // open the file and store it onto the table if it's not
   {
@@ -147,90 +161,129 @@ int MyDB_BufferManager::openFile(MyDB_TablePtr whichTable)
 }
 
 // say goodbye to somebody on clock
-// free the meory and points clock hand to this unit
 // the idea of clock hand is not visible to the out side, a layer of encapsulation
 // no matter whether there's a "hole" in the clock ,the clock only turns to the next position
+// every sweeping thread takes the next tick of the hand for itself, so many threads can
+// sweep (and evict) at once; a frame is only taken once its claimed flag is won, and the
+// victim's latch is only tried, never waited for, since the caller holds a page latch too
 size_t MyDB_BufferManager::evict()
 {
 
-  // track the total rounds, prevent infinite loop
+  // track the pinned frames seen in a row, prevent infinite loop
+  size_t pinnedInARow = 0;
+
+  // track the total ticks, to give the other threads a chance now and then
   size_t count = 0;
 
   while (true)
   {
-    if (count++ > this->numPages * 2)
-    // even in the worst case, this will mean a infinite loop
+    if (++count % this->numPages == 0)
+    // a whole round without luck, the frames are probably busy in other threads
     {
-      throw std::runtime_error("Dude, you got a infinite loop, are all the pages pinned?");
+      this_thread::yield();
     }
-    auto currentPage = this->clock.at(this->clockHand);
 
-    if (currentPage == nullptr)
-    // this unit on clock is empty
-    // use it directly
+    size_t evictIndex = this->clockHand.fetch_add(1) % this->numPages;
+    if (evictIndex == this->numPages - 1)
+    // if the clock reaches the end, then the clock is full
     {
-      break;
+      this->initialized = true;
     }
-    if (!currentPage->pinned)
+    Frame &frame = this->frames[evictIndex];
+
+    if (frame.pinCount > 0)
     // pinned pages are ignored
     {
-      if (currentPage->doNotKill)
-      // second chance given
+      if (++pinnedInARow > this->numPages * 2)
+      // even in the worst case, this will mean a infinite loop
       {
-        currentPage->doNotKill = false;
-      }
-      else
-      // no chance, say goodbye
-      {
-        this->writeBackPage(currentPage);
-        break;
+        throw std::runtime_error("Dude, you got a infinite loop, are all the pages pinned?");
       }
+      continue;
     }
+    pinnedInARow = 0;
 
-    this->clockHand++;
-    this->clockHand %= this->numPages;
+    if (frame.referenced.exchange(false))
+    // second chance given
+    {
+      continue;
+    }
 
-    if (this->clockHand == 0)
-    // if the clock reaches 0 again, then the clock is full
+    if (frame.claimed.exchange(true))
+    // somebody else is already taking this one
     {
-      this->initialized = true;
+      continue;
+    }
+
+    MyDB_PagePtr victim = frame.page;
+    if (victim == nullptr)
+    // this unit on clock is empty
+    // use it directly
+    {
+      return evictIndex;
     }
+
+    if (!victim->latch.try_lock())
+    // the victim is being used, move on
+    {
+      frame.claimed = false;
+      continue;
+    }
+
+    // look again, now that the page cannot change
+    if (victim->bytes != nullptr && victim->frame == evictIndex)
+    {
+      if (victim->pinned)
+      // got pinned in the meantime
+      {
+        victim->latch.unlock();
+        frame.claimed = false;
+        continue;
+      }
+
+      // no chance, say goodbye
+      this->writeBackPage(victim);
+    }
+    victim->latch.unlock();
+
+    // at this stage, the target is figured out and dealt with
+    return evictIndex;
   }
-  // at this stage, the target is figured out and dealt with
-
-  // return the current clock position
-  size_t evictIndex = this->clockHand;
-  // next time, start from the next index
-  this->clockHand++;
-  this->clockHand %= this->numPages;
-  return evictIndex;
 }
 
 MyDB_PageHandle MyDB_BufferManager::getNormalPage(MyDB_TablePtr whichTable, long i, bool pinned)
 {
   this->openFile(whichTable);
 
-  // get the key
-  pair<MyDB_TablePtr, long> key = make_pair(whichTable, i);
-  if (this->pageTable.count(key) == 0)
-  // create one from scratch, insert to table
-  {
-    // it is not there, so create a page
-    auto newPage = make_shared<MyDB_Page>(whichTable, i, this, pinned);
-    this->pageTable[key] = newPage;
-    return make_shared<MyDB_PageHandleBase>(newPage);
-  }
-  else
-  // get from table
+  // get the key, and the piece of the table it lives in
+  pair<MyDB_TablePtr, size_t> key = make_pair(whichTable, i);
+  Shard &shard = this->pageTable[hashPair()(key) % NUM_SHARDS];
+
+  MyDB_PagePtr page;
   {
-    MyDB_PagePtr page = this->pageTable[key];
-    if (pinned)
-    // update pinned if needed
+    lock_guard<mutex> guard(shard.latch);
+    auto found = shard.pages.find(key);
+    if (found == shard.pages.end())
+    // create one from scratch, insert to table
     {
-      page->pinned = true;
+      page = make_shared<MyDB_Page>(whichTable, i, this, false);
+      shard.pages[key] = page;
     }
-    return make_shared<MyDB_PageHandleBase>(page);
+    else
+    // get from table
+    {
+      page = found->second;
+    }
+  }
+
+  // the handle goes first, so that a handle going away at the same time cannot undo the pin
+  MyDB_PageHandle handle = make_shared<MyDB_PageHandleBase>(page);
+  if (pinned)
+  // update pinned if needed
+  {
+    page->pin();
   }
+  return handle;
 }
 
 MyDB_PageHandle MyDB_BufferManager::getAnonPage(bool pinned)
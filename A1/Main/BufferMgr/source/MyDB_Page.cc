@@ -10,7 +10,7 @@
 using namespace std;
 
 MyDB_Page::MyDB_Page(MyDB_TablePtr table, size_t pageIndex, MyDB_BufferManager *manager, bool pinned)
-    : bytes(nullptr), doNotKill(false), dirty(false), pinned(pinned), manager(manager), table(table), pageIndex(pageIndex), ref(0) {}
+    : bytes(nullptr), frame(0), dirty(false), pinned(pinned), manager(manager), table(table), pageIndex(pageIndex), ref(0) {}
 
 MyDB_Page::~MyDB_Page()
 {
@@ -22,19 +22,26 @@ MyDB_Page::~MyDB_Page()
 
 void MyDB_Page::removeRef()
 {
-  this->ref--;
-  if (ref == 0)
+  if (--this->ref == 0)
   {
+    lock_guard<mutex> guard(this->latch);
+
+    if (this->ref != 0)
+    // somebody got a new handle in the meantime
+    {
+      return;
+    }
+
     // no longer pinned
-    this->pinned = false;
+    this->unPinLocked();
 
-    if (this->table == nullptr)
+    if (this->table == nullptr && this->bytes != nullptr)
     // anonymous page, leave them dying on the clock is enough
     // they will be evicted eventually
     // and because no one should access the anon page again
     // there's no need to wrtie back in this situation
     {
-      this->doNotKill = false;
+      this->manager->frames[this->frame].referenced = false;
       this->bytes = nullptr;
     }
   }
@@ -45,4 +52,30 @@ void MyDB_Page::addRef()
   this->ref++;
 }
 
+void MyDB_Page::pin()
+{
+  lock_guard<mutex> guard(this->latch);
+  this->pinned = true;
+  if (this->bytes != nullptr)
+  // the sweep looks at the frame, not at the page
+  {
+    this->manager->frames[this->frame].pinCount = 1;
+  }
+}
+
+void MyDB_Page::unPin()
+{
+  lock_guard<mutex> guard(this->latch);
+  this->unPinLocked();
+}
+
+void MyDB_Page::unPinLocked()
+{
+  this->pinned = false;
+  if (this->bytes != nullptr)
+  {
+    this->manager->frames[this->frame].pinCount = 0;
+  }
+}
+
 #endif
@@ -8,8 +8,7 @@
 
 void *MyDB_PageHandleBase ::getBytes()
 {
-  this->page->manager->retrivePage(this->page);
-  return this->page->bytes;
+  return this->page->manager->retrivePage(this->page);
 }
 
 void MyDB_PageHandleBase ::wroteBytes()
@@ -29,7 +28,7 @@ MyDB_PageHandleBase ::MyDB_PageHandleBase(MyDB_PagePtr page) : page(page)
 
 void MyDB_PageHandleBase::unPin()
 {
-  this->page->pinned = false;
+  this->page->unPin();
 }
 
 #endif
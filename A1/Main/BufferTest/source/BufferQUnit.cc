@@ -6,6 +6,7 @@
 #include "MyDB_Table.h"
 #include "QUnit.h"
 #include <iostream>
+#include <thread>
 #include <unistd.h>
 #include <vector>
 
@@ -39,6 +40,24 @@ void writeSymbols(char *bytes, size_t len, int i)
 	bytes[len - 1] = 0;
 }
 
+// each thread in the concurrent test writes its own range of pages, through pinned handles
+// so that nobody else can take the frame while the bytes are being written
+void writeRange(MyDB_BufferManager *myMgr, MyDB_TablePtr table, int first, int num)
+{
+	for (int i = first; i < first + num; i++)
+	{
+		MyDB_PageHandle temp = myMgr->getPinnedPage(table, i);
+		char *bytes = (char *)temp->getBytes();
+		writeNums(bytes, 64, i);
+		temp->wroteBytes();
+
+		// and some anonymous pages, to keep the clock busy
+		MyDB_PageHandle anon = myMgr->getPinnedPage();
+		writeLetters((char *)anon->getBytes(), 64, i);
+		anon->wroteBytes();
+	}
+}
+
 int main()
 {
 
@@ -155,6 +174,37 @@ int main()
 			QUNIT_IS_EQUAL(string(answer), string(bytes));
 		}
 	}
+
+	// UNIT TEST 3: MANY THREADS MISSING AND EVICTING AT ONCE
+	{
+		{
+			MyDB_BufferManager myMgr(64, 16, "tempDSFSD");
+			MyDB_TablePtr table3 = make_shared<MyDB_Table>("tempTable3", "foobaz");
+
+			vector<thread> threads;
+			for (int t = 0; t < 8; t++)
+			{
+				threads.push_back(thread(writeRange, &myMgr, table3, t * 50, 50));
+			}
+			for (auto &t : threads)
+			{
+				t.join();
+			}
+		}
+
+		// and then make sure that every page made it to disk
+		MyDB_BufferManager myMgr(64, 16, "tempDSFSD");
+		MyDB_TablePtr table3 = make_shared<MyDB_Table>("tempTable3", "foobaz");
+		bool allOK = true;
+		for (int i = 0; i < 400; i++)
+		{
+			MyDB_PageHandle temp = myMgr.getPage(table3, i);
+			char answer[64];
+			writeNums(answer, 64, i);
+			allOK = allOK && string(answer) == string((char *)temp->getBytes());
+		}
+		QUNIT_IS_TRUE(allOK);
+	}
 }
 
 #endif
\ No newline at end of file
@@ -0,0 +1,325 @@
+
+#ifndef BUFFER_BENCH_H
+#define BUFFER_BENCH_H
+
+#include "MyDB_BufferManager.h"
+#include "MyDB_PageHandle.h"
+#include "MyDB_Table.h"
+#include <chrono>
+#include <cstdlib>
+#include <cstring>
+#include <fcntl.h>
+#include <iostream>
+#include <thread>
+#include <time.h>
+#include <unistd.h>
+#include <vector>
+
+using namespace std;
+
+// this is the number of frames that the SQL shell runs with
+#define NUM_FRAMES 4028
+
+// small pages, so that the time is dominated by the bookkeeping and not by copying bytes
+#define PAGE_SIZE 64
+
+// reports the average cost of one operation
+void report (const char *what, clock_t start, clock_t end, long numOps) {
+	double nanos = ((double) (end - start)) / CLOCKS_PER_SEC * 1e9 / numOps;
+	cout << what << ": " << nanos << " ns/op (" << numOps << " ops)\n" << flush;
+}
+
+// reports the number of operations per second done by a group of threads, which is
+// measured using the wall clock (clock () would add up the time used by all of the threads)
+void reportThroughput (string what, chrono :: steady_clock :: time_point start, 
+	chrono :: steady_clock :: time_point end, long numOps) {
+	double secs = chrono :: duration <double> (end - start).count ();
+	cout << what << ": " << numOps / secs / 1e6 << " million ops/sec (" << numOps << " ops)\n" << flush;
+}
+
+// the work done by each thread in the multi-threaded benchmark: random page requests over
+// twice as many pages as there are frames, so about half of them are misses
+void worker (MyDB_BufferManager *myMgr, MyDB_TablePtr table, int seed, long numOps) {
+	unsigned int state = seed;
+	for (long i = 0; i < numOps; i++) {
+		state = state * 1103515245 + 12345;
+		MyDB_PageHandle temp = myMgr->getPage (table, (state >> 8) % (NUM_FRAMES * 2));
+		temp->getBytes ();
+	}
+}
+
+int main () {
+
+	MyDB_TablePtr table1 = make_shared <MyDB_Table> ("benchTable", "benchFile");
+	srand (530);
+
+	// hits: every page is buffered, and we touch them in a random order
+	{
+		MyDB_BufferManager myMgr (PAGE_SIZE, NUM_FRAMES, "benchTemp");
+		vector <MyDB_PageHandle> pages (NUM_FRAMES);
+		for (int i = 0; i < NUM_FRAMES; i++) {
+			pages[i] = myMgr.getPage (table1, i);
+			pages[i]->getBytes ();
+		}
+
+		vector <int> order (NUM_FRAMES * 256);
+		for (auto &o : order)
+			o = rand () % NUM_FRAMES;
+
+		clock_t t1 = clock ();
+		for (int o : order)
+			pages[o]->getBytes ();
+		clock_t t2 = clock ();
+		report ("random hits", t1, t2, order.size ());
+	}
+
+	// lookups: ask the buffer manager for handles to pages that are already buffered
+	{
+		MyDB_BufferManager myMgr (PAGE_SIZE, NUM_FRAMES, "benchTemp");
+		vector <MyDB_PageHandle> pages (NUM_FRAMES);
+		for (int i = 0; i < NUM_FRAMES; i++) {
+			pages[i] = myMgr.getPage (table1, i);
+			pages[i]->getBytes ();
+		}
+
+		long numOps = 0;
+		clock_t t1 = clock ();
+		for (int j = 0; j < 64; j++) {
+			for (int i = 0; i < NUM_FRAMES; i++) {
+				MyDB_PageHandle temp = myMgr.getPage (table1, (i * 7919) % NUM_FRAMES);
+				numOps++;
+			}
+		}
+		clock_t t2 = clock ();
+		report ("getPage on buffered pages", t1, t2, numOps);
+	}
+
+	// pin/unpin: pin a page that is already buffered, then let go of it
+	{
+		MyDB_BufferManager myMgr (PAGE_SIZE, NUM_FRAMES, "benchTemp");
+		for (int i = 0; i < NUM_FRAMES; i++) {
+			myMgr.getPage (table1, i)->getBytes ();
+		}
+
+		long numOps = 0;
+		clock_t t1 = clock ();
+		for (int j = 0; j < 64; j++) {
+			for (int i = 0; i < NUM_FRAMES; i++) {
+				MyDB_PageHandle temp = myMgr.getPinnedPage (table1, (i * 7919) % NUM_FRAMES);
+				numOps++;
+			}
+		}
+		clock_t t2 = clock ();
+		report ("pin + unpin", t1, t2, numOps);
+	}
+
+	// evictions: a scan over four times as many pages as there are frames, so that every
+	// access is a miss that kicks out the LRU page
+	{
+		MyDB_BufferManager myMgr (PAGE_SIZE, NUM_FRAMES, "benchTemp");
+		long numOps = 0;
+		clock_t t1 = clock ();
+		for (int j = 0; j < 8; j++) {
+			for (int i = 0; i < NUM_FRAMES * 4; i++) {
+				MyDB_PageHandle temp = myMgr.getPage (table1, i);
+				temp->getBytes ();
+				numOps++;
+			}
+		}
+		clock_t t2 = clock ();
+		report ("scan with eviction", t1, t2, numOps);
+	}
+
+	// scan resistance, under each of the replacement policies: a hot set of a quarter of the
+	// frames (think dimension tables and B+-tree directory pages) is warmed up by a few small
+	// queries, then one big scan streams through ten times as many pages as there are frames,
+	// and then we time how long it takes to get back to the hot set
+	for (string policy : {"lru", "clock", "lru2", "2q"}) {
+		MyDB_BufferManager myMgr (PAGE_SIZE, NUM_FRAMES, "benchTemp", MyDB_ReplacementPolicy :: makePolicy (policy));
+		int scanPos = NUM_FRAMES;
+		for (int j = 0; j < 8; j++) {
+			for (int i = 0; i < NUM_FRAMES / 4; i++)
+				myMgr.getPage (table1, i)->getBytes ();
+			for (int i = 0; i < NUM_FRAMES / 4; i++)
+				myMgr.getPage (table1, scanPos++)->getBytes ();
+		}
+
+		clock_t t1 = clock ();
+		for (int i = 0; i < NUM_FRAMES * 10; i++)
+			myMgr.getPage (table1, scanPos++)->getBytes ();
+		clock_t t2 = clock ();
+		for (int i = 0; i < NUM_FRAMES / 4; i++)
+			myMgr.getPage (table1, i)->getBytes ();
+		clock_t t3 = clock ();
+		report (("big scan, " + policy).c_str (), t1, t2, NUM_FRAMES * 10);
+		report (("hot set after the scan, " + policy).c_str (), t2, t3, NUM_FRAMES / 4);
+	}
+
+	// read-ahead: reading a file that is not in the OS cache, doing some work on each page...
+	// first reading each page only when we get to it, and then keeping 32 pages in flight.
+	// The pages are the size that the SQL shell uses, and they are read either in order (a
+	// table scan) or in a scattered order (like a list of temp pages from a sort run)
+	for (bool scattered : {false, true}) {
+		for (int readAhead : {0, 32}) {
+			const int bigPageSize = 128 * 1024, numBigPages = 512;
+			vector <char> data (bigPageSize, 'x');
+			int fd = open ("benchBigFile", O_CREAT | O_TRUNC | O_WRONLY, 0666);
+			for (int i = 0; i < numBigPages; i++)
+				write (fd, data.data (), bigPageSize);
+			fsync (fd);
+			posix_fadvise (fd, 0, 0, POSIX_FADV_DONTNEED);
+			close (fd);
+
+			vector <int> order (numBigPages);
+			for (int i = 0; i < numBigPages; i++)
+				order[i] = scattered ? (i * 193) % numBigPages : i;
+
+			MyDB_TablePtr bigTable = make_shared <MyDB_Table> ("benchBigTable", "benchBigFile");
+			MyDB_BufferManager myMgr (bigPageSize, 64, "benchTemp");
+			volatile long sum = 0;
+			auto t1 = chrono :: steady_clock :: now ();
+			for (int i = 0; i < readAhead && i < numBigPages; i++)
+				myMgr.prefetch (bigTable, order[i], 1);
+			for (int i = 0; i < numBigPages; i++) {
+				if (readAhead > 0 && i + readAhead < numBigPages)
+					myMgr.prefetch (bigTable, order[i + readAhead], 1);
+				char *bytes = (char *) myMgr.getPage (bigTable, order[i])->getBytes ();
+				for (int j = 0; j < bigPageSize; j += 8)
+					sum += bytes[j];
+			}
+			auto t2 = chrono :: steady_clock :: now ();
+			double micros = chrono :: duration <double, micro> (t2 - t1).count () / numBigPages;
+			cout << (scattered ? "scattered" : "sequential") << " cold reads, read-ahead " << readAhead 
+				<< ": " << micros << " us/page\n" << flush;
+			unlink ("benchBigFile");
+		}
+	}
+
+	// TLB reach: read bytes at random spots in a pool of 1024 pages of the size used by the SQL
+	// shell (128 MB in all), with the pool backed by regular pages, and then by huge pages
+	for (bool huge : {false, true}) {
+		const int bigPageSize = 128 * 1024, numBigPages = 1024;
+		MyDB_BufferManager myMgr (bigPageSize, numBigPages, "benchTemp");
+		myMgr.setHugePages (huge);
+		vector <MyDB_PageHandle> pages (numBigPages);
+		vector <char *> bytes (numBigPages);
+		for (int i = 0; i < numBigPages; i++) {
+			pages[i] = myMgr.getPinnedPage ();
+			bytes[i] = (char *) pages[i]->getBytes ();
+			memset (bytes[i], i, bigPageSize);
+		}
+
+		unsigned int state = 530;
+		volatile long sum = 0;
+		long numOps = 1 << 23;
+		auto t1 = chrono :: steady_clock :: now ();
+		for (long i = 0; i < numOps; i++) {
+			state = state * 1103515245 + 12345;
+			sum += bytes[(state >> 8) % numBigPages][(state * 2654435761u) % bigPageSize];
+		}
+		auto t2 = chrono :: steady_clock :: now ();
+		cout << "random byte reads, " << (huge ? "huge pages" : "regular pages") << ": " 
+			<< chrono :: duration <double, nano> (t2 - t1).count () / numOps << " ns/op\n" << flush;
+	}
+
+	// shutdown: every frame holds a dirty page, and the pages were written in a random order
+	// (as after a bulk load into a hash-partitioned set of pages); time the buffer manager's
+	// destructor, which has to write them all back
+	{
+		const int bigPageSize = 4096;
+		MyDB_BufferManager *myMgr = new MyDB_BufferManager (bigPageSize, NUM_FRAMES, "benchTemp");
+		vector <int> order (NUM_FRAMES);
+		for (int i = 0; i < NUM_FRAMES; i++)
+			order[i] = (i * 1031) % NUM_FRAMES;
+		for (int i : order) {
+			MyDB_PageHandle temp = myMgr->getPage (table1, i);
+			memset (temp->getBytes (), i, bigPageSize);
+			temp->wroteBytes ();
+		}
+		auto t1 = chrono :: steady_clock :: now ();
+		delete myMgr;
+		auto t2 = chrono :: steady_clock :: now ();
+		cout << "shutdown with " << NUM_FRAMES << " dirty pages: " 
+			<< chrono :: duration <double, milli> (t2 - t1).count () << " ms\n" << flush;
+	}
+
+	// write-back: append-style writes over four times as many pages as there are frames, so that
+	// every miss lands on a dirty victim unless the flusher has already cleaned it... with the
+	// flusher turned off, and then on
+	for (double fraction : {0.0, 0.25}) {
+		MyDB_BufferManager myMgr (PAGE_SIZE, NUM_FRAMES, "benchTemp");
+		myMgr.setFlusher (fraction, 1);
+		long numOps = 0;
+		auto t1 = chrono :: steady_clock :: now ();
+		for (int j = 0; j < 4; j++) {
+			for (int i = 0; i < NUM_FRAMES * 4; i++) {
+				MyDB_PageHandle temp = myMgr.getPage (table1, i);
+				char *bytes = (char *) temp->getBytes ();
+				bytes[0] = (char) j;
+				temp->wroteBytes ();
+				numOps++;
+			}
+		}
+		auto t2 = chrono :: steady_clock :: now ();
+		double nanos = chrono :: duration <double, nano> (t2 - t1).count () / numOps;
+		cout << "dirty scan, flusher " << (fraction > 0 ? "on" : "off") << ": " << nanos << " ns/op (" 
+			<< numOps << " ops, " << myMgr.getNumDirty () << " dirty pages at the end)\n" << flush;
+	}
+
+	// throughput when several threads share the pool, first with a single latch over the whole
+	// pool, and then with the pool split into shards
+	for (size_t numShards : {1, 0}) {
+		for (int numThreads : {1, 2, 4, 8}) {
+			MyDB_BufferManager myMgr (PAGE_SIZE, NUM_FRAMES, "benchTemp", 
+				MyDB_ReplacementPolicy :: makePolicy ("lru"), numShards);
+			long opsPerThread = NUM_FRAMES * 64 / numThreads;
+
+			auto t1 = chrono :: steady_clock :: now ();
+			vector <thread> threads;
+			for (int i = 0; i < numThreads; i++)
+				threads.push_back (thread (worker, &myMgr, table1, i + 1, opsPerThread));
+			for (auto &t : threads)
+				t.join ();
+			auto t2 = chrono :: steady_clock :: now ();
+
+			reportThroughput (string (numShards == 1 ? "one latch" : "sharded") + ", " + 
+				to_string (numThreads) + " threads", t1, t2, opsPerThread * numThreads);
+		}
+	}
+
+	// repeated scans of a table that is twice as big as the pool, but that is in the OS cache,
+	// first through the pool (every page is copied in) and then as a read-only table
+	for (bool readOnly : {false, true}) {
+		const int bigPageSize = 128 * 1024, numBigPages = 256, numScans = 8;
+		vector <char> data (bigPageSize, 'x');
+		int fd = open ("benchBigFile", O_CREAT | O_TRUNC | O_WRONLY, 0666);
+		for (int i = 0; i < numBigPages; i++)
+			write (fd, data.data (), bigPageSize);
+		close (fd);
+
+		MyDB_BufferManager myMgr (bigPageSize, numBigPages / 2, "benchTemp");
+		MyDB_TablePtr bigTable = make_shared <MyDB_Table> ("benchBigTable", "benchBigFile");
+		myMgr.setReadOnly (bigTable, readOnly);
+
+		// look at every cache line, as a scan of the records would
+		long sum = 0;
+		auto t1 = chrono :: steady_clock :: now ();
+		for (int scan = 0; scan < numScans; scan++) {
+			for (int i = 0; i < numBigPages; i++) {
+				char *bytes = (char *) myMgr.getPage (bigTable, i)->getBytes ();
+				for (int k = 0; k < bigPageSize; k += 64)
+					sum += bytes[k];
+			}
+		}
+		auto t2 = chrono :: steady_clock :: now ();
+
+		double micros = chrono :: duration <double, micro> (t2 - t1).count () / (numScans * numBigPages);
+		cout << "warm scan, " << (readOnly ? "read-only (mapped)" : "through the pool") << ": " << micros 
+			<< " us/page (" << numScans << " scans of " << numBigPages << " pages, checksum " << sum << ")\n" << flush;
+		unlink ("benchBigFile");
+	}
+
+	unlink ("benchFile");
+}
+
+#endif
@@ -0,0 +1,36 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef ACCESS_HINT_H
+#define ACCESS_HINT_H
+
+// tells the buffer manager how whoever asked for a page is going to use it, so that the
+// replacement policy does not have to guess... a request only ever raises a page's hint
+// (a scan's page goes first, then ordinary pages, then hot pages), so that a scan never
+// demotes a page that somebody else is using; MyDB_BufferManager :: setHint can lower it
+enum MyDB_AccessHint {
+
+	// nothing special is known; the replacement policy treats the page like any other
+	NormalAccess,
+
+	// the page is read once, as part of a scan... it goes at the eviction end of the pool,
+	// so that a big scan recycles a few frames rather than pushing out everybody else's pages
+	SequentialAccess,
+
+	// the page is one of a few looked up out of many (such as a B+-Tree leaf)... the policy
+	// treats it like any other page
+	RandomAccess,
+
+	// the page is going to be used over and over (such as a B+-Tree's internal pages)... it
+	// is only evicted when every page that can be evicted is hot
+	KeepHotAccess
+};
+
+#endif
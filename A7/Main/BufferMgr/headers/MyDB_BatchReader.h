@@ -0,0 +1,109 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef BATCH_READER_H
+#define BATCH_READER_H
+
+#include <condition_variable>
+#include <memory>
+#include <mutex>
+#include <sys/types.h>
+#include <thread>
+#include <vector>
+
+using namespace std;
+
+class MyDB_BatchReader;
+typedef shared_ptr <MyDB_BatchReader> MyDB_BatchReaderPtr;
+
+// one of the reads in a batch: numBytes bytes at offset in the file fd, into bytes
+struct MyDB_ReadRequest {
+	int fd;
+	void *bytes;
+	size_t numBytes;
+	off_t offset;
+};
+
+struct io_uring_sqe;
+struct io_uring_cqe;
+
+// does a batch of reads all at once, rather than one after another, so that a disk (or an
+// SSD, which can do many reads in parallel) has all of them to work on at the same time...
+// the reads go through an io_uring if the kernel has one, and are spread over a small pool of
+// threads that each do a pread otherwise.  A read that comes up short (say, because it goes
+// past the end of the file) is finished with pread, and stops at the end of the file.  Any
+// number of threads can use the reader, though their batches are done one at a time
+class MyDB_BatchReader {
+
+public:
+
+	// if there is no io_uring, the reads are done by numThreads threads (plus the caller)
+	MyDB_BatchReader (size_t numThreads);
+
+	// waits for the threads, and tears down the ring
+	~MyDB_BatchReader ();
+
+	// does all of the reads, and returns once they are all done
+	void read (vector <MyDB_ReadRequest> &requests);
+
+	// true if the reads go through an io_uring (this sets it up, if that has not been tried)
+	bool usingRing ();
+
+private:
+
+	// tries to set up the ring; called the first time that it is needed
+	void setUp ();
+
+	// does the reads through the ring, or through the threads
+	void readWithRing (vector <MyDB_ReadRequest> &requests);
+	void readWithThreads (vector <MyDB_ReadRequest> &requests);
+
+	// the body of each thread
+	void workerLoop ();
+
+	// takes the next read of the current batch and does it; returns false if there are none left
+	bool doNextRead (unique_lock <mutex> &lock);
+
+	// held while a batch is being read, so that there is one batch at a time
+	mutex latch;
+	bool isSetUp;
+
+	// the ring, if there is one: its FD (-1 if there is none), the two mappings of its queues,
+	// and the parts of the queues that we use
+	int ringFD;
+	void *sqMapping;
+	size_t sqMappingSize;
+	void *cqMapping;
+	size_t cqMappingSize;
+	io_uring_sqe *sqes;
+	size_t sqesSize;
+	unsigned *sqTail;
+	unsigned *sqMask;
+	unsigned *sqArray;
+	unsigned numEntries;
+	unsigned *cqHead;
+	unsigned *cqTail;
+	unsigned *cqMask;
+	io_uring_cqe *cqes;
+
+	// the threads that do the reads if there is no ring, and the batch that they are working
+	// on... these are protected by jobLatch
+	size_t numThreads;
+	vector <thread> workers;
+	mutex jobLatch;
+	condition_variable jobReady;
+	condition_variable jobDone;
+	vector <MyDB_ReadRequest> *jobs;
+	size_t nextJob;
+	size_t numJobsDone;
+	bool stopWorkers;
+};
+
+#endif
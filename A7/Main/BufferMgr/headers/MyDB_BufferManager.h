@@ -13,22 +13,94 @@
 #ifndef BUFFER_MGR_H
 #define BUFFER_MGR_H
 
-#include "CheckLRU.h"
+#include <atomic>
+#include <condition_variable>
 #include <map>
 #include <memory>
+#include <mutex>
+#include "MyDB_AccessHint.h"
+#include "MyDB_BatchReader.h"
+#include "MyDB_BufferStats.h"
+#include "MyDB_CompressedCache.h"
+#include "MyDB_FileCache.h"
+#include "MyDB_FrameList.h"
+#include "MyDB_MemoryGrant.h"
 #include "MyDB_Page.h"
 #include "MyDB_PageHandle.h"
+#include "MyDB_PagePool.h"
+#include "MyDB_ReplacementPolicy.h"
 #include "MyDB_Table.h"
-#include "PageCompare.h"
+#include "MyDB_TempFile.h"
+#include "MyDB_TempSegment.h"
+#include "PageHash.h"
 #include <queue>
+#include <pthread.h>
 #include "TableCompare.h"
-#include <set>
+#include <thread>
+#include <unordered_map>
 
 using namespace std;
 
 class MyDB_BufferManager;
 typedef shared_ptr <MyDB_BufferManager> MyDB_BufferManagerPtr;
 
+// the name of the sub-pool that every table starts out in
+#define DEFAULT_SUB_POOL "default"
+
+// the pool can grow to this many times the number of pages that it was created with
+#define MAX_POOL_GROWTH 8
+
+// the number of table files that are kept open at once, unless someone says otherwise
+#define MAX_OPEN_FILES 256
+
+struct MyDB_SubPool;
+
+// one partition of the buffer pool... a page always lives in the same shard (picked by
+// hashing its table and position), and the shard's latch protects the shard's part of
+// the page table, its replacement policy, and the RAM of the pages in the shard
+struct MyDB_BufferShard {
+
+	mutex latch;
+
+	// all of the non-anonymous page objects in this shard that are currently in existence
+	unordered_map <MyDB_PageKey, MyDB_PagePtr, PageHash, PageEqual> allPages;
+
+	// keeps track of the unpinned pages in this shard that have RAM, and decides which
+	// one to kick out when this shard is asked to give up some RAM
+	MyDB_ReplacementPolicyPtr policy;
+
+	// scratch space for asking the policy about its next victims
+	vector <MyDB_Page *> victims;
+
+	// the sub-pool that the shard belongs to
+	MyDB_SubPool *pool;
+};
+typedef shared_ptr <MyDB_BufferShard> MyDB_BufferShardPtr;
+
+// a named part of the buffer pool, which holds the pages of the tables that have been put
+// into it (or the temp pages)... each sub-pool has its own shards, and so its own replacement
+// policies.  Once the pages in a sub-pool hold as many frames as its quota allows, a page
+// miss in the sub-pool replaces one of the sub-pool's own pages, so that (say) a big sort
+// can't push the pages of the indexes out of RAM
+struct MyDB_SubPool {
+
+	string name;
+
+	// the most frames that the sub-pool's pages can hold; zero if there is no limit
+	atomic <size_t> quota;
+
+	// the number of frames that the sub-pool's pages are holding
+	atomic <long> numFrames;
+
+	// the sub-pool's shards are shards firstShard through firstShard + numShards - 1
+	size_t firstShard;
+	size_t numShards;
+
+	// the shard that will be asked to give up a page the next time that the sub-pool is full
+	atomic <size_t> nextVictimShard;
+};
+typedef shared_ptr <MyDB_SubPool> MyDB_SubPoolPtr;
+
 class MyDB_BufferManager {
 
 public:
@@ -38,6 +110,10 @@ public:
 	// to that already-buffered page should be returned
 	MyDB_PageHandle getPage (MyDB_TablePtr whichTable, long i);
 
+	// like the above, but also says how the page is going to be used, so that the replacement
+	// policy can keep it longer (KeepHotAccess) or get rid of it first (SequentialAccess)
+	MyDB_PageHandle getPage (MyDB_TablePtr whichTable, long i, MyDB_AccessHint hint);
+
 	// gets a temporary page that will no longer exist (1) after the buffer manager
 	// has been destroyed, or (2) there are no more references to it anywhere in the
 	// program.  Typically such a temporary page will be used as buffer memory.
@@ -49,20 +125,112 @@ public:
 	// between this method and getPage (whicTable, i) is that the page will be 
 	// pinned in RAM; it cannot be written out to the file... note that in Chris'
 	// implementation, a request for a pinned page that is made when the buffer
-	// is ENTIRELY full of pinned pages will return a nullptr
+	// is ENTIRELY full of pinned pages will return a nullptr.  So will a request
+	// when every frame that is not pinned has been set aside for a grant (see
+	// reserveFrames), since those frames can only be pinned through the grant
 	MyDB_PageHandle getPinnedPage (MyDB_TablePtr whichTable, long i);
 
+	// like the above, with a hint for how the page will be used once it is unpinned
+	MyDB_PageHandle getPinnedPage (MyDB_TablePtr whichTable, long i, MyDB_AccessHint hint);
+
+	// like the above, except that the page is pinned through the grant: if the grant has a
+	// frame that is not being used, the page uses it until it is unpinned, so the request
+	// can only fail if more pages are pinned through the grant than it has frames
+	MyDB_PageHandle getPinnedPage (MyDB_TablePtr whichTable, long i, MyDB_AccessHint hint,
+		MyDB_MemoryGrantPtr grant);
+
 	// gets a temporary page, like getPage (), except that this one is pinned
 	MyDB_PageHandle getPinnedPage ();
 
+	// like the above, but the page is pinned through the grant
+	MyDB_PageHandle getPinnedPage (MyDB_MemoryGrantPtr grant);
+
+	// gets handles to the given pages of the table (in the same order), reading all of the ones
+	// that are not buffered at once (see MyDB_BatchReader.h), rather than one at a time as each
+	// is first used... if there are more pages than a quarter of the pool, they are read a
+	// quarter of the pool at a time, so that a batch never has to kick out pages of its own
+	vector <MyDB_PageHandle> getPages (MyDB_TablePtr whichTable, vector <long> &positions);
+
+	// like the above, with a hint for how the pages are going to be used
+	vector <MyDB_PageHandle> getPages (MyDB_TablePtr whichTable, vector <long> &positions, MyDB_AccessHint hint);
+
+	// like the above, except that the pages are pinned... as with getPinnedPage, the handle to a
+	// page is a nullptr if all of the RAM was pinned, so that the page could not be read
+	vector <MyDB_PageHandle> getPinnedPages (MyDB_TablePtr whichTable, vector <long> &positions);
+
+	// like the above, but the pages are pinned through the grant
+	vector <MyDB_PageHandle> getPinnedPages (MyDB_TablePtr whichTable, vector <long> &positions,
+		MyDB_MemoryGrantPtr grant);
+
+	// starts a temp segment for a query: until the segment is ended (or destroyed), every
+	// new temp page goes into a temp file of the segment's own, which is deleted as a whole
+	// once the segment is ended and the last of its pages is gone.  If a segment is started
+	// while another one is active, the new one takes over, and ending either one sends temp
+	// pages back to the shared temp file
+	MyDB_TempSegmentPtr startTempSegment ();
+
+	// from now on, temp files are striped over files in the given directories (so page i of
+	// a temp file goes into directory i % dirs.size ()), rather than being written to the
+	// single temp file that the buffer manager was created with... the pages that are already
+	// around stay where they are.  An empty list goes back to the single file
+	void setSpillDirectories (vector <string> dirs);
+
 	// un-pins the specified page
 	void unpin (MyDB_PagePtr unpinMe);
 
+	// an operator that is going to pin a lot of pages (say, to build a hash table) should
+	// first reserve frames for them, so that it does not run the buffer out of RAM in the
+	// middle of a query... this returns a grant of as many of the numFrames frames as can
+	// be spared, which may be fewer than were asked for (or none at all).  The frames are
+	// set aside until the grant is released or destroyed: they can only be pinned by
+	// pages that are pinned through the grant (see getPinnedPage (grant))
+	MyDB_MemoryGrantPtr reserveFrames (size_t numFrames);
+
+	// the number of frames that would be granted right now... this is the smaller of the
+	// number of frames that have not been reserved, and the number that are either free or
+	// hold unpinned pages, less a few frames that are always kept back for the operators'
+	// scans and output pages (which are pinned without a grant)
+	size_t getNumGrantableFrames ();
+
+	// lets the OS know that pages firstPage through firstPage + count - 1 of the table are
+	// going to be read soon (via posix_fadvise), so that it can read them from disk while
+	// we work on something else... when we later ask for them, the read will just be a copy
+	void prefetch (MyDB_TablePtr whichTable, long firstPage, long count);
+
+	// like the above, but for a single page, which may be a temp page... this does nothing
+	// if the page is already buffered
+	void prefetch (MyDB_PageHandle whichPage);
+
+	// keeps up to numBytes of the table pages that are kicked out of the pool in compressed
+	// form, so that a miss on one of them is a decompression rather than a read from disk
+	// (see MyDB_CompressedCache.h); zero, which is the default, turns this off
+	void setCompressedCache (size_t numBytes);
+
+	// changes the hint for a page that we already have a handle to (for example, once it turns
+	// out to be an internal node of a B+-Tree)... unlike a hint that comes with a request, this
+	// can also lower the hint, such as to let go of pages that were hot until a join was done
+	void setHint (MyDB_PageHandle whichPage, MyDB_AccessHint hint);
+
 	// creates an LRU buffer manager... params are as follows:
 	// 1) the size of each page is pageSize 
 	// 2) the number of pages managed by the buffer manager is numPages;
 	// 3) temporary pages are written to the file tempFile
 	MyDB_BufferManager (size_t pageSize, size_t numPages, string tempFile);
+
+	// like the above, except that pages are replaced using the given policy (see
+	// MyDB_ReplacementPolicy :: makePolicy for the ones that are available)
+	MyDB_BufferManager (size_t pageSize, size_t numPages, string tempFile, MyDB_ReplacementPolicyPtr policy);
+
+	// like the above, except that the pool is split into numShards shards, each with its
+	// own latch and its own copy of the policy, so that threads working on different pages
+	// rarely wait for one another... if numShards is zero, the number of shards is picked
+	// based upon the number of pages (a small pool has just one shard, and so replaces
+	// pages in exactly the same order as one big policy would).  All of the methods of
+	// the buffer manager may be called from several threads at once.  Note that a page's
+	// bytes are only guaranteed to stay in RAM while the page is pinned: if the page is
+	// unpinned, a page miss in another thread can kick it out at any time
+	MyDB_BufferManager (size_t pageSize, size_t numPages, string tempFile, MyDB_ReplacementPolicyPtr policy,
+		size_t numShards);
 	
 	// when the buffer manager is destroyed, all of the dirty pages need to be
 	// written back to disk, and any temporary files need to be deleted
@@ -70,55 +238,377 @@ public:
 
 	// returns the page size
 	size_t getPageSize ();
+
+	// grows or shrinks the pool to numPages pages, returning the number of pages that it ends
+	// up with... the pool can grow to MAX_POOL_GROWTH times the size that it started with.  To
+	// shrink it, free frames are given back to the OS, and then pages are kicked out (and
+	// written back, if they are dirty); since pinned pages can't be kicked out, the pool may
+	// end up bigger than was asked for
+	size_t setNumPages (size_t numPages);
+	size_t getNumPages ();
+
+	// creates the named sub-pool, whose pages can hold at most quota frames (zero means that
+	// there is no limit); if the sub-pool already exists, this just changes its quota, kicking
+	// pages out if it is now over.  There is always a sub-pool named DEFAULT_SUB_POOL, which
+	// every table starts out in
+	void setSubPool (string poolName, size_t quota);
+
+	// from now on, keeps the table's pages in the named sub-pool, moving the ones that are
+	// already buffered over (and kicking out any that don't fit under the sub-pool's quota)...
+	// if whichTable is a nullptr, this is done for the temp pages
+	// (those that are already around stay where they are).  Returns false if there is no
+	// such sub-pool
+	bool useSubPool (MyDB_TablePtr whichTable, string poolName);
+
+	// writes all of the table's dirty pages back to its file... the pages are sorted by their
+	// position in the file, and each run of adjacent pages goes out in a single pwritev
+	void flushTable (MyDB_TablePtr whichTable);
+
+	// like the above, but for every table
+	void flushAll ();
+
+	// sets up the background thread that writes dirty pages back before they get picked for
+	// eviction, so that a page miss rarely has to wait for a write... the thread tries to keep
+	// the fractionClean of each shard's evictable pages that are next in line to be evicted
+	// clean.  It wakes up every intervalMs milliseconds, and also whenever a page miss had to
+	// write back a dirty victim itself.  A fractionClean of zero stops the thread.  There is
+	// no flusher by default: once a process has a second thread, every shared_ptr copy
+	// becomes an atomic operation, which about doubles the cost of a buffer hit, so this
+	// only pays off when there are spare cores and a lot of pages being written
+	void setFlusher (double fractionClean, long intervalMs);
+
+	// writes the list of buffered table pages to the given file, so that a later run can
+	// start out with the same pages in RAM (temp pages and pages of read-only tables, which
+	// are not in the pool, are not listed)
+	void saveResidentPages (string fileName);
+
+	// reads the pages listed in the given file (by saveResidentPages) back into the pool, in
+	// the background... only the pages of the given tables (by name) are read, runs of pages
+	// that are next to each other in a file are read with one preadv, and only free frames
+	// are used, so that nothing is kicked out.  A page that is already buffered is skipped.
+	// Any preloading that is still going on is stopped first
+	void preload (string fileName, map <string, MyDB_TablePtr> &tables);
+
+	// waits until the pages from the last call to preload have all been read
+	void waitForPreload ();
+
+	// all of the buffer memory is one big, page-aligned chunk of RAM... if huge is true, the
+	// OS is asked to back it with huge pages (via madvise), so that a pool of thousands of
+	// pages takes up a few TLB entries rather than thousands.  This is on by default when
+	// the pool is at least as big as one huge page
+	void setHugePages (bool huge);
+
+	// if direct is true, the table files (and the temp files) are read and written with
+	// O_DIRECT, so that the pages are not also cached by the OS, which would double the
+	// amount of RAM used for them... note that prefetching does nothing in this mode, since
+	// it relies on the OS cache.  Direct I/O needs a page size that is a multiple of the
+	// disk block size (4KB is assumed); with any other page size, this call just prints a
+	// message.  It is off by default
+	void setDirectIO (bool direct);
+
+	// at most maxOpen table files are kept open at once (MAX_OPEN_FILES, by default)... when
+	// another one has to be opened, the one that was used least recently is closed, and it is
+	// opened again the next time that one of its pages is read or written
+	void setMaxOpenFiles (size_t maxOpen);
+
+	// the number of table files that are open right now
+	size_t getNumOpenFiles ();
+
+	// the number of buffered pages that are dirty, and the number that are clean (the rest
+	// of the RAM is not being used)... these can be used to tune the flusher
+	size_t getNumDirty ();
+	size_t getNumClean ();
+
+	// puts the table into (or takes it out of) read-only mode... the pages of a read-only
+	// table are not copied into the buffer pool.  Instead, the table's file is mapped into
+	// memory (via mmap), and a handle to one of its pages points right into the mapping, so
+	// that the OS cache is the buffer for the table: getting the page's bytes never reads or
+	// kicks out anything, and pinning and unpinning it do nothing.  The pages that were in the
+	// file when it was mapped are served this way (any others go through the buffer pool as
+	// usual).  It is an error to write to a page of a read-only table, so a table should be
+	// taken out of read-only mode before loading it.  Handles that were obtained while the
+	// table was read-only stay valid after it is taken out of read-only mode, though they
+	// keep seeing the file as it was when it was mapped
+	void setReadOnly (MyDB_TablePtr whichTable, bool readOnly);
+
+	// returns what the buffer manager has done since it was created (or since the last
+	// call to resetStats): hits and misses, pins and unpins, evictions, and the number and
+	// latency of the reads and writes, for each table and for all of them together
+	MyDB_BufferStats stats ();
+	void resetStats ();
 	
 	// kills the indicated table, so that no pages will ever be written back to it
-	// also removes the physical file from disk, and gets rid of the FD
+	// also removes the physical file from disk, and gets rid of the FD... the table's
+	// pages are dropped from the buffer, and any that are still pinned are never written
 	void killTable (MyDB_TablePtr killMe);
 
 private:
 
-	// tells us the LRU number of each of the pages
-	set <MyDB_PagePtr, CheckLRU> lastUsed;
-
-	// list of ALL of the page objects that are currently in existence
-	map <pair <MyDB_TablePtr, size_t>, MyDB_PagePtr, PageCompare> allPages;
-	
-	// lists the FDs for all of the files
-	map <MyDB_TablePtr, int, TableCompare> fds;
-
-	// all of the chunks of RAM that are currently not allocated
-	vector <void *> availableRam;
-
-	// all of the positions in the temporary file that are currently not in use
-	priority_queue<size_t, vector<size_t>, greater<size_t>> availablePositions;
+	// where the page objects come from... this is declared first, so that it goes away after
+	// the shards, whose tables of pages give their page objects back to it
+	MyDB_PagePoolPtr pagePool;
+
+	// the shards that the pages are split into, and the sub-pools that the shards are split
+	// into (the first of which is the default sub-pool)... both vectors are allocated up front
+	// and never move, so that a sub-pool can be added while other threads are looking at the
+	// existing ones; only the first numShards shards and numSubPools sub-pools are used
+	vector <MyDB_BufferShardPtr> shards;
+	atomic <size_t> numShards;
+	vector <MyDB_SubPoolPtr> subPools;
+	atomic <size_t> numSubPools;
+
+	// the sub-pool that each table (by name) has been put into, if it is not the default one,
+	// and the one that new temp pages go into... tablePools is protected by poolLatch, which
+	// is taken after a shard latch if both are needed
+	map <string, size_t> tablePools;
+	atomic <size_t> tempPool;
+	pthread_rwlock_t poolLatch;
+
+	// used to make copies of the replacement policy for new shards
+	MyDB_ReplacementPolicyPtr policyPrototype;
+
+	// held while the pool is being resized, or sub-pools are being changed
+	mutex resizeLatch;
+
+	// the shard that will be asked to give up a page the next time that we need RAM
+	atomic <size_t> nextVictimShard;
+
+	// the files of all of the tables... each table page holds on to its file, so this is only
+	// looked at when a page object is set up
+	MyDB_FileCachePtr fileCache;
+
+	// all of the RAM (the pages are laid out one after another), and the pages
+	// of it that are currently not allocated... enough address space is set aside for
+	// maxPages pages, but only the first numFramesCarved frames have ever been used, and
+	// of those, retiredFrames were given back to the OS when the pool shrank
+	void *ram;
+	size_t ramSize;
+	shared_ptr <MyDB_FrameList> availableRam;
+	size_t maxPages;
+	size_t numFramesCarved;
+	vector <void *> retiredFrames;
+
+	// the mapping of the file of each read-only table, and the number of pages in it... this
+	// is protected by mapLatch.  The mapping goes away once the table is no longer read-only
+	// and there are no pages pointing into it
+	map <MyDB_TablePtr, pair <shared_ptr <void>, size_t>, TableCompare> mappedFiles;
+	pthread_rwlock_t mapLatch;
+	atomic <size_t> numMappedFiles;
+
+	// true if files are read and written with O_DIRECT
+	atomic <bool> directIO;
+
+	// the shared temp file, the file of the active temp segment (or a nullptr if there is
+	// none), the directories that temp files are striped over, and the number of temp files
+	// that have been created... these are all protected by tempLatch
+	MyDB_TempFilePtr sharedTempFile;
+	MyDB_TempFilePtr segmentTempFile;
+	vector <string> spillDirs;
+	size_t numTempFiles;
+	mutex tempLatch;
+
+	// the number of pages that all of the temp files span, and the most that they ever have
+	atomic <long> numTempFilePages;
+	atomic <long> tempHighWater;
 
 	// the page size
 	size_t pageSize;
 
-	// the time tick associated with the MRU page
-	long lastTimeTick;
-
-	// the last position in the temporary file
-	size_t lastTempPos;
-
 	// where we write the data
 	string tempFile;
 
+	// the number of pages that have been written to, but not written back
+	atomic <long> numDirty;
+
+	// the background thread that writes back dirty pages, and how it is set up
+	thread flusher;
+	mutex flusherLatch;
+	condition_variable flusherWake;
+	bool stopFlusher;
+
+	// the background thread that reads in the pages from a warm-restart file, and a flag
+	// that tells it to stop early
+	thread preloader;
+	atomic <bool> stopPreloader;
+	double flushFraction;
+	long flushIntervalMs;
+
 	// the number of buffer pages
-	size_t numPages;
+	atomic <size_t> numPages;
+
+	// the counters for the pages of each table (by name), and for the temp pages... the
+	// counters are never removed, so a page can keep a pointer to its table's counters.
+	// statsLatch protects the map, and the counters themselves can be updated by anyone
+	map <string, MyDB_BufferCountersPtr> tableCounters;
+	MyDB_BufferCountersPtr tempCounters;
+	mutex statsLatch;
+
+	// where evicted table pages are kept in compressed form (if it has been turned on)
+	MyDB_CompressedCachePtr compressedCache;
+
+	// does the reads for getPages and getPinnedPages
+	MyDB_BatchReaderPtr batchReader;
+	atomic <long> tempAllocations;
+
+	// the number of frames in all of the outstanding grants, and the number of those that
+	// are not being used by pages pinned through their grants (which nobody else may pin)...
+	// these, and the counts in the grants, are protected by grantLatch, which is never held
+	// while taking any other latch
+	size_t numReserved;
+	atomic <size_t> numSetAside;
+	mutex grantLatch;
 
 	// so that the page can access these private methods
 	friend class MyDB_Page;
+	friend class MyDB_MemoryGrant;
+	friend class MyDB_TempSegment;
 	friend class SortMergeJoin;
 
-	// kick out the LRU page
-	void kickOutPage ();
+	// the shard that the given page belongs in
+	size_t pickShard (MyDB_TablePtr whichTable, size_t pos);
+
+	// the sub-pool that the table's pages (or the temp pages) are put into
+	size_t pickSubPool (MyDB_TablePtr whichTable);
+
+	// locks the shard that the given page belongs in, and returns it... the table may be
+	// moved to another sub-pool while we wait for the latch, so this checks again once it
+	// has the latch
+	MyDB_BufferShard &lockShard (MyDB_TablePtr whichTable, size_t pos, unique_lock <mutex> &lock);
+
+	// like the above, for a page that we already have
+	MyDB_BufferShard &lockShard (MyDB_Page *page, unique_lock <mutex> &lock);
+
+	// creates a sub-pool with the given number of shards (which is clamped to [1, MAX_SHARDS])
+	void addSubPool (string poolName, size_t quota, size_t numShards);
+
+	// the index of the named sub-pool; numSubPools if there is none
+	size_t findSubPool (string poolName);
+
+	// tells the sub-pool's replacement policies how many frames they are looking after
+	void sizePolicies (MyDB_SubPool &pool);
+
+	// kicks out the sub-pool's pages until it is within its quota (or the rest are pinned)
+	void trimSubPool (MyDB_SubPool &pool);
+
+	// creates a new temp file in the spill directories (or next to the shared one); must be
+	// called while holding tempLatch
+	MyDB_TempFilePtr makeTempFile ();
+
+	// sends new temp pages back to the shared temp file, if file belongs to the active segment
+	void endTempSegment (MyDB_TempFilePtr file);
+
+	// the counters for the given table's pages (or for temp pages, if it is a nullptr)
+	MyDB_BufferCounters *getCounters (MyDB_TablePtr whichTable);
+
+	// adds up to numFrames frames to the grant, returning the number that were added, and
+	// gives back all of the grant's frames
+	size_t grantFrames (MyDB_MemoryGrant &grant, size_t numFrames);
+	void releaseFrames (MyDB_MemoryGrant &grant);
+
+	// changes the number of frames in the grant and the number that it is using, keeping
+	// numReserved and numSetAside up to date; the caller holds grantLatch
+	void resizeGrant (MyDB_MemoryGrant &grant, size_t numFrames, size_t numUsed);
+
+	// the number of frames that could be granted, given the number that could be pinned
+	// right now; the caller holds grantLatch
+	size_t numGrantable (size_t numPinnable);
+
+	// the number of frames that could be pinned right now: the free ones, and the ones that
+	// hold unpinned pages... this must not be called while holding a shard latch
+	size_t countPinnable ();
+
+	// the number of frames that pages pinned without using a grant's frame may still take:
+	// the ones that could be pinned, less the ones set aside for grants (when nothing is set
+	// aside, this is just numPages)... must not be called while holding a shard latch
+	size_t numUnreserved ();
+
+	// a page that is being pinned through the grant (which may be a nullptr) uses one of
+	// the grant's frames, if the page was not already pinned and the grant has one to spare;
+	// the caller holds the latch of the page's shard
+	void useGrant (MyDB_Page *page, MyDB_MemoryGrantPtr &grant);
+
+	// the page is no longer pinned, so gives back the grant's frame that it was using (if
+	// any); the caller holds the latch of the page's shard
+	void leaveGrant (MyDB_Page *page);
+
+	// if the page is one of the mapped pages of a read-only table, returns a handle to it;
+	// otherwise, returns a nullptr
+	MyDB_PageHandle getMappedPage (MyDB_TablePtr whichTable, long i);
+
+	// gets a chunk of RAM for a page in the given sub-pool, kicking out a page if there is
+	// none free (or if the sub-pool is using all of its quota, in which case the page comes
+	// from the sub-pool); returns a nullptr if all of the RAM is pinned... this must not be
+	// called while holding a shard latch
+	void *getFrame (MyDB_SubPool &pool);
+
+	// kick out a page from the given shard and return its RAM... this is a clean page from
+	// among the next few pages that the replacement policy would pick, if there is one, and
+	// otherwise it is the policy's first choice.  Returns a nullptr if the shard has no page
+	// that can be evicted
+	void *kickOutPage (MyDB_BufferShard &shard);
+
+	// the body of the flusher thread
+	void flushLoop ();
+
+	// the body of the thread that reads in the pages listed by preload ()
+	void preloadLoop (vector <pair <MyDB_TablePtr, vector <size_t>>> work);
+
+	// reads in up to count pages of the table, starting with page first, into free frames;
+	// returns the number of pages that were read
+	size_t preloadRun (MyDB_TablePtr whichTable, size_t first, size_t count);
+
+	// writes back the dirty pages among the given fraction of the shard's evictable pages
+	// that are next in line to be evicted
+	void flushVictims (MyDB_BufferShard &shard, double fraction);
+
+	// clears the page's dirty bit, writing the page back if it was set
+	void writeIfDirty (MyDB_Page *page);
+
+	// writes back the dirty pages of the given table (or of every table, if it is a nullptr)
+	void flush (MyDB_TablePtr whichTable);
+
+	// writes back a list of dirty pages that all come from the same table, coalescing the
+	// pages that are next to each other in the file... the caller must hold every shard latch
+	void writePages (vector <MyDB_Page *> &pages);
+
+	// process an access to the given page... if it is not buffered and there is no frame
+	// that it can be read into (since every one is pinned), it is left without its bytes
+	void access (MyDB_Page *updateMe);
+
+	// gives the page a new access hint, unless the hint would keep the page for less time than
+	// the one that it has and lower is false; the page's shard must be latched
+	void applyHint (MyDB_Page *page, MyDB_AccessHint hint, bool lower);
+
+	// called when the last handle to a page goes away; removes all traces of the page
+	// from the buffer manager, unless some other thread got a new handle to it meanwhile
+	void killPage (MyDB_Page *killMe);
+
+	// like the above, but the caller holds the latch of the page's shard
+	void killPage (MyDB_BufferShard &shard, MyDB_Page *killMe);
+
+	// marks the page's contents as dead (see MyDB_PageHandleBase :: discard ())
+	void discardPage (MyDB_Page *discardMe);
+
+	// like the above, but the caller holds the latch of the page's shard
+	void discardPage (MyDB_BufferShard &shard, MyDB_Page *discardMe);
 
-	// process an access to the given page
-	void access (MyDB_PagePtr updateMe);
+	// does the work of getPages and getPinnedPages
+	vector <MyDB_PageHandle> getPages (MyDB_TablePtr whichTable, vector <long> &positions, MyDB_AccessHint hint,
+		bool pin, MyDB_MemoryGrantPtr grant);
 
-	// removes all traces of the page from the buffer manager
-	void killPage (MyDB_PagePtr killMe);
+	// reads in the pages that are not buffered among handles first through first + count - 1,
+	// pinning all of them (through the grant, which may be a nullptr) if pin is true... the
+	// handle to a page that could not be pinned is set to a nullptr
+	void loadPages (vector <MyDB_PageHandle> &handles, size_t first, size_t count, bool pin,
+		MyDB_MemoryGrantPtr grant);
+
+	// reads the bytes of all of the pages (which are table pages) from their files at once;
+	// the caller holds the latches of all of their shards
+	void readBatch (vector <MyDB_Page *> &pages);
+
+	// read the page's bytes from its file, and write them back
+	void readPage (MyDB_Page *page);
+	void writePage (MyDB_Page *page);
 
 };
 
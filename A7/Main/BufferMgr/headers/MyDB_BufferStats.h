@@ -0,0 +1,135 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef BUFFER_STATS_H
+#define BUFFER_STATS_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include <ostream>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+// the I/O latency histograms have one bucket for requests that took less than a
+// microsecond, and then one for each power of two: [1, 2) us, [2, 4) us, and so on...
+// the last bucket also gets everything that is even slower
+#define NUM_LATENCY_BUCKETS 24
+
+// the name that the counts for temp pages are listed under
+#define TEMP_PAGES_NAME "<temp>"
+
+// what the buffer manager has done for the pages of one table (or of all of them)
+struct MyDB_BufferCounts {
+
+	// the number of times that a page's bytes were asked for (or a page was pinned) and
+	// they were already in RAM, and the number of times that they had to be read in
+	long hits;
+	long misses;
+
+	// the number of requests for a pinned page, and the number of times that a pinned
+	// page became unpinned (either explicitly, or because its last handle went away)
+	long pins;
+	long unpins;
+
+	// the number of pages that were kicked out of RAM, split by whether they had to be
+	// written back first
+	long cleanEvictions;
+	long dirtyEvictions;
+
+	// the number of pages read from and written to the file
+	long reads;
+	long writes;
+
+	// the number of misses that were served out of the compressed cache, rather than from disk
+	long unpacks;
+
+	// how long the reads and the writes took... there is one entry per system call, so a
+	// write of a run of adjacent pages counts once
+	vector <long> readLatency;
+	vector <long> writeLatency;
+
+	MyDB_BufferCounts ();
+
+	// adds the other counts into these
+	void add (const MyDB_BufferCounts &other);
+};
+
+// the live version of the above, which the buffer manager updates as it works... any
+// number of threads can update it at once
+class MyDB_BufferCounters {
+
+public:
+
+	atomic <long> hits;
+	atomic <long> misses;
+	atomic <long> pins;
+	atomic <long> unpins;
+	atomic <long> cleanEvictions;
+	atomic <long> dirtyEvictions;
+	atomic <long> reads;
+	atomic <long> writes;
+	atomic <long> unpacks;
+	atomic <long> readLatency[NUM_LATENCY_BUCKETS];
+	atomic <long> writeLatency[NUM_LATENCY_BUCKETS];
+
+	MyDB_BufferCounters ();
+
+	// adds one to the counter... no ordering is needed, since nobody waits on a counter
+	static void count (atomic <long> &counter, long howMany = 1) {
+		counter.fetch_add (howMany, memory_order_relaxed);
+	}
+
+	// adds an I/O request that took the given number of nanoseconds to a histogram
+	static void countLatency (atomic <long> *histogram, long nanos);
+
+	// copies out the current values, and sets them all back to zero
+	MyDB_BufferCounts getCounts ();
+	void reset ();
+};
+typedef shared_ptr <MyDB_BufferCounters> MyDB_BufferCountersPtr;
+
+// a snapshot of everything that the buffer manager knows about how it is doing
+struct MyDB_BufferStats {
+
+	// the size of the pool, and what is in it right now
+	size_t numPages;
+	size_t pageSize;
+	size_t numDirty;
+	size_t numClean;
+
+	// the number of temp pages that were created, the number of pages that the temp files
+	// span now, and the most that they have ever spanned
+	long tempAllocations;
+	long tempFilePages;
+	long tempHighWater;
+
+	// the compressed cache's capacity in bytes (zero if it is off), the number of pages in it,
+	// and the number of bytes that they take up
+	size_t compressedCapacity;
+	size_t compressedPages;
+	size_t compressedBytes;
+
+	// for each sub-pool, its quota (zero if it has none) and the number of frames it is using
+	map <string, pair <size_t, size_t>> subPools;
+
+	// the counts for each table (the temp pages are listed under TEMP_PAGES_NAME), and the
+	// sum of all of them... pages of read-only tables are not counted, since they never
+	// go through the pool
+	map <string, MyDB_BufferCounts> tables;
+	MyDB_BufferCounts total;
+
+	// prints out the stats as a table, followed by the latency histograms for all of the I/O
+	friend std::ostream& operator<<(std::ostream& os, const MyDB_BufferStats &printMe);
+};
+
+#endif
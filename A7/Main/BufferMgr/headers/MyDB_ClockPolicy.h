@@ -0,0 +1,49 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef CLOCK_POLICY_H
+#define CLOCK_POLICY_H
+
+#include "MyDB_PageList.h"
+#include "MyDB_ReplacementPolicy.h"
+
+// the CLOCK (second chance) approximation of LRU... an access just sets the page's
+// reference bit, and the hand sweeps around the ring clearing the bits until it
+// finds a page whose bit is not set
+class MyDB_ClockPolicy : public MyDB_ReplacementPolicy {
+
+public:
+
+	MyDB_ClockPolicy ();
+
+	void pageIn (MyDB_Page *page) override;
+	void pageAccessed (MyDB_Page *page) override;
+	void pageUnpinned (MyDB_Page *page) override;
+	void remove (MyDB_Page *page) override;
+	void getVictims (size_t n, vector <MyDB_Page *> &victims) override;
+	void evict (MyDB_Page *page) override;
+	bool contains (MyDB_Page *page) override;
+	size_t size () override;
+	MyDB_ReplacementPolicyPtr clone () override;
+
+private:
+
+	// all of the pages, in the order that the hand visits them (wrapping around)
+	MyDB_PageList ring;
+
+	// the next page the hand will look at
+	MyDB_Page *hand;
+
+	// moves the hand forward one page
+	void advance ();
+};
+
+#endif
+
@@ -0,0 +1,91 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef COMPRESSED_CACHE_H
+#define COMPRESSED_CACHE_H
+
+#include <atomic>
+#include <list>
+#include <memory>
+#include <mutex>
+#include "PageHash.h"
+#include <string>
+#include <unordered_map>
+
+using namespace std;
+
+class MyDB_CompressedCache;
+typedef shared_ptr <MyDB_CompressedCache> MyDB_CompressedCachePtr;
+
+// a second tier of buffering, below the pool: the buffer manager puts each table page that
+// it evicts in here in compressed form, and a miss in the pool looks here before going to
+// disk.  It holds compressed pages up to a fixed number of bytes, letting go of the least
+// recently added ones first.  A page is taken out when it goes back into the pool, so a
+// page is never in both places; since a page is only added once it is clean, a copy here is
+// always the same as what is on disk
+class MyDB_CompressedCache {
+
+public:
+
+	// a cache that holds up to capacity bytes of compressed pages of pageSize bytes each;
+	// a capacity of zero turns the cache off
+	MyDB_CompressedCache (size_t capacity, size_t pageSize);
+
+	// changes the capacity, letting go of pages as needed
+	void setCapacity (size_t capacity);
+
+	// compresses the (clean) page and keeps it, replacing any older copy; a page that does not
+	// shrink to at most MAX_COMPRESSED_FRACTION of its size is not kept
+	void put (MyDB_PageKey whichPage, void *bytes);
+
+	// if the page is here, decompresses it into the given bytes and takes it out
+	bool get (MyDB_PageKey whichPage, void *bytes);
+
+	// lets go of a page, or of all of the pages of a table, whose contents are dead
+	void erase (MyDB_PageKey whichPage);
+	void eraseTable (MyDB_TablePtr whichTable);
+
+	// the number of pages held, and the number of bytes that they take up
+	size_t getNumPages ();
+	size_t getNumBytes ();
+	size_t getCapacity ();
+
+private:
+
+	struct Entry {
+		MyDB_PageKey whichPage;
+
+		// the file that the page came from, since two tables with the same name (such as a
+		// table and the output of a query) are not always stored in the same place
+		string storageLoc;
+		string compressed;
+	};
+
+	// lets go of the oldest pages until there are no more than capacity bytes
+	void trim ();
+
+	// takes one entry out
+	void remove (list <Entry> :: iterator which);
+
+	// this can be read without the latch, so that a cache that is turned off costs nothing
+	atomic <size_t> capacity;
+
+	// protects everything below
+	mutex latch;
+
+	size_t pageSize;
+	size_t numBytes;
+
+	// the pages, most recently added at the front, and where each page is in the list
+	list <Entry> entries;
+	unordered_map <MyDB_PageKey, list <Entry> :: iterator, PageHash, PageEqual> index;
+};
+
+#endif
@@ -0,0 +1,93 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef FILE_CACHE_H
+#define FILE_CACHE_H
+
+#include <atomic>
+#include <map>
+#include <memory>
+#include "MyDB_Table.h"
+#include "MyDB_TableFile.h"
+#include <pthread.h>
+#include <string>
+#include <unordered_map>
+
+using namespace std;
+
+class MyDB_FileCache;
+typedef shared_ptr <MyDB_FileCache> MyDB_FileCachePtr;
+
+// the files of all of the tables that a buffer manager has touched, no more than maxOpen of
+// which are open at once: to open another one, the file that was used least recently (and
+// that nobody is using right now) is closed first.  This way, a catalog can have many more
+// tables than the process can have open files.  A table's file is found by its storage
+// location the first time that a table object asks for it, and by the table object (which
+// is just a pointer comparison) after that
+class MyDB_FileCache {
+
+public:
+
+	// the file that the table is stored in, which is created and opened if this is the
+	// first time that anyone has asked for it
+	MyDB_TableFilePtr getFile (MyDB_TablePtr whichTable);
+
+	// if the table's file has been asked for, closes it and deletes it... any page that still
+	// refers to the file can no longer read or write it
+	void killFile (MyDB_TablePtr whichTable);
+
+	// changes the number of files that can be open at once, closing files if need be; while
+	// every open file is being used, more files than this may be open for a short while
+	void setMaxOpen (size_t maxOpen);
+	size_t getMaxOpen ();
+
+	// the number of files that are open right now
+	size_t getNumOpen ();
+
+	// turns O_DIRECT on or off for the open files, and for those opened from now on
+	void setDirectIO (bool direct);
+
+	// a cache that keeps up to maxOpen files open at once
+	MyDB_FileCache (size_t maxOpen);
+
+	// closes all of the files
+	~MyDB_FileCache ();
+
+private:
+
+	friend class MyDB_TableFile;
+
+	// opens a file that is closed; returns false if its table has been killed
+	bool reopen (MyDB_TableFile *file);
+
+	// opens the file, closing others first if there are too many open... the caller holds
+	// latch for writing
+	void open (MyDB_TableFile *file);
+
+	// closes the least recently used file that nobody is using, returning false if there is
+	// none... the caller holds latch for writing
+	bool closeOldest ();
+
+	// held for reading to look up a file, and for writing to add, open or close one
+	pthread_rwlock_t latch;
+
+	// all of the files, by storage location, and by the table objects that have asked for them
+	map <string, MyDB_TableFilePtr> files;
+	unordered_map <MyDB_TablePtr, MyDB_TableFilePtr> tableFiles;
+
+	size_t maxOpen;
+	atomic <size_t> numOpen;
+	bool directIO;
+
+	// ticks every time that a file is used
+	atomic <long> clock;
+};
+
+#endif
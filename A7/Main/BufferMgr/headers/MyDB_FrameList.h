@@ -0,0 +1,60 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef FRAME_LIST_H
+#define FRAME_LIST_H
+
+#include <atomic>
+#include <cstdint>
+#include <memory>
+
+using namespace std;
+
+// the set of buffer frames that are not holding any page... this is a lock-free
+// (Treiber) stack, so threads can grab and return frames without taking a latch.
+// The frames are the maxFrames consecutive chunks of frameSize bytes that start at
+// base, and each is known by its index; the head of the stack packs that index together
+// with a counter that goes up on every change, so that a thread whose compare-and-swap
+// was delayed (while the top frame was popped and then pushed back) cannot corrupt the stack
+class MyDB_FrameList {
+
+public:
+
+	// the first numFrames of the frames start out on the list
+	MyDB_FrameList (void *base, size_t frameSize, size_t maxFrames, size_t numFrames);
+
+	// returns the frame to the list (or adds it for the first time); it must be one of the
+	// maxFrames frames that the list was built for
+	void push (void *frame);
+
+	// takes a frame off of the list; returns a nullptr if there are no free frames
+	void *pop ();
+
+	// the number of free frames (this can be out of date by the time it is returned)
+	size_t size ();
+
+private:
+
+	// where the frames are
+	char *base;
+	size_t frameSize;
+
+	// next [i] is one more than the index of the frame under frame i on the stack
+	// (zero at the bottom of the stack)
+	unique_ptr <atomic <uint32_t> []> next;
+
+	// the upper 32 bits are the change counter; the lower 32 bits are one more than
+	// the index of the frame at the top of the stack (zero if the stack is empty)
+	atomic <uint64_t> head;
+
+	atomic <long> numFree;
+};
+
+#endif
@@ -0,0 +1,53 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef HINTED_POLICY_H
+#define HINTED_POLICY_H
+
+#include "MyDB_PageList.h"
+#include "MyDB_ReplacementPolicy.h"
+
+// wraps one of the other policies so that the access hints that come with page requests are
+// honored, whichever policy is being used.  Pages from scans are kept in a list of their own
+// that is emptied (oldest first) before the wrapped policy is asked for a victim, and hot
+// pages are kept in an LRU list that is only touched once the wrapped policy has nothing
+// left.  Every other page is up to the wrapped policy.  A page whose hint has changed is
+// moved to the right place the next time that it is accessed
+class MyDB_HintedPolicy : public MyDB_ReplacementPolicy {
+
+public:
+
+	MyDB_HintedPolicy (MyDB_ReplacementPolicyPtr inner);
+
+	void setNumFrames (size_t numFrames) override;
+	void pageIn (MyDB_Page *page) override;
+	void pageAccessed (MyDB_Page *page) override;
+	void pageUnpinned (MyDB_Page *page) override;
+	void remove (MyDB_Page *page) override;
+	void getVictims (size_t n, vector <MyDB_Page *> &victims) override;
+	void evict (MyDB_Page *page) override;
+	bool contains (MyDB_Page *page) override;
+	size_t size () override;
+	MyDB_ReplacementPolicyPtr clone () override;
+
+private:
+
+	// the policy for the pages without a hint
+	MyDB_ReplacementPolicyPtr inner;
+
+	// the pages from scans and the hot pages, most recently used at the front of each
+	MyDB_PageList scanned;
+	MyDB_PageList hot;
+
+	// the list that the page's hint says it belongs in (nullptr for the wrapped policy)
+	MyDB_PageList *listFor (MyDB_Page *page);
+};
+
+#endif
@@ -0,0 +1,79 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef LRUK_POLICY_H
+#define LRUK_POLICY_H
+
+#include <deque>
+#include "MyDB_ReplacementPolicy.h"
+#include "PageHash.h"
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+// LRU-K replacement (O'Neil, O'Neil and Weikum)... the victim is the page whose K^th most
+// recent access is furthest in the past.  Pages that have been accessed fewer than K times
+// go first (in LRU order), so a page touched once by a scan never displaces a page that is
+// touched over and over.  The access history of recently evicted pages is retained, so
+// that a page that comes right back is not treated as brand new.  Ordering the pages by
+// their K^th access means that operations here are O(log n) rather than O(1)
+class MyDB_LRUKPolicy : public MyDB_ReplacementPolicy {
+
+public:
+
+	// K is the number of accesses remembered for each page; accesses to a page that come
+	// within correlatedPeriod ticks of the previous one (for example, the next record on
+	// a page that is being scanned) are considered to be the same reference
+	MyDB_LRUKPolicy (size_t k, long correlatedPeriod);
+
+	void setNumFrames (size_t numFrames) override;
+	void pageIn (MyDB_Page *page) override;
+	void pageAccessed (MyDB_Page *page) override;
+	void pageUnpinned (MyDB_Page *page) override;
+	void remove (MyDB_Page *page) override;
+	void getVictims (size_t n, vector <MyDB_Page *> &victims) override;
+	void evict (MyDB_Page *page) override;
+	bool contains (MyDB_Page *page) override;
+	size_t size () override;
+	MyDB_ReplacementPolicyPtr clone () override;
+
+private:
+
+	// the K from LRU-K
+	size_t k;
+
+	// the logical clock used to time-stamp accesses
+	long currentTick;
+
+	// accesses that are this close together count as a single reference
+	long correlatedPeriod;
+
+	// the evictable pages, ordered by (time of K^th access, time of last access)...
+	// the first page in the set is the next victim
+	set <pair <pair <long, long>, MyDB_Page *>> candidates;
+
+	// access histories for pages that have been evicted... each is tagged with a
+	// sequence number, so that stale entries in the FIFO can be recognized
+	unordered_map <MyDB_PageKey, pair <long, vector <long>>, PageHash, PageEqual> retained;
+	deque <pair <MyDB_PageKey, long>> retainedOrder;
+	long nextSeqNum;
+
+	// the number of evicted page histories to hold onto
+	size_t maxRetained;
+
+	// where the page sits in the candidate set
+	pair <pair <long, long>, MyDB_Page *> getKey (MyDB_Page *page);
+
+	// records an access to the page, which must not be in the candidate set
+	void recordAccess (MyDB_Page *page);
+};
+
+#endif
+
@@ -0,0 +1,39 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef LRU_POLICY_H
+#define LRU_POLICY_H
+
+#include "MyDB_PageList.h"
+#include "MyDB_ReplacementPolicy.h"
+
+// classic least-recently-used replacement
+class MyDB_LRUPolicy : public MyDB_ReplacementPolicy {
+
+public:
+
+	void pageIn (MyDB_Page *page) override;
+	void pageAccessed (MyDB_Page *page) override;
+	void pageUnpinned (MyDB_Page *page) override;
+	void remove (MyDB_Page *page) override;
+	void getVictims (size_t n, vector <MyDB_Page *> &victims) override;
+	void evict (MyDB_Page *page) override;
+	bool contains (MyDB_Page *page) override;
+	size_t size () override;
+	MyDB_ReplacementPolicyPtr clone () override;
+
+private:
+
+	// most recently used page at the front, least recently used at the back
+	MyDB_PageList lastUsed;
+};
+
+#endif
+
@@ -0,0 +1,66 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef MEMORY_GRANT_H
+#define MEMORY_GRANT_H
+
+#include <memory>
+
+using namespace std;
+
+// forward definition to handle circular dependencies
+class MyDB_BufferManager;
+class MyDB_MemoryGrant;
+typedef shared_ptr <MyDB_MemoryGrant> MyDB_MemoryGrantPtr;
+
+// a number of buffer frames that have been set aside for one operator, so that it can
+// pin that many pages without running the buffer manager out of RAM... the frames are
+// not tied to any particular pages; a page that is pinned through the grant (see
+// MyDB_BufferManager.getPinnedPage (grant)) uses one of them until it is unpinned, and
+// the ones that are not being used can't be pinned by anyone else.  The frames go back to
+// the buffer manager when the grant is released, or when there are no more references to
+// it (a page pinned through the grant keeps a reference to it)
+class MyDB_MemoryGrant {
+
+public:
+
+	// the number of frames in the grant
+	size_t getNumFrames ();
+
+	// the number of the frames that are being used by pages pinned through the grant
+	size_t getNumUsed ();
+
+	// asks for numMore frames in addition to the ones that are already in the grant;
+	// returns the number of frames that were added, which may be fewer (or zero)
+	size_t grow (size_t numMore);
+
+	// gives back all of the frames... pages that are still pinned through the grant stay
+	// pinned, but they no longer count against it
+	void release ();
+
+	// an empty grant, which the buffer manager then adds frames to
+	MyDB_MemoryGrant (MyDB_BufferManager &parent);
+
+	~MyDB_MemoryGrant ();
+
+private:
+
+	friend class MyDB_BufferManager;
+
+	// the buffer manager that the frames came from
+	MyDB_BufferManager &parent;
+
+	// the number of frames, and the number that pinned pages are using... these are
+	// protected by the parent's grantLatch
+	size_t numFrames;
+	size_t numUsed;
+};
+
+#endif
@@ -12,46 +12,62 @@
 #ifndef PAGE_H
 #define PAGE_H
 
+#include <atomic>
+#include <cstddef>
 #include <memory>
+#include "MyDB_AccessHint.h"
+#include "MyDB_MemoryGrant.h"
 #include "MyDB_Table.h"
+#include "MyDB_TableFile.h"
+#include "MyDB_TempFile.h"
 #include <string>
+#include <utility>
+#include <vector>
 
-// create a smart pointer for pages
 using namespace std;
-class MyDB_Page;
-typedef shared_ptr <MyDB_Page> MyDB_PagePtr;
 
 // forward deifnition to handle circular dependencies
 class MyDB_BufferManager;
+class MyDB_BufferCounters;
+class MyDB_PageList;
+class MyDB_PagePool;
 
 class MyDB_Page {
 
 public:
 
 	// access the raw bytes in this page
-	void *getBytes (MyDB_PagePtr me);
+	void *getBytes ();
 
 	// let the page know that we have written to the bytes
 	void wroteBytes ();
 
-	// there are no more references to this page when this is called...
-	// if the page owns any RAM, it should give it back to the parent
-	// buffer manager
+	// let the page know that its contents will never be looked at again
+	void discard ();
+
+	// the page objects are only ever destroyed by the parent's pool of page objects
 	~MyDB_Page ();
 
+	// creates a page object for the parent buffer manager's pool... it is not a page of
+	// anything until it is set up with init ()
+	MyDB_Page (MyDB_BufferManager &parent);
+
 	// sets up the page... takes as input the relation that the page is
 	// bound to (this should be a nullptr if this is a temp page) and
 	// the position of the page in the file
-	MyDB_Page (MyDB_TablePtr myTable, size_t i, MyDB_BufferManager &parent);
+	void init (MyDB_TablePtr myTable, size_t i);
+
+	// lets go of everything that the page refers to, so that the object can go back into the pool
+	void clear ();
 
 	// sets the bytes in the page
 	void setBytes (void *bytes, size_t numBytes);
 
-	// decrements the ref count
-	inline void decRefCount (MyDB_PagePtr me) {
-		refCount--;
-		if (refCount == 0) {
-			killpage (me);
+	// decrements the ref count... since another thread may get a new handle to the
+	// page right after the count hits zero, the buffer manager checks it again
+	inline void decRefCount () {
+		if (--refCount == 0) {
+			killpage ();
 		}
 	}
 
@@ -66,17 +82,28 @@ public:
 private:
 
 	friend class MyDB_BufferManager;
-	friend class PageComp;
-	friend class CheckLRU;
-
-	// a pointer to the raw bytes
-	void *bytes;
+	friend class MyDB_PageList;
+	friend class MyDB_LRUPolicy;
+	friend class MyDB_ClockPolicy;
+	friend class MyDB_LRUKPolicy;
+	friend class MyDB_TwoQPolicy;
+	friend class MyDB_HintedPolicy;
+	friend class MyDB_PagePool;
+	friend class MyDB_PagePtr;
+
+	// a pointer to the raw bytes... this is only changed while holding the latch of
+	// the page's shard in the buffer manager, but it is read without the latch
+	atomic <void *> bytes;
 
 	// the number of raw bytes available
 	size_t numBytes;
 
 	// tells us if this page needs to be written back
-	bool isDirty;	
+	atomic <bool> isDirty;
+
+	// true once the page's contents are dead (it was discarded, or its table was killed), so
+	// that it is never written back... a dead page is no longer in its shard's allPages
+	bool dead;
 
 	// pointer to the parent buffer manager
 	MyDB_BufferManager& parent;		
@@ -88,14 +115,121 @@ private:
 	// this is the position of the page in the relation
 	size_t pos;
 
-	// this is the last time that the page had been accessed
-	long timeTick;
+	// the file that the relation is stored in, so that reading or writing the page does not
+	// need to look it up (a nullptr for a temp page)
+	MyDB_TableFilePtr file;
+
+	// if this is a temp page, the temp file that it is stored in (and pos is its position
+	// there), and whether it has ever been written to that file
+	MyDB_TempFilePtr tempFile;
+	bool wasWritten;
+
+	// the number of handles to the page
+	atomic <int> refCount;
+
+	// the number of references to the page object (from handles, and from the buffer manager's
+	// table of pages); once it goes to zero, the object goes back into the pool
+	atomic <int> useCount;
+
+	// if this is a page of a read-only table, bytes point into the mapping of the table's
+	// file, and this keeps the mapping alive; otherwise it is a nullptr
+	shared_ptr <void> mappedFile;
+
+	// the shard of the buffer manager that the page lives in... this only changes while
+	// holding every shard's latch (see MyDB_BufferManager.useSubPool), so it has to be
+	// checked again once the latch of the shard is held (see MyDB_BufferManager.lockShard)
+	atomic <size_t> shard;
+
+	// the buffer manager's counters for the page's table (or for temp pages)
+	MyDB_BufferCounters *counters;
+
+	// if the page is pinned through a grant and is using one of the grant's frames, the grant
+	// (see MyDB_BufferManager.getPinnedPage (grant)); otherwise a nullptr... only changed
+	// while holding the latch of the page's shard
+	MyDB_MemoryGrantPtr grant;
 
-	// the number of references
-	int refCount;
+	// links for the intrusive recency list that the page is in (if any)... while the page object
+	// is in the pool of free page objects, listNext chains it to the next one
+	MyDB_Page *listPrev;
+	MyDB_Page *listNext;
+	MyDB_PageList *myList;
+
+	// the CLOCK reference bit
+	bool referenced;
+
+	// how the page is going to be used, from the latest request for it (see MyDB_AccessHint.h)...
+	// only changed while holding the latch of the page's shard
+	MyDB_AccessHint hint;
+
+	// true if 2Q has promoted the page into its queue of hot pages
+	bool hot;
+
+	// LRU-K: the times of the last K accesses to the page, most recent first
+	vector <long> history;
 
 	// kill the page
-	void killpage (MyDB_PagePtr me);
+	void killpage ();
+
+	// gives the object back to the parent's pool; called once useCount goes to zero
+	void recycle ();
+};
+
+// a reference to a page object... this works like a shared_ptr, except that the count is kept
+// in the page itself, so that getting a new reference never allocates anything, and once the
+// last reference goes away, the object goes back into the buffer manager's pool of page objects
+// (see MyDB_PagePool.h) rather than being deleted
+class MyDB_PagePtr {
+
+public:
+
+	MyDB_PagePtr () : page (nullptr) {}
+
+	MyDB_PagePtr (nullptr_t) : page (nullptr) {}
+
+	explicit MyDB_PagePtr (MyDB_Page *pageIn) : page (pageIn) {
+		if (page != nullptr)
+			page->useCount++;
+	}
+
+	MyDB_PagePtr (const MyDB_PagePtr &copyMe) : MyDB_PagePtr (copyMe.page) {}
+
+	MyDB_PagePtr (MyDB_PagePtr &&moveMe) : page (moveMe.page) {
+		moveMe.page = nullptr;
+	}
+
+	MyDB_PagePtr &operator = (MyDB_PagePtr assignMe) {
+		swap (page, assignMe.page);
+		return *this;
+	}
+
+	~MyDB_PagePtr () {
+		if (page != nullptr && --page->useCount == 0)
+			page->recycle ();
+	}
+
+	MyDB_Page *get () const {
+		return page;
+	}
+
+	MyDB_Page *operator -> () const {
+		return page;
+	}
+
+	MyDB_Page &operator * () const {
+		return *page;
+	}
+
+	bool operator == (nullptr_t) const {
+		return page == nullptr;
+	}
+
+	bool operator != (nullptr_t) const {
+		return page != nullptr;
+	}
+
+private:
+
+	MyDB_Page *page;
 };
 
 #endif
@@ -0,0 +1,36 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef PAGE_COMPRESSOR_H
+#define PAGE_COMPRESSOR_H
+
+#include <cstddef>
+
+// a small, fast LZ77 compressor (in the style of LZ4) for buffer pages... it goes for speed
+// rather than for the best ratio, since it runs every time that a page is evicted into the
+// compressed cache.  The compressed data is a list of sequences, each of which is a token
+// byte (the number of literals in the high four bits and the match length less four in the
+// low four, with 15 meaning that more length bytes follow), the literals, a two-byte offset
+// back to the start of the match, and any extra match length bytes.  The last sequence has
+// only literals
+class MyDB_PageCompressor {
+
+public:
+
+	// compresses len bytes from in into out, which has room for capacity bytes... returns the
+	// compressed size, or zero if it would not fit into capacity bytes
+	static size_t compress (const void *in, size_t len, void *out, size_t capacity);
+
+	// decompresses inLen bytes from in into out, which must come out to exactly outLen bytes;
+	// returns false if the compressed data is not valid
+	static bool decompress (const void *in, size_t inLen, void *out, size_t outLen);
+};
+
+#endif
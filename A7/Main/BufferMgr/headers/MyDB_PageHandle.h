@@ -13,61 +13,118 @@
 #ifndef PAGE_HANDLE_H
 #define PAGE_HANDLE_H
 
+#include <cstddef>
 #include <memory>
 #include "MyDB_Page.h"
 #include "MyDB_Table.h"
 #include <string>
+#include <utility>
 
 // page handles are basically smart pointers
 using namespace std;
-class MyDB_PageHandleBase;
-typedef shared_ptr <MyDB_PageHandleBase> MyDB_PageHandle;
 
+// what a page handle can do... this is what the -> of a MyDB_PageHandle gets at
 class MyDB_PageHandleBase {
 
 public:
 
-	// access the raw bytes in this page
-	void *getBytes () {
-		return page->getBytes (page);
+	// access the raw bytes in this page... this is a nullptr if the page is not buffered
+	// and it can't be read in, since every frame in the pool is pinned
+	void *getBytes () const {
+		return page->getBytes ();
 	}
 
 	// let the page know that we have written to the bytes.  Must always
 	// be called once the page's bytes have been written.  If this is not
 	// called, then the page will never be marked as dirty, and the page
 	// will never be written to disk. 
-	void wroteBytes () {
+	void wroteBytes () const {
 		page->wroteBytes ();
 	}
 
+	// let the page know that nobody is going to look at its contents again (say, because
+	// it is part of a sorted run that has been merged)... the page is never written back,
+	// and its RAM is given back right away, unless it is pinned.  If this is a page of a
+	// table, the next request for it gets the version that is in the table's file
+	void discard () const {
+		page->discard ();
+	}
+
+private:
+
+	friend class MyDB_PageHandle;
+	friend class MyDB_PageReaderWriter;
+
+	// get the buffer manager
+	MyDB_BufferManager &getParent () const {
+		return page->getParent ();
+	}
+
+	friend class MyDB_BufferManager;
+	MyDB_PagePtr page;
+};
+
+// a handle to a page... this is a value, not a pointer to an object, so getting a handle
+// (or copying one) never allocates anything: every handle (and every copy of one) counts
+// as a reference to the page, and when the last one goes away, the page's reference count
+// goes down to zero, so that a pinned page becomes unpinned.  A default handle (or one that
+// has been set to nullptr) refers to no page
+class MyDB_PageHandle {
+
+public:
+
+	MyDB_PageHandle () {}
+
+	MyDB_PageHandle (nullptr_t) {}
+
+	MyDB_PageHandle (const MyDB_PageHandle &copyMe) {
+		base.page = copyMe.base.page;
+		if (base.page != nullptr)
+			base.page->incRefCount ();
+	}
+
+	MyDB_PageHandle (MyDB_PageHandle &&moveMe) {
+		base.page = move (moveMe.base.page);
+	}
+
+	MyDB_PageHandle &operator = (MyDB_PageHandle assignMe) {
+		swap (base.page, assignMe.base.page);
+		return *this;
+	}
+
 	// There are no more references to the handle when this is called...
 	// this should decrmeent a reference count to the number of handles
 	// to the particular page that it references.  If the number of 
 	// references to a pinned page goes down to zero, then the page should
 	// become unpinned.  
-	~MyDB_PageHandleBase () {
-		page->decRefCount (page);
+	~MyDB_PageHandle () {
+		if (base.page != nullptr)
+			base.page->decRefCount ();
 	}
 
-	// sets up the page...
-	MyDB_PageHandleBase (MyDB_PagePtr useMe) {
-		page = useMe;
-		page->incRefCount ();
+	const MyDB_PageHandleBase *operator -> () const {
+		return &base;
 	}
 
-private:
+	bool operator == (nullptr_t) const {
+		return base.page == nullptr;
+	}
 
-	friend class MyDB_PageReaderWriter;
+	bool operator != (nullptr_t) const {
+		return base.page != nullptr;
+	}
 
-	// get the buffer manager
-	MyDB_BufferManager &getParent () {
-		return page->getParent ();
+private:
+
+	// sets up a new handle to the page
+	explicit MyDB_PageHandle (MyDB_PagePtr useMe) {
+		base.page = useMe;
+		if (base.page != nullptr)
+			base.page->incRefCount ();
 	}
 
-	friend class CheckLRU;
 	friend class MyDB_BufferManager;
-	MyDB_PagePtr page;
+	MyDB_PageHandleBase base;
 };
 
 #endif
-
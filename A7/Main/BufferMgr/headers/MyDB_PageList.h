@@ -0,0 +1,140 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef PAGE_LIST_H
+#define PAGE_LIST_H
+
+#include "MyDB_Page.h"
+
+// an intrusive, doubly-linked list of pages... the links live inside of the
+// MyDB_Page objects themselves, so that adding a page, removing a page, and
+// finding the page at either end are all constant time operations.  A page
+// can be a member of at most one list at a time.  The list does not own the
+// pages; whoever puts a page into a list must take it out before the page dies
+class MyDB_PageList {
+
+public:
+
+	MyDB_PageList () {
+		head = nullptr;
+		tail = nullptr;
+		numPages = 0;
+	}
+
+	// true if the page is currently linked into this list
+	bool contains (MyDB_Page *page) {
+		return page->myList == this;
+	}
+
+	// adds the page at the front (the most recently used end) of the list
+	void pushFront (MyDB_Page *page) {
+		page->myList = this;
+		page->listPrev = nullptr;
+		page->listNext = head;
+		if (head != nullptr)
+			head->listPrev = page;
+		else
+			tail = page;
+		head = page;
+		numPages++;
+	}
+
+	// adds the page at the back (the least recently used end) of the list
+	void pushBack (MyDB_Page *page) {
+		page->myList = this;
+		page->listNext = nullptr;
+		page->listPrev = tail;
+		if (tail != nullptr)
+			tail->listNext = page;
+		else
+			head = page;
+		tail = page;
+		numPages++;
+	}
+
+	// adds the page just before the page "before", which must be in this list
+	void insertBefore (MyDB_Page *page, MyDB_Page *before) {
+		if (before == head) {
+			pushFront (page);
+			return;
+		}
+		page->myList = this;
+		page->listNext = before;
+		page->listPrev = before->listPrev;
+		before->listPrev->listNext = page;
+		before->listPrev = page;
+		numPages++;
+	}
+
+	// unlinks the page from the list; the page must be in this list
+	void remove (MyDB_Page *page) {
+		if (page->listPrev != nullptr)
+			page->listPrev->listNext = page->listNext;
+		else
+			head = page->listNext;
+
+		if (page->listNext != nullptr)
+			page->listNext->listPrev = page->listPrev;
+		else
+			tail = page->listPrev;
+
+		page->listPrev = nullptr;
+		page->listNext = nullptr;
+		page->myList = nullptr;
+		numPages--;
+	}
+
+	// moves a page that is already in the list to the front
+	void moveToFront (MyDB_Page *page) {
+		if (head == page)
+			return;
+		remove (page);
+		pushFront (page);
+	}
+
+	// the pages at the two ends of the list; nullptr if the list is empty
+	MyDB_Page *front () {
+		return head;
+	}
+
+	MyDB_Page *back () {
+		return tail;
+	}
+
+	// walks the list from the front towards the back
+	MyDB_Page *next (MyDB_Page *page) {
+		return page->listNext;
+	}
+
+	// walks the list from the back towards the front
+	MyDB_Page *prev (MyDB_Page *page) {
+		return page->listPrev;
+	}
+
+	size_t size () {
+		return numPages;
+	}
+
+	bool empty () {
+		return numPages == 0;
+	}
+
+private:
+
+	// the most and least recently used pages
+	MyDB_Page *head;
+	MyDB_Page *tail;
+
+	// the number of pages in the list
+	size_t numPages;
+};
+
+#endif
+
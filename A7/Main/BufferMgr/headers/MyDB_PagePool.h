@@ -0,0 +1,62 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef PAGE_POOL_H
+#define PAGE_POOL_H
+
+#include <memory>
+#include <mutex>
+#include "MyDB_Page.h"
+#include "MyDB_Table.h"
+
+using namespace std;
+
+class MyDB_PagePool;
+typedef shared_ptr <MyDB_PagePool> MyDB_PagePoolPtr;
+
+// the page objects of a buffer manager... rather than allocating a new object for every page
+// that comes into existence (and freeing it once the page has no more references), the buffer
+// manager gets one from here, and it comes back here once its last MyDB_PagePtr goes away.
+// Up to maxFree unused objects are kept (chained through their listNext), so that a big scan
+// reuses the same few objects over and over.  The pool must outlive all of its page objects
+class MyDB_PagePool {
+
+public:
+
+	// a pool for the given buffer manager's pages, keeping up to maxFree unused page objects
+	MyDB_PagePool (MyDB_BufferManager &parent, size_t maxFree);
+
+	// deletes the unused page objects
+	~MyDB_PagePool ();
+
+	// returns a page object for the i^th page of the table (or for a temp page, if whichTable
+	// is a nullptr), reusing an unused one if there is one
+	MyDB_PagePtr get (MyDB_TablePtr whichTable, size_t i);
+
+	// takes back a page object that no longer has any references
+	void put (MyDB_Page *page);
+
+	// the number of unused page objects that are being kept
+	size_t getNumFree ();
+
+private:
+
+	MyDB_BufferManager &parent;
+
+	// protects everything below
+	mutex latch;
+
+	// the unused page objects, and how many there are
+	MyDB_Page *freePages;
+	size_t numFree;
+	size_t maxFree;
+};
+
+#endif
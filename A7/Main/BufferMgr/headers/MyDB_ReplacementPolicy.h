@@ -0,0 +1,79 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef REPLACEMENT_POLICY_H
+#define REPLACEMENT_POLICY_H
+
+#include <memory>
+#include "MyDB_Page.h"
+#include <string>
+#include <vector>
+
+using namespace std;
+class MyDB_ReplacementPolicy;
+typedef shared_ptr <MyDB_ReplacementPolicy> MyDB_ReplacementPolicyPtr;
+
+// a replacement policy decides which buffered page gets kicked out when the buffer
+// manager runs out of RAM.  The buffer manager tells the policy about every page that
+// holds RAM and is not pinned (these are the only pages that can be evicted), and
+// about every access to such a page.  All of the calls are made by the buffer manager
+class MyDB_ReplacementPolicy {
+
+public:
+
+	// called once by the buffer manager, so the policy can size its internal queues
+	virtual void setNumFrames (size_t numFrames) {}
+
+	// the page was just read into RAM (or was just given RAM, if it is a temp page)
+	// and is unpinned, so it can now be evicted
+	virtual void pageIn (MyDB_Page *page) = 0;
+
+	// a page that the policy already knows about was accessed again
+	virtual void pageAccessed (MyDB_Page *page) = 0;
+
+	// a pinned page that holds RAM was unpinned, so it can now be evicted... this
+	// also counts as an access to the page
+	virtual void pageUnpinned (MyDB_Page *page) = 0;
+
+	// the page is being pinned or destroyed, so it can no longer be evicted
+	virtual void remove (MyDB_Page *page) = 0;
+
+	// lists (up to) the next n pages that the policy would choose to evict, best victim
+	// first... this does not change anything, so it can be used to look ahead at the pages
+	// that are about to be evicted
+	virtual void getVictims (size_t n, vector <MyDB_Page *> &victims) = 0;
+
+	// the page (usually one of the first few returned by getVictims) is being evicted, so
+	// forget about it, updating the policy's state as if it had chosen the page itself
+	virtual void evict (MyDB_Page *page) = 0;
+
+	// choose the page to evict and forget about it; returns a nullptr if there
+	// are no pages that can be evicted
+	virtual MyDB_Page *pickVictim ();
+
+	// true if the page is one of the pages that can be evicted
+	virtual bool contains (MyDB_Page *page) = 0;
+
+	// the number of pages that can be evicted
+	virtual size_t size () = 0;
+
+	// makes a new, empty policy of the same kind and with the same settings... the
+	// buffer manager uses this to give each of its shards a policy of its own
+	virtual MyDB_ReplacementPolicyPtr clone () = 0;
+
+	virtual ~MyDB_ReplacementPolicy () {}
+
+	// builds one of the policies by name: "lru", "clock", "lru2" (LRU-K with K = 2),
+	// or "2q"... returns a nullptr if the name is not recognized
+	static MyDB_ReplacementPolicyPtr makePolicy (string name);
+};
+
+#endif
+
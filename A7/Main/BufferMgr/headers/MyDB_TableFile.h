@@ -0,0 +1,93 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef TABLE_FILE_H
+#define TABLE_FILE_H
+
+#include <atomic>
+#include <memory>
+#include <string>
+
+using namespace std;
+
+class MyDB_FileCache;
+class MyDB_TableFile;
+typedef shared_ptr <MyDB_TableFile> MyDB_TableFilePtr;
+
+// the number of users of a file while it is closed
+#define CLOSED_FILE -1
+
+// the file that a table is stored in, as seen by a buffer manager... each page of the table
+// holds on to it, so that reading or writing the page never has to look the file up.  The file
+// cache that it belongs to may close it when too many files are open, in which case it is
+// opened again the next time that someone uses it; but a file is only closed while nobody is
+// using it, so the descriptor returned by use () is good until the matching done ().  All of
+// the I/O on it is positioned (pread, pwrite and friends), so any number of threads can use
+// the descriptor at once
+class MyDB_TableFile {
+
+public:
+
+	// gets the descriptor, opening the file again if it was closed, and keeps it open until
+	// done () is called... returns -1 (in which case done () is not called) if the table has
+	// been killed, or the file could not be opened
+	int use ();
+	void done ();
+
+	// where the file is
+	string &getPath ();
+
+	// the file at the given path, which belongs to the given cache; it starts out closed
+	MyDB_TableFile (string path, MyDB_FileCache &cache);
+
+private:
+
+	friend class MyDB_FileCache;
+
+	string path;
+	MyDB_FileCache &cache;
+
+	// the descriptor... it is only changed by the cache, while the file is closed
+	int fd;
+
+	// the number of threads using the descriptor, or CLOSED_FILE... the cache closes a file
+	// by swapping a zero here for CLOSED_FILE, and a thread only starts using a file by bumping
+	// a count that is not CLOSED_FILE, so the two can never cross
+	atomic <long> users;
+
+	// when the file was last used, on the cache's clock
+	atomic <long> lastUse;
+
+	// set once the table is killed, after which the file is never opened again... this is
+	// protected by the cache's latch
+	bool killed;
+};
+
+// keeps a table file open while it is around
+class MyDB_FileUse {
+
+public:
+
+	// starts using the file, which may be a nullptr
+	MyDB_FileUse (MyDB_TableFile *file);
+
+	// and stops
+	~MyDB_FileUse ();
+
+	// the descriptor, or -1 if there is no file or its table has been killed
+	int getFD ();
+
+private:
+
+	MyDB_TableFile *file;
+	int fd;
+};
+
+#endif
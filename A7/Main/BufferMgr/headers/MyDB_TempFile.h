@@ -0,0 +1,93 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef TEMP_FILE_H
+#define TEMP_FILE_H
+
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <set>
+#include <string>
+#include <sys/types.h>
+#include <vector>
+
+using namespace std;
+
+class MyDB_TempFile;
+typedef shared_ptr <MyDB_TempFile> MyDB_TempFilePtr;
+
+// the file that a group of temp pages are written to... it is striped over one or more
+// files (page i goes into file i % n), which can be put in different directories so that
+// spilled pages are spread over several disks.  Every temp page holds on to its file, and
+// the files are deleted when the last page goes away.  The space of a dead page is given
+// back to the file system right away: if it is at the end of the file, the file is cut
+// short, and otherwise a hole is punched where it was (if it was ever written)
+class MyDB_TempFile {
+
+public:
+
+	// gets a position in the file for a new page, opening the file if it is not open yet
+	size_t allocate ();
+
+	// gives back the position of a dead page... wasWritten says if the page was ever
+	// written to the file, in which case there is space to give back
+	void free (size_t pos, bool wasWritten);
+
+	// where page pos is stored
+	int getFD (size_t pos);
+	off_t getOffset (size_t pos);
+
+	// the number of pages that the file spans (including the holes in it)
+	size_t getNumPages ();
+
+	// turns O_DIRECT on or off for the file
+	void setDirectIO (bool direct);
+
+	// a file striped over the given paths (which are created when the first page is
+	// allocated); numFilePages is kept up to date with the number of pages that the file
+	// spans, so that the buffer manager can add up the size of all of its temp files
+	MyDB_TempFile (vector <string> paths, size_t pageSize, bool directIO, atomic <long> &numFilePages);
+
+	// closes and deletes the files
+	~MyDB_TempFile ();
+
+private:
+
+	// opens all of the files
+	void open ();
+
+	// cuts the files down to lastPos pages
+	void truncate ();
+
+	// protects everything below
+	mutex latch;
+
+	// the files, and their FDs (empty until they are opened)
+	vector <string> paths;
+	vector <int> fds;
+
+	size_t pageSize;
+	bool directIO;
+
+	// the positions below lastPos that no page is using right now
+	set <size_t> freePositions;
+
+	// the number of pages that the file spans
+	size_t lastPos;
+
+	// false once the file system has told us that it can't punch holes
+	bool canPunch;
+
+	// the buffer manager's count of the pages spanned by all temp files
+	atomic <long> &numFilePages;
+};
+
+#endif
@@ -0,0 +1,54 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef TEMP_SEGMENT_H
+#define TEMP_SEGMENT_H
+
+#include <memory>
+#include "MyDB_TempFile.h"
+
+using namespace std;
+
+// forward definition to handle circular dependencies
+class MyDB_BufferManager;
+class MyDB_TempSegment;
+typedef shared_ptr <MyDB_TempSegment> MyDB_TempSegmentPtr;
+
+// a temp file of its own for the temp pages of one query... while the segment is active,
+// every temp page that the buffer manager hands out is put into it, rather than into the
+// buffer manager's shared temp file.  When the query is done, the segment is ended, and its
+// file is deleted as a whole once the last of its pages is gone, so that a big sort or join
+// does not leave the shared temp file big and full of holes
+class MyDB_TempSegment {
+
+public:
+
+	// the number of pages that the segment's file spans
+	size_t getNumPages ();
+
+	// from now on, temp pages go back into the shared temp file
+	void end ();
+
+	// a segment that stores its pages in file
+	MyDB_TempSegment (MyDB_BufferManager &parent, MyDB_TempFilePtr file);
+
+	// ends the segment
+	~MyDB_TempSegment ();
+
+private:
+
+	// the buffer manager that the segment came from
+	MyDB_BufferManager &parent;
+
+	// the segment's file; a nullptr once the segment is ended
+	MyDB_TempFilePtr file;
+};
+
+#endif
@@ -0,0 +1,66 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef TWOQ_POLICY_H
+#define TWOQ_POLICY_H
+
+#include <deque>
+#include "MyDB_PageList.h"
+#include "MyDB_ReplacementPolicy.h"
+#include "PageHash.h"
+#include <unordered_map>
+
+// the full 2Q policy (Johnson and Shasha)... pages come in through a small FIFO queue (A1in).
+// The identities of pages that fall out of A1in are remembered in a ghost queue (A1out), and
+// only a page that is accessed again while it is in A1out is admitted into the main LRU queue
+// (Am).  A big scan therefore streams through A1in and never disturbs the hot pages in Am.
+// All operations are O(1)
+class MyDB_TwoQPolicy : public MyDB_ReplacementPolicy {
+
+public:
+
+	MyDB_TwoQPolicy ();
+
+	void setNumFrames (size_t numFrames) override;
+	void pageIn (MyDB_Page *page) override;
+	void pageAccessed (MyDB_Page *page) override;
+	void pageUnpinned (MyDB_Page *page) override;
+	void remove (MyDB_Page *page) override;
+	void getVictims (size_t n, vector <MyDB_Page *> &victims) override;
+	void evict (MyDB_Page *page) override;
+	bool contains (MyDB_Page *page) override;
+	size_t size () override;
+	MyDB_ReplacementPolicyPtr clone () override;
+
+private:
+
+	// the FIFO of pages that have been seen once, and the LRU list of hot pages
+	MyDB_PageList a1in;
+	MyDB_PageList am;
+
+	// the ghost queue: pages that were recently evicted from A1in... each is mapped
+	// to a sequence number, so that stale entries in the FIFO can be recognized
+	unordered_map <MyDB_PageKey, long, PageHash, PageEqual> a1out;
+	deque <pair <MyDB_PageKey, long>> a1outOrder;
+	long nextSeqNum;
+
+	// the target size of A1in and the maximum size of A1out
+	size_t kIn;
+	size_t kOut;
+
+	// puts a page that is not currently in either queue into the right one
+	void admit (MyDB_Page *page);
+
+	// remembers that the page was evicted from A1in
+	void rememberGhost (MyDB_Page *page);
+};
+
+#endif
+
@@ -0,0 +1,61 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+
+#ifndef PAGE_HASH_H
+#define PAGE_HASH_H
+
+#include <functional>
+#include "MyDB_Table.h"
+#include <string>
+#include <utility>
+
+// identifies a page of a table; two table objects with the same name refer
+// to the same file, so pages are matched up using the table name
+typedef pair <MyDB_TablePtr, size_t> MyDB_PageKey;
+
+// so that pages can be put into an unordered_map
+struct PageHash {
+
+public:
+
+	size_t operator() (const MyDB_PageKey &key) const {
+
+		// deal with the null case
+		size_t tableHash = 0;
+		if (key.first != nullptr)
+			tableHash = hash <string> () (key.first->getName ());
+
+		// mix in the page number
+		return tableHash ^ (key.second + 0x9e3779b97f4a7c15ULL + (tableHash << 6) + (tableHash >> 2));
+	}
+};
+
+// and so that they can be compared for equality
+struct PageEqual {
+
+public:
+
+	bool operator() (const MyDB_PageKey &lhs, const MyDB_PageKey &rhs) const {
+
+		if (lhs.second != rhs.second)
+			return false;
+
+		// deal with the null case
+		if (lhs.first == nullptr || rhs.first == nullptr)
+			return lhs.first == rhs.first;
+
+		// otherwise, just compare the strings
+		return lhs.first == rhs.first || lhs.first->getName () == rhs.first->getName ();
+	}
+};
+
+#endif
+
@@ -0,0 +1,249 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef BATCH_READER_C
+#define BATCH_READER_C
+
+#include <cerrno>
+#include <cstdlib>
+#include <cstring>
+#include <iostream>
+#include <linux/io_uring.h>
+#include "MyDB_BatchReader.h"
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+// the most reads that are in the ring at once
+#define RING_ENTRIES 64
+
+// finishes a read that got done bytes in, stopping at the end of the file (or at an error)
+static void readRest (MyDB_ReadRequest &request, size_t done) {
+	while (done < request.numBytes) {
+		ssize_t numRead = pread (request.fd, ((char *) request.bytes) + done, request.numBytes - done, request.offset + done);
+		if (numRead < 0 && errno == EINTR)
+			continue;
+		if (numRead <= 0)
+			return;
+		done += numRead;
+	}
+}
+
+MyDB_BatchReader :: MyDB_BatchReader (size_t numThreadsIn) {
+	isSetUp = false;
+	ringFD = -1;
+	sqMapping = MAP_FAILED;
+	cqMapping = MAP_FAILED;
+	sqes = (io_uring_sqe *) MAP_FAILED;
+	numThreads = numThreadsIn;
+	jobs = nullptr;
+	nextJob = 0;
+	numJobsDone = 0;
+	stopWorkers = false;
+}
+
+MyDB_BatchReader :: ~MyDB_BatchReader () {
+
+	{
+		lock_guard <mutex> guard (jobLatch);
+		stopWorkers = true;
+	}
+	jobReady.notify_all ();
+	for (thread &worker : workers)
+		worker.join ();
+
+	if (sqes != MAP_FAILED)
+		munmap (sqes, sqesSize);
+	if (cqMapping != MAP_FAILED && cqMapping != sqMapping)
+		munmap (cqMapping, cqMappingSize);
+	if (sqMapping != MAP_FAILED)
+		munmap (sqMapping, sqMappingSize);
+	if (ringFD >= 0)
+		close (ringFD);
+}
+
+bool MyDB_BatchReader :: usingRing () {
+	lock_guard <mutex> guard (latch);
+	setUp ();
+	return ringFD >= 0;
+}
+
+void MyDB_BatchReader :: setUp () {
+
+	if (isSetUp)
+		return;
+	isSetUp = true;
+
+	// the kernel may not have io_uring, or it may not let us use it
+	io_uring_params params;
+	memset (&params, 0, sizeof (params));
+	ringFD = syscall (__NR_io_uring_setup, RING_ENTRIES, &params);
+	if (ringFD < 0)
+		return;
+
+	// map the submission queue, the completion queue (which newer kernels put in the same
+	// mapping), and the array of submission entries
+	sqMappingSize = params.sq_off.array + params.sq_entries * sizeof (unsigned);
+	cqMappingSize = params.cq_off.cqes + params.cq_entries * sizeof (io_uring_cqe);
+	bool oneMapping = (params.features & IORING_FEAT_SINGLE_MMAP) != 0;
+	if (oneMapping && cqMappingSize > sqMappingSize)
+		sqMappingSize = cqMappingSize;
+	sqMapping = mmap (nullptr, sqMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFD, IORING_OFF_SQ_RING);
+	if (sqMapping != MAP_FAILED)
+		cqMapping = oneMapping ? sqMapping :
+			mmap (nullptr, cqMappingSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFD, IORING_OFF_CQ_RING);
+	sqesSize = params.sq_entries * sizeof (io_uring_sqe);
+	if (cqMapping != MAP_FAILED)
+		sqes = (io_uring_sqe *) mmap (nullptr, sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ringFD, IORING_OFF_SQES);
+
+	// if any of that did not work, we use the threads
+	if (sqes == MAP_FAILED) {
+		if (cqMapping != MAP_FAILED && cqMapping != sqMapping)
+			munmap (cqMapping, cqMappingSize);
+		if (sqMapping != MAP_FAILED)
+			munmap (sqMapping, sqMappingSize);
+		sqMapping = cqMapping = MAP_FAILED;
+		close (ringFD);
+		ringFD = -1;
+		return;
+	}
+
+	char *sq = (char *) sqMapping;
+	sqTail = (unsigned *) (sq + params.sq_off.tail);
+	sqMask = (unsigned *) (sq + params.sq_off.ring_mask);
+	sqArray = (unsigned *) (sq + params.sq_off.array);
+	numEntries = params.sq_entries;
+	char *cq = (char *) cqMapping;
+	cqHead = (unsigned *) (cq + params.cq_off.head);
+	cqTail = (unsigned *) (cq + params.cq_off.tail);
+	cqMask = (unsigned *) (cq + params.cq_off.ring_mask);
+	cqes = (io_uring_cqe *) (cq + params.cq_off.cqes);
+}
+
+void MyDB_BatchReader :: read (vector <MyDB_ReadRequest> &requests) {
+
+	if (requests.empty ())
+		return;
+
+	lock_guard <mutex> guard (latch);
+	setUp ();
+	if (ringFD >= 0)
+		readWithRing (requests);
+	else
+		readWithThreads (requests);
+}
+
+void MyDB_BatchReader :: readWithRing (vector <MyDB_ReadRequest> &requests) {
+
+	size_t numQueued = 0;
+	size_t numDone = 0;
+	unsigned numInRing = 0;
+	unsigned numToSubmit = 0;
+	while (numDone < requests.size ()) {
+
+		// fill up the ring... we are the only ones who write to the tail of the submission queue
+		unsigned tail = *sqTail;
+		while (numQueued < requests.size () && numInRing < numEntries) {
+			MyDB_ReadRequest &request = requests[numQueued];
+			unsigned index = tail & *sqMask;
+			io_uring_sqe *sqe = &sqes[index];
+			memset (sqe, 0, sizeof (*sqe));
+			sqe->opcode = IORING_OP_READ;
+			sqe->fd = request.fd;
+			sqe->addr = (unsigned long) request.bytes;
+			sqe->len = request.numBytes;
+			sqe->off = request.offset;
+			sqe->user_data = numQueued;
+			sqArray[index] = index;
+			tail++;
+			numQueued++;
+			numInRing++;
+			numToSubmit++;
+		}
+		__atomic_store_n (sqTail, tail, __ATOMIC_RELEASE);
+
+		// hand the new reads to the kernel, and wait for at least one read to finish
+		int numSubmitted = syscall (__NR_io_uring_enter, ringFD, numToSubmit, 1, IORING_ENTER_GETEVENTS, nullptr, 0);
+		if (numSubmitted < 0) {
+			if (errno != EINTR && errno != EAGAIN && errno != EBUSY) {
+				cout << "io_uring_enter failed: " << strerror (errno) << "\n";
+				exit (1);
+			}
+		} else {
+			numToSubmit -= numSubmitted;
+		}
+
+		// and collect the reads that are done
+		unsigned head = *cqHead;
+		unsigned cqEnd = __atomic_load_n (cqTail, __ATOMIC_ACQUIRE);
+		for (; head != cqEnd; head++) {
+			io_uring_cqe *cqe = &cqes[head & *cqMask];
+			MyDB_ReadRequest &request = requests[cqe->user_data];
+
+			// a short read (or a kernel that can't do IORING_OP_READ) is finished the slow way
+			if (cqe->res < 0 || (size_t) cqe->res < request.numBytes)
+				readRest (request, cqe->res < 0 ? 0 : cqe->res);
+			numInRing--;
+			numDone++;
+		}
+		__atomic_store_n (cqHead, head, __ATOMIC_RELEASE);
+	}
+}
+
+void MyDB_BatchReader :: readWithThreads (vector <MyDB_ReadRequest> &requests) {
+
+	unique_lock <mutex> lock (jobLatch);
+
+	// the threads are started the first time that they are needed
+	while (workers.size () < numThreads)
+		workers.push_back (thread (&MyDB_BatchReader :: workerLoop, this));
+
+	jobs = &requests;
+	nextJob = 0;
+	numJobsDone = 0;
+	jobReady.notify_all ();
+
+	// we help out, and then wait for the reads that the threads are still doing
+	while (doNextRead (lock));
+	jobDone.wait (lock, [&] {
+		return numJobsDone == requests.size ();
+	});
+	jobs = nullptr;
+}
+
+bool MyDB_BatchReader :: doNextRead (unique_lock <mutex> &lock) {
+
+	if (jobs == nullptr || nextJob == jobs->size ())
+		return false;
+
+	vector <MyDB_ReadRequest> &batch = *jobs;
+	MyDB_ReadRequest &request = batch[nextJob++];
+	lock.unlock ();
+	readRest (request, 0);
+	lock.lock ();
+	if (++numJobsDone == batch.size ())
+		jobDone.notify_all ();
+	return true;
+}
+
+void MyDB_BatchReader :: workerLoop () {
+
+	unique_lock <mutex> lock (jobLatch);
+	while (true) {
+		jobReady.wait (lock, [&] {
+			return stopWorkers || (jobs != nullptr && nextJob < jobs->size ());
+		});
+		if (stopWorkers)
+			return;
+		doNextRead (lock);
+	}
+}
+
+#endif
@@ -14,9 +14,19 @@
 #define BUFFER_MGR_C
 
 #include <fcntl.h>
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <cstring>
+#include <fstream>
 #include <iostream>
+#include <limits.h>
 #include "MyDB_BufferManager.h"
+#include "MyDB_HintedPolicy.h"
+#include "MyDB_LRUPolicy.h"
 #include "MyDB_Page.h"
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include <sys/types.h>
 #include <sys/uio.h>
 #include <unistd.h>
@@ -24,67 +34,585 @@
 
 using namespace std;
 
+// when the number of shards is picked automatically, there is one shard for every
+// this many pages, up to MAX_SHARDS shards
+#define PAGES_PER_SHARD 256
+#define MAX_SHARDS 64
+
+// the most sub-pools that there can be (including the default one)
+#define MAX_SUB_POOLS 16
+
+// when a page is kicked out, we look this far down the list of victims for a clean page
+#define CLEAN_VICTIM_WINDOW 16
+
+// one out of this many frames is never granted (see getNumGrantableFrames)
+#define UNGRANTED_FRACTION 16
+
+// the size of a huge page, and the alignment needed for O_DIRECT
+#define HUGE_PAGE_SIZE (2 * 1024 * 1024)
+#define DIRECT_IO_ALIGNMENT 4096
+
+// the size of an OS page; RAM can only be given back to the OS in these units
+#define OS_PAGE_SIZE 4096
+
+// the most pages that are read with one preadv when preloading
+#define PRELOAD_RUN_PAGES 64
+
+// getPages reads at most this fraction of the pool at once
+#define MAX_BATCH_FRACTION 4
+
+// the number of threads that do the reads of a batch if there is no io_uring
+#define BATCH_READ_THREADS 8
+
 size_t MyDB_BufferManager :: getPageSize () {
 	return pageSize;
 }
 
-MyDB_PageHandle MyDB_BufferManager :: getPage (MyDB_TablePtr whichTable, long i) {
-		
-	// open the file, if it is not open
-	if (fds.count (whichTable) == 0) {
-		int fd = open (whichTable->getStorageLoc ().c_str (), O_CREAT | O_RDWR, 0666);
-		fds[whichTable] = fd;
+size_t MyDB_BufferManager :: pickShard (MyDB_TablePtr whichTable, size_t pos) {
+	MyDB_SubPool &pool = *subPools[pickSubPool (whichTable)];
+	if (pool.numShards == 1)
+		return pool.firstShard;
+	return pool.firstShard + PageHash () (make_pair (whichTable, pos)) % pool.numShards;
+}
+
+size_t MyDB_BufferManager :: pickSubPool (MyDB_TablePtr whichTable) {
+
+	// almost always, there is just the default sub-pool
+	if (numSubPools == 1)
+		return 0;
+
+	if (whichTable == nullptr)
+		return tempPool;
+
+	pthread_rwlock_rdlock (&poolLatch);
+	auto found = tablePools.find (whichTable->getName ());
+	size_t result = (found == tablePools.end () ? 0 : found->second);
+	pthread_rwlock_unlock (&poolLatch);
+	return result;
+}
+
+MyDB_BufferShard &MyDB_BufferManager :: lockShard (MyDB_TablePtr whichTable, size_t pos, unique_lock <mutex> &lock) {
+	while (true) {
+		size_t which = pickShard (whichTable, pos);
+		lock = unique_lock <mutex> (shards[which]->latch);
+
+		// a table can only be moved once there are other sub-pools
+		if (numSubPools == 1 || pickShard (whichTable, pos) == which)
+			return *shards[which];
+		lock.unlock ();
+	}
+}
+
+MyDB_BufferShard &MyDB_BufferManager :: lockShard (MyDB_Page *page, unique_lock <mutex> &lock) {
+	while (true) {
+		size_t which = page->shard;
+		lock = unique_lock <mutex> (shards[which]->latch);
+		if (page->shard == which)
+			return *shards[which];
+		lock.unlock ();
 	}
+}
 
+size_t MyDB_BufferManager :: findSubPool (string poolName) {
+	for (size_t i = 0; i < numSubPools; i++) {
+		if (subPools[i]->name == poolName)
+			return i;
+	}
+	return numSubPools;
+}
+
+void MyDB_BufferManager :: sizePolicies (MyDB_SubPool &pool) {
+	size_t framesPerShard = (pool.quota != 0 && pool.quota < numPages ? pool.quota : numPages) / pool.numShards;
+	if (framesPerShard < 1)
+		framesPerShard = 1;
+	for (size_t i = pool.firstShard; i < pool.firstShard + pool.numShards; i++) {
+		lock_guard <mutex> guard (shards[i]->latch);
+		shards[i]->policy->setNumFrames (framesPerShard);
+	}
+}
+
+void MyDB_BufferManager :: addSubPool (string poolName, size_t quota, size_t numShardsIn) {
+
+	if (numShardsIn > MAX_SHARDS)
+		numShardsIn = MAX_SHARDS;
+	if (numShardsIn < 1)
+		numShardsIn = 1;
+
+	MyDB_SubPoolPtr pool = make_shared <MyDB_SubPool> ();
+	pool->name = poolName;
+	pool->quota = quota;
+	pool->numFrames = 0;
+	pool->firstShard = numShards;
+	pool->numShards = numShardsIn;
+	pool->nextVictimShard = 0;
+
+	// each shard gets its own copy of the policy that decides who gets evicted
+	for (size_t i = pool->firstShard; i < pool->firstShard + pool->numShards; i++) {
+		shards[i] = make_shared <MyDB_BufferShard> ();
+		shards[i]->policy = (i == 0 ? policyPrototype : policyPrototype->clone ());
+		shards[i]->pool = pool.get ();
+	}
+
+	// and now other threads can see it
+	subPools[numSubPools] = pool;
+	numShards += numShardsIn;
+	numSubPools++;
+	sizePolicies (*pool);
+}
+
+void MyDB_BufferManager :: setSubPool (string poolName, size_t quota) {
+
+	lock_guard <mutex> guard (resizeLatch);
+	size_t which = findSubPool (poolName);
+	if (which < numSubPools) {
+		subPools[which]->quota = quota;
+		sizePolicies (*subPools[which]);
+		trimSubPool (*subPools[which]);
+	} else if (numSubPools == MAX_SUB_POOLS) {
+		cout << "Can't have more than " << MAX_SUB_POOLS << " buffer sub-pools.\n";
+	} else {
+		addSubPool (poolName, quota, quota / PAGES_PER_SHARD);
+	}
+}
+
+bool MyDB_BufferManager :: useSubPool (MyDB_TablePtr whichTable, string poolName) {
+
+	lock_guard <mutex> guard (resizeLatch);
+	size_t which = findSubPool (poolName);
+	if (which == numSubPools) {
+		cout << "There is no buffer sub-pool named " << poolName << ".\n";
+		return false;
+	}
+
+	// pages that already exist keep the sub-pool that they were created in, which is fine,
+	// since nobody looks temp pages up
+	if (whichTable == nullptr) {
+		tempPool = which;
+		return true;
+	}
+
+	// nobody can look up one of the table's pages while we are moving them; the latches are
+	// always taken in the same order
+	vector <unique_lock <mutex>> latches;
+	for (size_t i = 0; i < numShards; i++)
+		latches.push_back (unique_lock <mutex> (shards[i]->latch));
+
+	pthread_rwlock_wrlock (&poolLatch);
+	if (which == 0)
+		tablePools.erase (whichTable->getName ());
+	else
+		tablePools[whichTable->getName ()] = which;
+	pthread_rwlock_unlock (&poolLatch);
+
+	// take the table's pages out of their old shards...
+	vector <pair <MyDB_PagePtr, bool>> moving;
+	for (size_t i = 0; i < numShards; i++) {
+		MyDB_BufferShard &shard = *shards[i];
+		for (auto page = shard.allPages.begin (); page != shard.allPages.end ();) {
+			MyDB_Page *cur = page->second.get ();
+			if (cur->myTable->getName () != whichTable->getName ()) {
+				page++;
+				continue;
+			}
+			bool evictable = shard.policy->contains (cur);
+			if (evictable)
+				shard.policy->remove (cur);
+			if (cur->bytes != nullptr)
+				shard.pool->numFrames--;
+			moving.push_back (make_pair (page->second, evictable));
+			page = shard.allPages.erase (page);
+		}
+	}
+
+	// and put them into their new ones
+	for (auto &page : moving) {
+		MyDB_Page *cur = page.first.get ();
+		cur->shard = pickShard (cur->myTable, cur->pos);
+		MyDB_BufferShard &shard = *shards[cur->shard];
+		shard.allPages.emplace (make_pair (cur->myTable, cur->pos), page.first);
+		if (cur->bytes != nullptr)
+			shard.pool->numFrames++;
+		if (page.second)
+			shard.policy->pageIn (cur);
+	}
+
+	// the sub-pool may now be over its quota
+	latches.clear ();
+	trimSubPool (*subPools[which]);
+	return true;
+}
+
+void MyDB_BufferManager :: trimSubPool (MyDB_SubPool &pool) {
+	while (pool.quota != 0 && (size_t) pool.numFrames > pool.quota) {
+		void *frame = nullptr;
+		for (size_t i = 0; frame == nullptr && i < pool.numShards; i++)
+			frame = kickOutPage (*shards[pool.firstShard + pool.nextVictimShard++ % pool.numShards]);
+
+		// everything else is pinned
+		if (frame == nullptr)
+			return;
+		availableRam->push (frame);
+	}
+}
+
+size_t MyDB_BufferManager :: setNumPages (size_t numPagesIn) {
+
+	lock_guard <mutex> guard (resizeLatch);
+	if (numPagesIn > maxPages) {
+		cout << "The buffer can't grow past " << maxPages << " pages.\n";
+		numPagesIn = maxPages;
+	}
+	if (numPagesIn < 1)
+		numPagesIn = 1;
+
+	// to grow, we first take back the frames that were given back to the OS, and then use new ones
+	while (numPages < numPagesIn) {
+		void *frame;
+		if (!retiredFrames.empty ()) {
+			frame = retiredFrames.back ();
+			retiredFrames.pop_back ();
+		} else {
+			frame = ((char *) ram) + numFramesCarved++ * pageSize;
+		}
+		availableRam->push (frame);
+		numPages++;
+	}
+
+	// to shrink, we take frames out of use, kicking pages out if need be
+	while (numPages > numPagesIn) {
+		void *frame = availableRam->pop ();
+		for (size_t i = 0; frame == nullptr && i < numShards; i++)
+			frame = kickOutPage (*shards[nextVictimShard++ % numShards]);
+
+		// everything else is pinned
+		if (frame == nullptr)
+			break;
+
+		// the OS can only take back whole pages of RAM
+		if (pageSize % OS_PAGE_SIZE == 0)
+			madvise (frame, pageSize, MADV_DONTNEED);
+		retiredFrames.push_back (frame);
+		numPages--;
+	}
+
+	for (size_t i = 0; i < numSubPools; i++)
+		sizePolicies (*subPools[i]);
+	return numPages;
+}
+
+size_t MyDB_BufferManager :: getNumPages () {
+	return numPages;
+}
+
+MyDB_BufferCounters *MyDB_BufferManager :: getCounters (MyDB_TablePtr whichTable) {
+	if (whichTable == nullptr)
+		return tempCounters.get ();
+
+	lock_guard <mutex> guard (statsLatch);
+	MyDB_BufferCountersPtr &counters = tableCounters[whichTable->getName ()];
+	if (counters == nullptr)
+		counters = make_shared <MyDB_BufferCounters> ();
+	return counters.get ();
+}
+
+// the number of nanoseconds since the given time
+static long nanosSince (chrono :: steady_clock :: time_point start) {
+	return chrono :: duration_cast <chrono :: nanoseconds> (chrono :: steady_clock :: now () - start).count ();
+}
+
+// reads numBytes bytes at the given offset, picking up where it left off after a short read or
+// a signal (with O_DIRECT, a short read still ends on a block boundary, so the rest can be asked
+// for the same way).  A read that runs off of the end of the file stops there, since that part
+// of the page was never written
+static void readFully (int fd, void *bytes, size_t numBytes, off_t offset) {
+	size_t done = 0;
+	while (done < numBytes) {
+		ssize_t numRead = pread (fd, ((char *) bytes) + done, numBytes - done, offset + done);
+		if (numRead < 0 && errno == EINTR)
+			continue;
+		if (numRead < 0)
+			cout << "Can't read a page: " << strerror (errno) << "\n";
+		if (numRead <= 0)
+			return;
+		done += numRead;
+	}
+}
+
+// like the above, for a write... the whole page has to make it to the file
+static void writeFully (int fd, void *bytes, size_t numBytes, off_t offset) {
+	size_t done = 0;
+	while (done < numBytes) {
+		ssize_t numWritten = pwrite (fd, ((char *) bytes) + done, numBytes - done, offset + done);
+		if (numWritten < 0 && errno == EINTR)
+			continue;
+		if (numWritten <= 0) {
+			cout << "Can't write a page: " << (numWritten < 0 ? strerror (errno) : "nothing was written") << "\n";
+			return;
+		}
+		done += numWritten;
+	}
+}
+
+void MyDB_BufferManager :: readPage (MyDB_Page *page) {
+
+	// a temp page's file can't go away while the page is around
+	if (page->tempFile != nullptr) {
+		auto start = chrono :: steady_clock :: now ();
+		readFully (page->tempFile->getFD (page->pos), page->bytes, pageSize, page->tempFile->getOffset (page->pos));
+		MyDB_BufferCounters :: countLatency (page->counters->readLatency, nanosSince (start));
+		MyDB_BufferCounters :: count (page->counters->reads);
+		return;
+	}
+
+	// the page may have been kept in compressed form when it was kicked out
+	if (compressedCache->get (make_pair (page->myTable, page->pos), page->bytes)) {
+		MyDB_BufferCounters :: count (page->counters->unpacks);
+		return;
+	}
+
+	// several threads can be reading the same file, so we use pread rather than lseek + read
+	MyDB_FileUse file (page->file.get ());
+	if (file.getFD () >= 0) {
+		auto start = chrono :: steady_clock :: now ();
+		readFully (file.getFD (), page->bytes, pageSize, page->pos * pageSize);
+		MyDB_BufferCounters :: countLatency (page->counters->readLatency, nanosSince (start));
+		MyDB_BufferCounters :: count (page->counters->reads);
+	} else {
+		cout << "Trying to read a page from a file that does not exist.\n";
+	}
+}
+
+void MyDB_BufferManager :: writePage (MyDB_Page *page) {
+
+	if (page->tempFile != nullptr) {
+		auto start = chrono :: steady_clock :: now ();
+		writeFully (page->tempFile->getFD (page->pos), page->bytes, pageSize, page->tempFile->getOffset (page->pos));
+		MyDB_BufferCounters :: countLatency (page->counters->writeLatency, nanosSince (start));
+		MyDB_BufferCounters :: count (page->counters->writes);
+		page->wasWritten = true;
+		return;
+	}
+
+	// the table may have been killed, in which case nothing gets written
+	MyDB_FileUse file (page->file.get ());
+	if (file.getFD () >= 0) {
+		auto start = chrono :: steady_clock :: now ();
+		writeFully (file.getFD (), page->bytes, pageSize, page->pos * pageSize);
+		MyDB_BufferCounters :: countLatency (page->counters->writeLatency, nanosSince (start));
+		MyDB_BufferCounters :: count (page->counters->writes);
+	}
+}
+
+MyDB_PageHandle MyDB_BufferManager :: getPage (MyDB_TablePtr whichTable, long i) {
+	return getPage (whichTable, i, NormalAccess);
+}
+
+MyDB_PageHandle MyDB_BufferManager :: getPage (MyDB_TablePtr whichTable, long i, MyDB_AccessHint hint) {
+		
 	// make sure we don't have a null table
 	if (whichTable == nullptr) {
 		cout << "Can't allocate a page with a null table!!\n";
 		exit (1);
 	}
-	
-	// next, see if the page is already in existence
-	pair <MyDB_TablePtr, long> whichPage = make_pair (whichTable, i);
-	if (allPages.count (whichPage) == 0) {
+
+	// the pages of read-only tables don't go through the pool at all
+	if (numMappedFiles > 0) {
+		MyDB_PageHandle mapped = getMappedPage (whichTable, i);
+		if (mapped != nullptr)
+			return mapped;
+	}
+
+	// next, see if the page is already in existence... note that the handle is created
+	// while we hold the latch, so the page can't be killed out from under us
+	unique_lock <mutex> guard;
+	MyDB_BufferShard &shard = lockShard (whichTable, i, guard);
+
+	MyDB_PageKey whichPage = make_pair (whichTable, (size_t) i);
+	auto found = shard.allPages.find (whichPage);
+	if (found == shard.allPages.end ()) {
 
 		// it is not there, so create a page
-		MyDB_PagePtr returnVal = make_shared <MyDB_Page> (whichTable, i, *this);
-		allPages [whichPage] = returnVal;
-		return make_shared <MyDB_PageHandleBase> (returnVal);
+		MyDB_PagePtr returnVal = pagePool->get (whichTable, i);
+		returnVal->hint = hint;
+		shard.allPages.emplace (whichPage, returnVal);
+		return MyDB_PageHandle (returnVal);
 	}
 
 	// it is there, so return it
-	return make_shared <MyDB_PageHandleBase> (allPages [whichPage]);
+	applyHint (found->second.get (), hint, false);
+	return MyDB_PageHandle (found->second);
+}
+
+MyDB_PageHandle MyDB_BufferManager :: getMappedPage (MyDB_TablePtr whichTable, long i) {
+
+	// a table that just happens to have the same name as a read-only table (such as the output
+	// of a query) is not mapped, and must not get pages that point into the read-only file
+	pthread_rwlock_rdlock (&mapLatch);
+	auto found = mappedFiles.find (whichTable);
+	if (found == mappedFiles.end () || i < 0 || (size_t) i >= found->second.second ||
+		found->first->getStorageLoc () != whichTable->getStorageLoc ()) {
+		pthread_rwlock_unlock (&mapLatch);
+		return nullptr;
+	}
+
+	// the page is never shared with other handles, since it has no state of its own
+	MyDB_PagePtr page = pagePool->get (whichTable, i);
+	page->mappedFile = found->second.first;
+	page->bytes = ((char *) found->second.first.get ()) + i * pageSize;
+	page->numBytes = pageSize;
+	pthread_rwlock_unlock (&mapLatch);
+
+	return MyDB_PageHandle (page);
+}
+
+void MyDB_BufferManager :: setReadOnly (MyDB_TablePtr whichTable, bool readOnly) {
+
+	if (whichTable == nullptr)
+		return;
+
+	// the file needs to have everything that was written to the table
+	MyDB_TableFilePtr tableFile;
+	if (readOnly) {
+		flushTable (whichTable);
+		tableFile = fileCache->getFile (whichTable);
+	}
+
+	pthread_rwlock_wrlock (&mapLatch);
+	mappedFiles.erase (whichTable);
+	MyDB_FileUse file (tableFile.get ());
+	struct stat fileInfo;
+	if (readOnly && file.getFD () >= 0 && fstat (file.getFD (), &fileInfo) == 0) {
+
+		// map the whole pages that are in the file
+		size_t numFilePages = fileInfo.st_size / pageSize;
+		size_t length = numFilePages * pageSize;
+		void *base = numFilePages == 0 ? MAP_FAILED :
+			mmap (nullptr, length, PROT_READ, MAP_SHARED, file.getFD (), 0);
+		if (base != MAP_FAILED) {
+			shared_ptr <void> mapping (base, [length] (void *base) {
+				munmap (base, length);
+			});
+			mappedFiles[whichTable] = make_pair (mapping, numFilePages);
+		}
+	}
+	numMappedFiles = mappedFiles.size ();
+	pthread_rwlock_unlock (&mapLatch);
 }
 
 MyDB_PageHandle MyDB_BufferManager :: getPage () {
 
-	// open the file, if it is not open
-	if (fds.count (nullptr) == 0) {
-		int fd = open (tempFile.c_str (), O_TRUNC | O_CREAT | O_RDWR, 0666);
-		fds[nullptr] = fd;
+	MyDB_BufferCounters :: count (tempAllocations);
+
+	// the page goes into the active segment's file, if there is one
+	MyDB_TempFilePtr file;
+	{
+		lock_guard <mutex> guard (tempLatch);
+		file = (segmentTempFile != nullptr ? segmentTempFile : sharedTempFile);
 	}
+	size_t pos = file->allocate ();
 
-	// check if we are extending the size of the temp file
-	size_t pos;
-	if (availablePositions.size () == 0) {
-		pos = lastTempPos++;
-	} else {
-		pos = availablePositions.top ();
-		availablePositions.pop ();
+	// remember how big the temp files have gotten
+	long numFilePages = numTempFilePages;
+	long highWater = tempHighWater;
+	while (numFilePages > highWater && !tempHighWater.compare_exchange_weak (highWater, numFilePages));
+
+	MyDB_PagePtr returnVal = pagePool->get (nullptr, pos);
+	returnVal->tempFile = file;
+	return MyDB_PageHandle (returnVal);
+}
+
+MyDB_TempFilePtr MyDB_BufferManager :: makeTempFile () {
+
+	// the first file is the one that we were given; the rest are named after it
+	string name = tempFile;
+	if (numTempFiles > 0)
+		name += "." + to_string (numTempFiles);
+	numTempFiles++;
+
+	vector <string> paths;
+	if (spillDirs.empty ())
+		paths.push_back (name);
+	for (string &dir : spillDirs)
+		paths.push_back (dir + "/" + name.substr (name.find_last_of ('/') + 1));
+	return make_shared <MyDB_TempFile> (paths, pageSize, directIO, numTempFilePages);
+}
+
+MyDB_TempSegmentPtr MyDB_BufferManager :: startTempSegment () {
+	lock_guard <mutex> guard (tempLatch);
+	segmentTempFile = makeTempFile ();
+	return make_shared <MyDB_TempSegment> (*this, segmentTempFile);
+}
+
+void MyDB_BufferManager :: endTempSegment (MyDB_TempFilePtr file) {
+	lock_guard <mutex> guard (tempLatch);
+	if (segmentTempFile == file)
+		segmentTempFile = nullptr;
+}
+
+void MyDB_BufferManager :: setSpillDirectories (vector <string> dirs) {
+	lock_guard <mutex> guard (tempLatch);
+	spillDirs = dirs;
+	sharedTempFile = makeTempFile ();
+}
+
+void *MyDB_BufferManager :: getFrame (MyDB_SubPool &pool) {
+
+	// a sub-pool that has used up its quota replaces one of its own pages
+	void *frame;
+	if (pool.quota != 0 && (size_t) pool.numFrames >= pool.quota) {
+		for (size_t i = 0; i < pool.numShards; i++) {
+			frame = kickOutPage (*shards[pool.firstShard + pool.nextVictimShard++ % pool.numShards]);
+			if (frame != nullptr)
+				return frame;
+		}
 	}
 
-	MyDB_PagePtr returnVal = make_shared <MyDB_Page> (nullptr, pos, *this);
-	return make_shared <MyDB_PageHandleBase> (returnVal);
+	// see if there is some free RAM
+	frame = availableRam->pop ();
+	if (frame != nullptr)
+		return frame;
+
+	// there is not, so kick out a page... the shards take turns giving one up
+	for (size_t i = 0; i < numShards; i++) {
+		frame = kickOutPage (*shards[nextVictimShard++ % numShards]);
+		if (frame != nullptr)
+			return frame;
+	}
+
+	// every page is pinned, though another thread may have given back some RAM meanwhile
+	frame = availableRam->pop ();
+	if (frame == nullptr)
+		cout << "Bad: all buffer memory is exhausted!";
+	return frame;
+}
+
+void MyDB_BufferManager :: writeIfDirty (MyDB_Page *page) {
+	if (page->isDirty.exchange (false)) {
+		if (!page->dead)
+			writePage (page);
+		numDirty--;
+	}
 }
 
-void MyDB_BufferManager :: kickOutPage () {
+void *MyDB_BufferManager :: kickOutPage (MyDB_BufferShard &shard) {
 	
-	// find the oldest page
-	auto it = lastUsed.begin();
-	auto page = *it;
+	lock_guard <mutex> guard (shard.latch);
 
-	if (lastUsed.size () == 0)
-		cout << "Bad: all buffer memory is exhausted!";
+	// ask the replacement policy which pages it would like to get rid of
+	shard.victims.clear ();
+	shard.policy->getVictims (CLEAN_VICTIM_WINDOW, shard.victims);
+	if (shard.victims.empty ())
+		return nullptr;
+
+	// take the first clean one, so that we don't have to wait for a write
+	MyDB_Page *page = shard.victims[0];
+	for (MyDB_Page *victim : shard.victims) {
+		if (!victim->isDirty) {
+			page = victim;
+			break;
+		}
+	}
+	shard.policy->evict (page);
 
 	// make sure we don't have a null pointer
 	if (page->bytes == nullptr) {
@@ -92,110 +620,487 @@ void MyDB_BufferManager :: kickOutPage () {
 		exit (1);
 	}
 
-	// write it back if necessary
+	// write it back if necessary... if we have to do this, the flusher is falling behind
 	if (page->isDirty) {
-		if (fds.count (page->myTable) > 0) {
-			lseek (fds[page->myTable], page->pos * pageSize, SEEK_SET);
-			write (fds[page->myTable], page->bytes, pageSize);
-		}
-		page->isDirty = false;
+		MyDB_BufferCounters :: count (page->counters->dirtyEvictions);
+		writeIfDirty (page);
+		flusherWake.notify_one ();
+	} else {
+		MyDB_BufferCounters :: count (page->counters->cleanEvictions);
 	}
 
-	// remove it
-	lastUsed.erase (page);
+	// a table page is now clean, so it can be kept in the compressed cache
+	if (page->myTable != nullptr && !page->dead)
+		compressedCache->put (make_pair (page->myTable, page->pos), page->bytes);
 
-	// remember its RAM
-	availableRam.push_back (page->bytes);
+	// take its RAM
+	void *frame = page->bytes;
 	page->bytes = nullptr;
+	shard.pool->numFrames--;
 
 	// if this guy has no references, kill him
 	if (page->refCount == 0)
-		killPage (page);
+		killPage (shard, page);
+
+	return frame;
 }
 
-void MyDB_BufferManager :: killPage (MyDB_PagePtr killMe) {
-	
+void MyDB_BufferManager :: flushVictims (MyDB_BufferShard &shard, double fraction) {
 
-	// if this is an anon page...
-	if (killMe->myTable == nullptr) {
+	lock_guard <mutex> guard (shard.latch);
+	size_t numPages = (size_t) (shard.policy->size () * fraction + 0.5);
+	shard.victims.clear ();
+	shard.policy->getVictims (numPages, shard.victims);
+	for (MyDB_Page *victim : shard.victims)
+		writeIfDirty (victim);
+}
 
-		// recycle him
-		availablePositions.push (killMe->pos);
-		if (killMe->bytes != nullptr) {
-			availableRam.push_back (killMe->bytes);
+void MyDB_BufferManager :: flushLoop () {
+
+	unique_lock <mutex> lock (flusherLatch);
+	while (!stopFlusher) {
+
+		flusherWake.wait_for (lock, chrono :: milliseconds (flushIntervalMs));
+		if (stopFlusher)
+			break;
+
+		// no need to hold our latch while we work
+		double fraction = flushFraction;
+		lock.unlock ();
+		for (size_t i = 0; i < numShards; i++)
+			flushVictims (*shards[i], fraction);
+		lock.lock ();
+	}
+}
+
+void MyDB_BufferManager :: setFlusher (double fractionClean, long intervalMs) {
+
+	// stop the old thread
+	{
+		lock_guard <mutex> guard (flusherLatch);
+		stopFlusher = true;
+	}
+	flusherWake.notify_one ();
+	if (flusher.joinable ())
+		flusher.join ();
+
+	// and start the new one
+	flushFraction = fractionClean;
+	flushIntervalMs = intervalMs;
+	if (flushFraction > 0) {
+		stopFlusher = false;
+		flusher = thread (&MyDB_BufferManager :: flushLoop, this);
+	}
+}
+
+void MyDB_BufferManager :: saveResidentPages (string fileName) {
+
+	// collect the buffered pages of each table, in file order
+	map <string, pair <string, vector <size_t>>> resident;
+	for (size_t i = 0; i < numShards; i++) {
+		lock_guard <mutex> guard (shards[i]->latch);
+		for (auto &page : shards[i]->allPages) {
+			MyDB_Page *cur = page.second.get ();
+			if (cur->bytes == nullptr)
+				continue;
+			auto &table = resident[cur->myTable->getName ()];
+			table.first = cur->myTable->getStorageLoc ();
+			table.second.push_back (cur->pos);
+		}
+	}
+
+	// one line per table: its name, its file, the number of pages, and the pages
+	ofstream out (fileName);
+	for (auto &table : resident) {
+		sort (table.second.second.begin (), table.second.second.end ());
+		out << table.first << " " << table.second.first << " " << table.second.second.size ();
+		for (size_t pos : table.second.second)
+			out << " " << pos;
+		out << "\n";
+	}
+	if (!out)
+		cout << "Could not write the list of buffered pages to " << fileName << ".\n";
+}
+
+void MyDB_BufferManager :: preload (string fileName, map <string, MyDB_TablePtr> &tables) {
+
+	// only one preload at a time
+	stopPreloader = true;
+	waitForPreload ();
+	stopPreloader = false;
+
+	// figure out what to read... a table is only preloaded if it is still the same table
+	vector <pair <MyDB_TablePtr, vector <size_t>>> work;
+	ifstream in (fileName);
+	string name, storageLoc;
+	size_t numListed;
+	while (in >> name >> storageLoc >> numListed) {
+		vector <size_t> positions (numListed);
+		for (size_t &pos : positions)
+			in >> pos;
+		auto found = tables.find (name);
+		if (found != tables.end () && found->second->getStorageLoc () == storageLoc)
+			work.push_back (make_pair (found->second, positions));
+	}
+
+	if (!work.empty ())
+		preloader = thread (&MyDB_BufferManager :: preloadLoop, this, work);
+}
+
+void MyDB_BufferManager :: waitForPreload () {
+	if (preloader.joinable ())
+		preloader.join ();
+}
+
+void MyDB_BufferManager :: preloadLoop (vector <pair <MyDB_TablePtr, vector <size_t>>> work) {
+
+	for (auto &table : work) {
+
+		// the pages of a read-only table are never in the pool
+		if (numMappedFiles > 0) {
+			pthread_rwlock_rdlock (&mapLatch);
+			bool mapped = mappedFiles.count (table.first) > 0;
+			pthread_rwlock_unlock (&mapLatch);
+			if (mapped)
+				continue;
+		}
+
+		vector <size_t> &positions = table.second;
+		for (size_t first = 0; first < positions.size ();) {
+
+			// find the run of adjacent pages that starts here
+			size_t count = 1;
+			while (first + count < positions.size () && count < PRELOAD_RUN_PAGES &&
+				positions[first + count] == positions[first] + count)
+				count++;
+
+			// once the pool fills up, we are done
+			if (stopPreloader || availableRam->size () == 0)
+				return;
+
+			// if nothing could be read, the rest of the pages are past the end of the file
+			size_t numRead = preloadRun (table.first, positions[first], count);
+			if (numRead == 0)
+				break;
+			first += numRead;
+		}
+	}
+}
+
+size_t MyDB_BufferManager :: preloadRun (MyDB_TablePtr whichTable, size_t first, size_t count) {
+
+	// get as many free frames as we can, without kicking anything out
+	vector <iovec> frames;
+	while (frames.size () < count) {
+		void *frame = availableRam->pop ();
+		if (frame == nullptr)
+			break;
+		frames.push_back (iovec {frame, pageSize});
+	}
+	if (frames.empty ())
+		return 0;
+
+	// if any page of the table gets written while we are reading, what we read may be out
+	// of date by the time we put it in the pool, so we notice that and throw it away
+	MyDB_BufferCounters *counters = getCounters (whichTable);
+	long numWrites = counters->writes;
+
+	// read the whole run at once
+	ssize_t numBytes = -1;
+	MyDB_TableFilePtr tableFile = fileCache->getFile (whichTable);
+	{
+		MyDB_FileUse file (tableFile.get ());
+		if (file.getFD () >= 0) {
+			auto start = chrono :: steady_clock :: now ();
+			do {
+				numBytes = preadv (file.getFD (), frames.data (), frames.size (), first * pageSize);
+			} while (numBytes < 0 && errno == EINTR);
+			MyDB_BufferCounters :: countLatency (counters->readLatency, nanosSince (start));
+		}
+	}
+	size_t numRead = numBytes < 0 ? 0 : numBytes / pageSize;
+	MyDB_BufferCounters :: count (counters->reads, numRead);
+
+	// and put the pages that nobody else has in the meantime into the pool
+	for (size_t i = 0; i < frames.size (); i++) {
+		if (i >= numRead) {
+			availableRam->push (frames[i].iov_base);
+			continue;
+		}
+
+		unique_lock <mutex> guard;
+		MyDB_BufferShard &shard = lockShard (whichTable, first + i, guard);
+		if (shard.allPages.count (make_pair (whichTable, first + i)) > 0 || counters->writes != numWrites) {
+			availableRam->push (frames[i].iov_base);
+			continue;
+		}
+
+		MyDB_PagePtr page = pagePool->get (whichTable, first + i);
+		page->bytes = frames[i].iov_base;
+		page->numBytes = pageSize;
+		shard.pool->numFrames++;
+		shard.allPages.emplace (make_pair (whichTable, first + i), page);
+		shard.policy->pageIn (page.get ());
+		compressedCache->erase (make_pair (whichTable, first + i));
+	}
+
+	return numRead;
+}
+
+void MyDB_BufferManager :: writePages (vector <MyDB_Page *> &pages) {
+
+	sort (pages.begin (), pages.end (), [] (MyDB_Page *lhs, MyDB_Page *rhs) {
+		return lhs->pos < rhs->pos;
+	});
+
+	// all of the pages are in the same file
+	MyDB_FileUse file (pages[0]->file.get ());
+	vector <iovec> chunks;
+	for (size_t first = 0; first < pages.size (); first += chunks.size ()) {
+
+		// find the run of adjacent pages that starts here
+		chunks.clear ();
+		do {
+			MyDB_Page *page = pages[first + chunks.size ()];
+			if (page->isDirty.exchange (false))
+				numDirty--;
+			chunks.push_back (iovec {page->bytes, pageSize});
+		} while (first + chunks.size () < pages.size () && chunks.size () < IOV_MAX &&
+			pages[first + chunks.size ()]->pos == pages[first + chunks.size () - 1]->pos + 1);
+
+		// the table may have been killed, in which case nothing gets written
+		if (file.getFD () < 0)
+			continue;
+
+		// and write it, picking up where we left off if only part of it gets written
+		MyDB_BufferCounters *counters = pages[first]->counters;
+		MyDB_BufferCounters :: count (counters->writes, chunks.size ());
+		off_t where = pages[first]->pos * pageSize;
+		size_t done = 0;
+		while (done < chunks.size ()) {
+			auto start = chrono :: steady_clock :: now ();
+			ssize_t numBytes = pwritev (file.getFD (), &chunks[done], chunks.size () - done, where);
+			MyDB_BufferCounters :: countLatency (counters->writeLatency, nanosSince (start));
+			if (numBytes < 0 && errno == EINTR)
+				continue;
+			if (numBytes <= 0) {
+				cout << "Can't write a page: " << (numBytes < 0 ? strerror (errno) : "nothing was written") << "\n";
+				break;
+			}
+			where += numBytes;
+			for (; done < chunks.size () && (size_t) numBytes >= chunks[done].iov_len; done++)
+				numBytes -= chunks[done].iov_len;
+			if (done < chunks.size ()) {
+				chunks[done].iov_base = ((char *) chunks[done].iov_base) + numBytes;
+				chunks[done].iov_len -= numBytes;
+			}
+		}
+	}
+}
+
+void MyDB_BufferManager :: flush (MyDB_TablePtr whichTable) {
+
+	// no page can be kicked out (and have its RAM handed to someone else) while we are
+	// writing it, so we hold every shard latch... these are always taken in the same order
+	vector <unique_lock <mutex>> latches;
+	size_t numLatched = numShards;
+	for (size_t i = 0; i < numLatched; i++)
+		latches.push_back (unique_lock <mutex> (shards[i]->latch));
+
+	// group the dirty pages by file
+	map <MyDB_TableFile *, vector <MyDB_Page *>> dirtyPages;
+	for (size_t i = 0; i < numLatched; i++) {
+		for (auto &page : shards[i]->allPages) {
+			MyDB_Page *cur = page.second.get ();
+			if (cur->bytes != nullptr && cur->isDirty &&
+				(whichTable == nullptr || cur->myTable->getName () == whichTable->getName ()))
+				dirtyPages[cur->file.get ()].push_back (cur);
+		}
+	}
+
+	for (auto &table : dirtyPages)
+		writePages (table.second);
+}
+
+void MyDB_BufferManager :: flushTable (MyDB_TablePtr whichTable) {
+	if (whichTable != nullptr)
+		flush (whichTable);
+}
+
+void MyDB_BufferManager :: flushAll () {
+	flush (nullptr);
+}
+
+void MyDB_BufferManager :: setHugePages (bool huge) {
+	madvise (ram, ramSize, huge ? MADV_HUGEPAGE : MADV_NOHUGEPAGE);
+}
+
+void MyDB_BufferManager :: setDirectIO (bool direct) {
+
+	if (direct && pageSize % DIRECT_IO_ALIGNMENT != 0) {
+		cout << "Can't use direct I/O with a page size of " << pageSize << " bytes.\n";
+		return;
+	}
+
+	// files opened from now on will use the new setting, and we switch the ones that are open
+	directIO = direct;
+	fileCache->setDirectIO (direct);
+
+	// older temp files keep their setting, but they go away once their pages do
+	lock_guard <mutex> guard (tempLatch);
+	sharedTempFile->setDirectIO (direct);
+	if (segmentTempFile != nullptr)
+		segmentTempFile->setDirectIO (direct);
+}
+
+void MyDB_BufferManager :: setMaxOpenFiles (size_t maxOpen) {
+	fileCache->setMaxOpen (maxOpen);
+}
+
+size_t MyDB_BufferManager :: getNumOpenFiles () {
+	return fileCache->getNumOpen ();
+}
+
+size_t MyDB_BufferManager :: getNumDirty () {
+	long result = numDirty;
+	return result < 0 ? 0 : result;
+}
+
+size_t MyDB_BufferManager :: getNumClean () {
+	long result = (long) numPages - (long) availableRam->size () - numDirty;
+	return result < 0 ? 0 : result;
+}
+
+void MyDB_BufferManager :: killPage (MyDB_Page *killMe) {
+
+	// a mapped page was never known to the pool
+	if (killMe->mappedFile != nullptr)
+		return;
+
+	unique_lock <mutex> guard;
+	MyDB_BufferShard &shard = lockShard (killMe, guard);
+
+	// another thread may have gotten a new handle to the page since the count went to zero
+	if (killMe->refCount != 0)
+		return;
+
+	killPage (shard, killMe);
+}
+
+void MyDB_BufferManager :: killPage (MyDB_BufferShard &shard, MyDB_Page *killMe) {
+
+	// nobody has the page pinned any more
+	leaveGrant (killMe);
+	
+	// if this is an anon page, or one whose contents are dead...
+	if (killMe->myTable == nullptr || killMe->dead) {
+
+		// if he can be evicted, make sure that he won't be
+		if (shard.policy->contains (killMe)) {
+			shard.policy->remove (killMe);
 		}
 
-		// if he is in the LRU list, remove him
-		if (lastUsed.count (killMe) != 0) {
-			auto page = *(lastUsed.find (killMe));
-			lastUsed.erase (page);
+		// his contents are gone for good, so there is no need to write them back
+		if (killMe->isDirty.exchange (false))
+			numDirty--;
+
+		// recycle his spot in the temp file, giving its disk space back
+		if (killMe->tempFile != nullptr)
+			killMe->tempFile->free (killMe->pos, killMe->wasWritten);
+
+		if (killMe->bytes != nullptr) {
+			availableRam->push (killMe->bytes);
+			killMe->bytes = nullptr;
+			shard.pool->numFrames--;
 		}
 
 	// if this is a pinned, non-anon page whose data is buffered it converts...
-	} else if (lastUsed.count (killMe) == 0 && killMe->bytes != nullptr) {
-		killMe->timeTick = ++lastTimeTick;
-		lastUsed.insert (killMe);
+	} else if (killMe->bytes != nullptr && !shard.policy->contains (killMe)) {
+		MyDB_BufferCounters :: count (killMe->counters->unpins);
+		shard.policy->pageUnpinned (killMe);
 
 	// this guy has no data, so just kill him
 	} else if (killMe->bytes == nullptr) {
-		pair <MyDB_TablePtr, long> whichPage = make_pair (killMe->myTable, killMe->pos);
-		allPages.erase (whichPage);
+		if (killMe->isDirty.exchange (false))
+			numDirty--;
+
+		// another thread may have killed him first and a new page for the same spot in the
+		// file may have been made since, so only take him out if the entry is still his
+		auto found = shard.allPages.find (make_pair (killMe->myTable, killMe->pos));
+		if (found != shard.allPages.end () && found->second.get () == killMe)
+			shard.allPages.erase (found);
 	}
 }
 
-void MyDB_BufferManager :: access (MyDB_PagePtr updateMe) {
+void MyDB_BufferManager :: access (MyDB_Page *updateMe) {
 	
-	// if this page was just accessed, get outta here
-	if (updateMe->timeTick > lastTimeTick - (numPages / 2) && updateMe->bytes != nullptr) {
+	// a mapped page always has its bytes, and the OS decides what to keep in RAM
+	if (updateMe->mappedFile != nullptr)
 		return;
-	}
 
-	// first, see if it is currently in the LRU list; if it is, update it
-	if (lastUsed.count (updateMe) == 1) {
-		auto page = *(lastUsed.find (updateMe));
-		lastUsed.erase (page);
-		updateMe->timeTick = ++lastTimeTick;
-		lastUsed.insert (updateMe);
+	unique_lock <mutex> guard;
+	void *frame;
+	{
+		MyDB_BufferShard &shard = lockShard (updateMe, guard);
 
-	// here, we don't have the bytes...
-	} else if (updateMe->bytes == nullptr) {
-		
-		// not in the LRU list means that we don't have its contents buffered
-		// see if there is space
-		if (availableRam.size () == 0)
-			kickOutPage ();
-
-		// if there is no space, we cannot do anything
-		if (availableRam.size () == 0) {
-			cout << "Can't get any RAM to read a page!!\n";
-			exit (1);
+		// first, see if it is one of the pages that can be evicted; if it is, let the policy know
+		if (shard.policy->contains (updateMe)) {
+			MyDB_BufferCounters :: count (updateMe->counters->hits);
+			shard.policy->pageAccessed (updateMe);
+			return;
 		}
 
-		// get some RAM for the page
-		updateMe->bytes = availableRam[availableRam.size () - 1]; 
-		updateMe->numBytes = pageSize;
-		availableRam.pop_back ();
-
-		// and read it
-		if (fds.count (updateMe->myTable) > 0) {
-			lseek (fds[updateMe->myTable], updateMe->pos * pageSize, SEEK_SET);
-			read (fds[updateMe->myTable], updateMe->bytes, pageSize);
-		} else {
-			cout << "Trying to read a page from a file that does not exist.\n";
+		// if it has RAM but the policy does not know about it, then it is pinned
+		if (updateMe->bytes != nullptr) {
+			MyDB_BufferCounters :: count (updateMe->counters->hits);
+			return;
 		}
 
-		updateMe->timeTick = ++lastTimeTick;
-		lastUsed.insert (updateMe);
+		// here, we don't have the bytes... get some RAM for the page; this is done without
+		// holding our latch, since it may mean kicking out a page from some other shard
+		guard.unlock ();
+		frame = getFrame (*shard.pool);
 	}
+
+	// if there is no space (every frame is pinned), the page is left without its bytes,
+	// and it is up to the caller to deal with that
+	if (frame == nullptr) {
+		cout << "Can't get any RAM to read a page!!\n";
+		return;
+	}
+
+	// the page may have been moved to another shard while we did not hold the latch
+	MyDB_BufferShard &shard = lockShard (updateMe, guard);
+
+	// some other thread may have read the page in while we were getting the RAM
+	if (updateMe->bytes != nullptr) {
+		MyDB_BufferCounters :: count (updateMe->counters->hits);
+		availableRam->push (frame);
+		if (shard.policy->contains (updateMe))
+			shard.policy->pageAccessed (updateMe);
+		return;
+	}
+
+	// and read it
+	MyDB_BufferCounters :: count (updateMe->counters->misses);
+	shard.pool->numFrames++;
+	updateMe->bytes = frame;
+	updateMe->numBytes = pageSize;
+	readPage (updateMe);
+
+	shard.policy->pageIn (updateMe);
 }
 
 MyDB_PageHandle MyDB_BufferManager :: getPinnedPage (MyDB_TablePtr whichTable, long i) {
+	return getPinnedPage (whichTable, i, NormalAccess);
+}
 
-	// open the file, if it is not open
-	if (fds.count (whichTable) == 0) {
-		int fd = open (whichTable->getStorageLoc ().c_str (), O_CREAT | O_RDWR, 0666);
-		fds[whichTable] = fd;
-	}
+MyDB_PageHandle MyDB_BufferManager :: getPinnedPage (MyDB_TablePtr whichTable, long i, MyDB_AccessHint hint) {
+	return getPinnedPage (whichTable, i, hint, nullptr);
+}
+
+MyDB_PageHandle MyDB_BufferManager :: getPinnedPage (MyDB_TablePtr whichTable, long i, MyDB_AccessHint hint,
+	MyDB_MemoryGrantPtr grant) {
 
 	// make sure we don't have a null table
 	if (whichTable == nullptr) {
@@ -203,84 +1108,558 @@ MyDB_PageHandle MyDB_BufferManager :: getPinnedPage (MyDB_TablePtr whichTable, l
 		exit (1);
 	}
 
-	// first, see if the page is there in the buffer
-	pair <MyDB_TablePtr, long> whichPage = make_pair (whichTable, i);
-	MyDB_PagePtr returnVal;
+	// a mapped page is always "in RAM", so there is nothing to pin
+	if (numMappedFiles > 0) {
+		MyDB_PageHandle mapped = getMappedPage (whichTable, i);
+		if (mapped != nullptr)
+			return mapped;
+	}
 
-	// see if we already know him
-	if (allPages.count (whichPage) == 0) {
+	// this has to be found out before we take any latch
+	bool haveRoom = numUnreserved () > 0;
 
-		// in this case, we do not
-		returnVal = make_shared <MyDB_Page> (whichTable, i, *this);
-		allPages [whichPage] = returnVal;
+	MyDB_PageHandle returnVal;
+	MyDB_Page *page;
+	unique_lock <mutex> firstGuard;
+	MyDB_BufferShard &shard = lockShard (whichTable, i, firstGuard);
+	{
 
-	// in this case, we do
-	} else {
+		// see if we already know him
+		MyDB_PageKey whichPage = make_pair (whichTable, (size_t) i);
+		auto found = shard.allPages.find (whichPage);
+		if (found == shard.allPages.end ()) {
 
-		// get him out of the LRU list if he is there
-		returnVal = allPages [whichPage];
-		if (lastUsed.count (returnVal) != 0) {
-			auto page = *(lastUsed.find (returnVal));
-	       		lastUsed.erase (page);
+			// in this case, we do not
+			MyDB_PagePtr newPage = pagePool->get (whichTable, i);
+			newPage->hint = hint;
+			shard.allPages.emplace (whichPage, newPage);
+			returnVal = MyDB_PageHandle (newPage);
+
+		// in this case, we do
+		} else {
+			returnVal = MyDB_PageHandle (found->second);
+			applyHint (found->second.get (), hint, false);
 		}
-	}
 
-	// see if we need to get his data
-	if (returnVal->bytes == nullptr) {
+		// if he is not pinned already, pinning him takes a frame, which is either one of the
+		// grant's or one that has not been set aside for anybody
+		page = returnVal->page.get ();
+		if (page->bytes == nullptr || shard.policy->contains (page)) {
+			useGrant (page, grant);
+			if (page->grant == nullptr && !haveRoom)
+				return nullptr;
+		}
 
-		// see if there is space to make a pinned page
-		if (availableRam.size () == 0)
-			kickOutPage ();
+		// make sure that he can't be evicted
+		MyDB_BufferCounters :: count (page->counters->pins);
+		if (shard.policy->contains (page)) {
+			shard.policy->remove (page);
+		}
 
-		// if there is no space, we cannot do anything
-		if (availableRam.size () == 0) 
-			return nullptr;
+		// if his data is there, we are done
+		if (page->bytes != nullptr) {
+			MyDB_BufferCounters :: count (page->counters->hits);
+			return returnVal;
+		}
+		firstGuard.unlock ();
+	}
 
-		// set up the return val
-		returnVal->bytes = availableRam[availableRam.size () - 1];
-		returnVal->numBytes = pageSize;
-		availableRam.pop_back ();
+	// see if there is space to make a pinned page
+	void *frame = getFrame (*shard.pool);
+
+	// if there is no space, we cannot do anything... if he is still without his bytes, he
+	// does not get to keep the grant's frame that was meant for him
+	if (frame == nullptr) {
+		{
+			unique_lock <mutex> guard;
+			lockShard (page, guard);
+			if (page->bytes == nullptr)
+				leaveGrant (page);
+		}
+		return nullptr;
+	}
 
-		// and read it
-		if (fds.count (returnVal->myTable) > 0) {
-			lseek (fds[returnVal->myTable], returnVal->pos * pageSize, SEEK_SET);
-			read (fds[returnVal->myTable], returnVal->bytes, pageSize);
-		} else {
-			cout << "This is bad: you are reading a page that no longer exists.\n";
+	// the page may have been moved to another shard while we did not hold the latch
+	unique_lock <mutex> guard;
+	MyDB_BufferShard &pageShard = lockShard (page, guard);
+
+	// if some other thread read him in while we were getting the RAM, he is now
+	// known to the policy, and we need to pin him again
+	if (page->bytes != nullptr) {
+		MyDB_BufferCounters :: count (page->counters->hits);
+		availableRam->push (frame);
+		if (pageShard.policy->contains (page)) {
+			pageShard.policy->remove (page);
 		}
+		return returnVal;
+	}
 
-	}	
+	// set up the page and read it
+	MyDB_BufferCounters :: count (page->counters->misses);
+	pageShard.pool->numFrames++;
+	page->bytes = frame;
+	page->numBytes = pageSize;
+	readPage (page);
 
 	// get outta here
-	return make_shared <MyDB_PageHandleBase> (returnVal);
+	return returnVal;
 }
 
 MyDB_PageHandle MyDB_BufferManager :: getPinnedPage () {
+	return getPinnedPage (nullptr);
+}
+
+MyDB_PageHandle MyDB_BufferManager :: getPinnedPage (MyDB_MemoryGrantPtr grant) {
+
+	// get a page to return... no other thread knows about him yet
+	MyDB_PageHandle returnVal = getPage ();
+	MyDB_BufferCounters :: count (tempCounters->pins);
+
+	// he needs one of the grant's frames, or one that has not been set aside for anybody
+	MyDB_SubPool *pool;
+	{
+		unique_lock <mutex> guard;
+		MyDB_BufferShard &shard = lockShard (returnVal->page.get (), guard);
+		useGrant (returnVal->page.get (), grant);
+		pool = shard.pool;
+	}
+	if (returnVal->page->grant == nullptr && numUnreserved () == 0)
+		return nullptr;
 
 	// see if there is space to make a pinned page
-	if (availableRam.size () == 0)
-		kickOutPage ();
+	void *frame = getFrame (*pool);
 
-	// if there is no space, we cannot do anything
-	if (availableRam.size () == 0) 
+	// if there is no space, we cannot do anything (killing the page gives back the grant's frame)
+	if (frame == nullptr) 
 		return nullptr;
 
-	// get a page to return
-	MyDB_PageHandle returnVal = getPage ();
-	returnVal->page->bytes = availableRam[availableRam.size () - 1];
+	pool->numFrames++;
+	returnVal->page->bytes = frame;
 	returnVal->page->numBytes = pageSize;
-	availableRam.pop_back ();
 
 	// and get outta here
 	return returnVal;
 }
 
+vector <MyDB_PageHandle> MyDB_BufferManager :: getPages (MyDB_TablePtr whichTable, vector <long> &positions) {
+	return getPages (whichTable, positions, NormalAccess);
+}
+
+vector <MyDB_PageHandle> MyDB_BufferManager :: getPages (MyDB_TablePtr whichTable, vector <long> &positions,
+	MyDB_AccessHint hint) {
+	return getPages (whichTable, positions, hint, false, nullptr);
+}
+
+vector <MyDB_PageHandle> MyDB_BufferManager :: getPinnedPages (MyDB_TablePtr whichTable, vector <long> &positions) {
+	return getPages (whichTable, positions, NormalAccess, true, nullptr);
+}
+
+vector <MyDB_PageHandle> MyDB_BufferManager :: getPinnedPages (MyDB_TablePtr whichTable, vector <long> &positions,
+	MyDB_MemoryGrantPtr grant) {
+	return getPages (whichTable, positions, NormalAccess, true, grant);
+}
+
+vector <MyDB_PageHandle> MyDB_BufferManager :: getPages (MyDB_TablePtr whichTable, vector <long> &positions,
+	MyDB_AccessHint hint, bool pin, MyDB_MemoryGrantPtr grant) {
+
+	// first get the handles, without reading anything
+	vector <MyDB_PageHandle> handles;
+	for (long i : positions)
+		handles.push_back (getPage (whichTable, i, hint));
+
+	// and then read in the pages, a batch at a time
+	size_t batchSize = numPages / MAX_BATCH_FRACTION;
+	if (batchSize < 1)
+		batchSize = 1;
+	for (size_t first = 0; first < handles.size (); first += batchSize)
+		loadPages (handles, first, min (batchSize, handles.size () - first), pin, grant);
+	return handles;
+}
+
+void MyDB_BufferManager :: loadPages (vector <MyDB_PageHandle> &handles, size_t first, size_t count, bool pin,
+	MyDB_MemoryGrantPtr grant) {
+
+	// the pages that are not pinned through the grant can only take the frames that have not
+	// been set aside for anybody... this has to be found out before we take any latch
+	size_t numUnreservedLeft = (pin ? numUnreserved () : 0);
+
+	// pin the pages (if need be), and find the ones that are not buffered
+	vector <MyDB_Page *> missing;
+	vector <size_t> missingAt;
+	vector <size_t> noRoom;
+	for (size_t i = first; i < first + count; i++) {
+		MyDB_Page *page = handles[i]->page.get ();
+
+		// a mapped page always has its bytes
+		if (page->mappedFile != nullptr)
+			continue;
+
+		unique_lock <mutex> guard;
+		MyDB_BufferShard &shard = lockShard (page, guard);
+		if (pin) {
+			if (page->bytes == nullptr || shard.policy->contains (page)) {
+				useGrant (page, grant);
+				if (page->grant == nullptr) {
+					if (numUnreservedLeft == 0) {
+						noRoom.push_back (i);
+						continue;
+					}
+					numUnreservedLeft--;
+				}
+			}
+			MyDB_BufferCounters :: count (page->counters->pins);
+			if (shard.policy->contains (page))
+				shard.policy->remove (page);
+		}
+		if (page->bytes == nullptr) {
+			missing.push_back (page);
+			missingAt.push_back (i);
+		} else {
+			MyDB_BufferCounters :: count (page->counters->hits);
+			if (shard.policy->contains (page))
+				shard.policy->pageAccessed (page);
+		}
+	}
+	if (missing.empty ()) {
+		for (size_t i : noRoom)
+			handles[i] = nullptr;
+		return;
+	}
+
+	// get RAM for them... this is done without holding any latch, since it may mean kicking out
+	// pages from any of the shards (if a page is moved meanwhile, its frame just came from the
+	// sub-pool that it used to be in)
+	vector <void *> frames;
+	for (MyDB_Page *page : missing)
+		frames.push_back (getFrame (*shards[page->shard]->pool));
+
+	// we hold the latches of all of their shards (taken in order, as always) until they have
+	// been read, so that nobody can see a page before its bytes are there... if a table was
+	// moved to another sub-pool (and so to other shards) while we waited, we try again
+	vector <unique_lock <mutex>> latches;
+	while (true) {
+		vector <size_t> whichShards;
+		for (MyDB_Page *page : missing)
+			whichShards.push_back (page->shard);
+		sort (whichShards.begin (), whichShards.end ());
+		whichShards.erase (unique (whichShards.begin (), whichShards.end ()), whichShards.end ());
+		for (size_t i : whichShards)
+			latches.push_back (unique_lock <mutex> (shards[i]->latch));
+
+		bool moved = false;
+		for (MyDB_Page *page : missing)
+			moved = moved || !binary_search (whichShards.begin (), whichShards.end (), page->shard);
+		if (!moved)
+			break;
+		latches.clear ();
+	}
+
+	vector <MyDB_Page *> toRead;
+	for (size_t i = 0; i < missing.size (); i++) {
+		MyDB_Page *page = missing[i];
+		MyDB_BufferShard &shard = *shards[page->shard];
+
+		// all of the RAM is pinned
+		if (frames[i] == nullptr) {
+			noRoom.push_back (missingAt[i]);
+			if (page->bytes == nullptr)
+				leaveGrant (page);
+			continue;
+		}
+
+		// some other thread read it in while we were getting the RAM (or it was asked for twice)
+		if (page->bytes != nullptr) {
+			MyDB_BufferCounters :: count (page->counters->hits);
+			availableRam->push (frames[i]);
+			if (shard.policy->contains (page)) {
+				if (pin)
+					shard.policy->remove (page);
+				else
+					shard.policy->pageAccessed (page);
+			}
+			continue;
+		}
+
+		MyDB_BufferCounters :: count (page->counters->misses);
+		shard.pool->numFrames++;
+		page->bytes = frames[i];
+		page->numBytes = pageSize;
+		toRead.push_back (page);
+	}
+
+	readBatch (toRead);
+	if (!pin) {
+		for (MyDB_Page *page : toRead)
+			shards[page->shard]->policy->pageIn (page);
+	}
+
+	// as with getPinnedPage, a pinned page that could not be read is a nullptr... the handles
+	// are let go of once we no longer hold any latch, since that may kill the page
+	latches.clear ();
+	if (pin) {
+		for (size_t i : noRoom)
+			handles[i] = nullptr;
+	}
+}
+
+void MyDB_BufferManager :: readBatch (vector <MyDB_Page *> &pages) {
+
+	// each file is held open until all of the reads are done
+	vector <MyDB_ReadRequest> requests;
+	vector <MyDB_Page *> reading;
+	for (MyDB_Page *page : pages) {
+
+		// the page may have been kept in compressed form when it was kicked out
+		if (compressedCache->get (make_pair (page->myTable, page->pos), page->bytes)) {
+			MyDB_BufferCounters :: count (page->counters->unpacks);
+			continue;
+		}
+
+		int fd = page->file->use ();
+		if (fd < 0) {
+			cout << "Trying to read a page from a file that does not exist.\n";
+			continue;
+		}
+		requests.push_back (MyDB_ReadRequest {fd, page->bytes, pageSize, (off_t) (page->pos * pageSize)});
+		reading.push_back (page);
+	}
+
+	// each page has to wait for the whole batch, so that is the latency of its read
+	auto start = chrono :: steady_clock :: now ();
+	batchReader->read (requests);
+	long latency = nanosSince (start);
+
+	for (MyDB_Page *page : reading) {
+		page->file->done ();
+		MyDB_BufferCounters :: countLatency (page->counters->readLatency, latency);
+		MyDB_BufferCounters :: count (page->counters->reads);
+	}
+}
+
 void MyDB_BufferManager :: unpin (MyDB_PagePtr unpinMe) {
-	unpinMe->timeTick = ++lastTimeTick;
-	lastUsed.insert (unpinMe);
+
+	if (unpinMe->mappedFile != nullptr)
+		return;
+
+	unique_lock <mutex> guard;
+	MyDB_BufferShard &shard = lockShard (unpinMe.get (), guard);
+	leaveGrant (unpinMe.get ());
+
+	// a page without any RAM has nothing that can be evicted
+	if (unpinMe->bytes == nullptr)
+		return;
+
+	if (shard.policy->contains (unpinMe.get ())) {
+		shard.policy->pageAccessed (unpinMe.get ());
+	} else {
+		MyDB_BufferCounters :: count (unpinMe->counters->unpins);
+		shard.policy->pageUnpinned (unpinMe.get ());
+	}
+}
+
+size_t MyDB_BufferManager :: countPinnable () {
+	size_t numPinnable = availableRam->size ();
+	for (size_t i = 0; i < numShards; i++) {
+		lock_guard <mutex> guard (shards[i]->latch);
+		numPinnable += shards[i]->policy->size ();
+	}
+	return numPinnable;
+}
+
+size_t MyDB_BufferManager :: numUnreserved () {
+
+	// the common case, which does not need to look at every shard
+	if (numSetAside == 0)
+		return numPages;
+
+	size_t numPinnable = countPinnable ();
+	return numPinnable > numSetAside ? numPinnable - numSetAside : 0;
+}
+
+size_t MyDB_BufferManager :: numGrantable (size_t numPinnable) {
+
+	// a frame can be granted if it could be pinned right now, and it is not set aside already
+	size_t numKeptBack = numPages / UNGRANTED_FRACTION;
+	if (numKeptBack < 1)
+		numKeptBack = 1;
+	size_t result = numPages > numReserved ? numPages - numReserved : 0;
+	numPinnable = numPinnable > numSetAside ? numPinnable - numSetAside : 0;
+	if (numPinnable < result)
+		result = numPinnable;
+	return result > numKeptBack ? result - numKeptBack : 0;
 }
 
-MyDB_BufferManager :: MyDB_BufferManager (size_t pageSizeIn, size_t numPagesIn, string tempFileIn) {
+size_t MyDB_BufferManager :: getNumGrantableFrames () {
+	size_t numPinnable = countPinnable ();
+	lock_guard <mutex> guard (grantLatch);
+	return numGrantable (numPinnable);
+}
+
+void MyDB_BufferManager :: resizeGrant (MyDB_MemoryGrant &grant, size_t numFrames, size_t numUsed) {
+	size_t oldIdle = grant.numFrames > grant.numUsed ? grant.numFrames - grant.numUsed : 0;
+	size_t newIdle = numFrames > numUsed ? numFrames - numUsed : 0;
+	numReserved = numReserved - grant.numFrames + numFrames;
+	numSetAside = numSetAside - oldIdle + newIdle;
+	grant.numFrames = numFrames;
+	grant.numUsed = numUsed;
+}
+
+size_t MyDB_BufferManager :: grantFrames (MyDB_MemoryGrant &grant, size_t numFrames) {
+	size_t numPinnable = countPinnable ();
+	lock_guard <mutex> guard (grantLatch);
+	size_t numGranted = numGrantable (numPinnable);
+	if (numFrames < numGranted)
+		numGranted = numFrames;
+	resizeGrant (grant, grant.numFrames + numGranted, grant.numUsed);
+	return numGranted;
+}
+
+void MyDB_BufferManager :: releaseFrames (MyDB_MemoryGrant &grant) {
+	lock_guard <mutex> guard (grantLatch);
+	resizeGrant (grant, 0, grant.numUsed);
+}
+
+void MyDB_BufferManager :: useGrant (MyDB_Page *page, MyDB_MemoryGrantPtr &grant) {
+	if (grant == nullptr || page->grant != nullptr)
+		return;
+
+	lock_guard <mutex> guard (grantLatch);
+	if (grant->numUsed >= grant->numFrames)
+		return;
+	resizeGrant (*grant, grant->numFrames, grant->numUsed + 1);
+	page->grant = grant;
+}
+
+void MyDB_BufferManager :: leaveGrant (MyDB_Page *page) {
+	if (page->grant == nullptr)
+		return;
+
+	{
+		lock_guard <mutex> guard (grantLatch);
+		resizeGrant (*page->grant, page->grant->numFrames, page->grant->numUsed - 1);
+	}
+
+	// this may be the last reference to the grant, which then gives back its frames, so
+	// we can't be holding grantLatch
+	page->grant = nullptr;
+}
+
+MyDB_MemoryGrantPtr MyDB_BufferManager :: reserveFrames (size_t numFrames) {
+	MyDB_MemoryGrantPtr grant = make_shared <MyDB_MemoryGrant> (*this);
+	grantFrames (*grant, numFrames);
+	return grant;
+}
+
+MyDB_BufferStats MyDB_BufferManager :: stats () {
+
+	MyDB_BufferStats result;
+	result.numPages = numPages;
+	result.pageSize = pageSize;
+	result.numDirty = getNumDirty ();
+	result.numClean = getNumClean ();
+	result.tempAllocations = tempAllocations;
+	for (size_t i = 0; i < numSubPools; i++) {
+		long numFrames = subPools[i]->numFrames;
+		result.subPools[subPools[i]->name] = make_pair ((size_t) subPools[i]->quota, (size_t) (numFrames < 0 ? 0 : numFrames));
+	}
+
+	result.tempFilePages = numTempFilePages;
+	result.tempHighWater = tempHighWater;
+	result.compressedCapacity = compressedCache->getCapacity ();
+	result.compressedPages = compressedCache->getNumPages ();
+	result.compressedBytes = compressedCache->getNumBytes ();
+
+	lock_guard <mutex> guard (statsLatch);
+	for (auto &table : tableCounters)
+		result.tables[table.first] = table.second->getCounts ();
+	result.tables[TEMP_PAGES_NAME] = tempCounters->getCounts ();
+	for (auto &table : result.tables)
+		result.total.add (table.second);
+	return result;
+}
+
+void MyDB_BufferManager :: resetStats () {
+	lock_guard <mutex> guard (statsLatch);
+	for (auto &table : tableCounters)
+		table.second->reset ();
+	tempCounters->reset ();
+	tempAllocations = 0;
+}
+
+void MyDB_BufferManager :: prefetch (MyDB_TablePtr whichTable, long firstPage, long count) {
+
+	if (whichTable == nullptr || count <= 0 || directIO)
+		return;
+
+	MyDB_TableFilePtr tableFile = fileCache->getFile (whichTable);
+	MyDB_FileUse file (tableFile.get ());
+	if (file.getFD () >= 0)
+		posix_fadvise (file.getFD (), firstPage * pageSize, count * pageSize, POSIX_FADV_WILLNEED);
+}
+
+void MyDB_BufferManager :: prefetch (MyDB_PageHandle whichPage) {
+
+	MyDB_Page *page = whichPage->page.get ();
+	if (page->bytes != nullptr || directIO)
+		return;
+
+	if (page->tempFile != nullptr) {
+		posix_fadvise (page->tempFile->getFD (page->pos), page->tempFile->getOffset (page->pos), pageSize, POSIX_FADV_WILLNEED);
+		return;
+	}
+
+	MyDB_FileUse file (page->file.get ());
+	if (file.getFD () >= 0)
+		posix_fadvise (file.getFD (), page->pos * pageSize, pageSize, POSIX_FADV_WILLNEED);
+}
+
+void MyDB_BufferManager :: setCompressedCache (size_t numBytes) {
+	compressedCache->setCapacity (numBytes);
+}
+
+void MyDB_BufferManager :: setHint (MyDB_PageHandle whichPage, MyDB_AccessHint hint) {
+
+	MyDB_Page *page = whichPage->page.get ();
+	if (page->mappedFile != nullptr)
+		return;
+
+	unique_lock <mutex> guard;
+	lockShard (page, guard);
+	applyHint (page, hint, true);
+}
+
+// how much a hint asks the buffer to hold on to a page
+static int hintRank (MyDB_AccessHint hint) {
+	if (hint == SequentialAccess)
+		return 0;
+	if (hint == KeepHotAccess)
+		return 2;
+	return 1;
+}
+
+void MyDB_BufferManager :: applyHint (MyDB_Page *page, MyDB_AccessHint hint, bool lower) {
+
+	// a request only ever raises the hint, so that a scan does not demote a page that somebody
+	// else is using, and a hot page stays hot until someone says otherwise
+	if (hint == page->hint || (!lower && hintRank (hint) <= hintRank (page->hint)))
+		return;
+	page->hint = hint;
+
+	// if the page can be evicted, the policy moves it to where its new hint says it goes
+	MyDB_BufferShard &shard = *shards[page->shard];
+	if (shard.policy->contains (page))
+		shard.policy->pageAccessed (page);
+}
+
+MyDB_BufferManager :: MyDB_BufferManager (size_t pageSizeIn, size_t numPagesIn, string tempFileIn) :
+	MyDB_BufferManager (pageSizeIn, numPagesIn, tempFileIn, make_shared <MyDB_LRUPolicy> ()) {}
+
+MyDB_BufferManager :: MyDB_BufferManager (size_t pageSizeIn, size_t numPagesIn, string tempFileIn,
+	MyDB_ReplacementPolicyPtr policyIn) : 
+	MyDB_BufferManager (pageSizeIn, numPagesIn, tempFileIn, policyIn, 0) {}
+
+MyDB_BufferManager :: MyDB_BufferManager (size_t pageSizeIn, size_t numPagesIn, string tempFileIn,
+	MyDB_ReplacementPolicyPtr policyIn, size_t numShardsIn) {
 
 	// remember the inputs
 	pageSize = pageSizeIn;
@@ -288,62 +1667,150 @@ MyDB_BufferManager :: MyDB_BufferManager (size_t pageSizeIn, size_t numPagesIn,
 	// this is the location where we write temp pages
 	tempFile = tempFileIn;
 
-	// start at time tick zero
-	lastTimeTick = 0;
-
-	// position in temp file
-	lastTempPos = 0;
-
 	// the number of pages
 	numPages = numPagesIn;
 
-	// create all of the RAM
-	for (size_t i = 0; i < numPages; i++) {
-		availableRam.push_back (malloc (pageSizeIn));
-	}	
+	// there are rarely more page objects around than the pool can hold pages
+	pagePool = make_shared <MyDB_PagePool> (*this, numPages * MAX_POOL_GROWTH);
+
+	// set up the default sub-pool, figuring out how many shards to use for it
+	shards.resize (MAX_SUB_POOLS * MAX_SHARDS);
+	subPools.resize (MAX_SUB_POOLS);
+	numShards = 0;
+	numSubPools = 0;
+	nextVictimShard = 0;
+	policyPrototype = make_shared <MyDB_HintedPolicy> (policyIn);
+	addSubPool (DEFAULT_SUB_POOL, 0, numShardsIn == 0 ? numPages / PAGES_PER_SHARD : numShardsIn);
+	tempPool = 0;
+	pthread_rwlock_init (&poolLatch, nullptr);
+
+	pthread_rwlock_init (&mapLatch, nullptr);
+	fileCache = make_shared <MyDB_FileCache> (MAX_OPEN_FILES);
+	directIO = false;
+	numMappedFiles = 0;
+
+	// create all of the RAM, in one piece... mmap gives us memory that is aligned to an OS
+	// page, which is what O_DIRECT needs, and we round up to a whole number of huge pages.
+	// We set aside the address space for the biggest that the pool can grow to, but the OS
+	// does not give us any actual RAM for a frame until it is used
+	maxPages = numPages * MAX_POOL_GROWTH;
+	numFramesCarved = numPages;
+	ramSize = ((maxPages * pageSize + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE) * HUGE_PAGE_SIZE;
+	ram = mmap (nullptr, ramSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE, -1, 0);
+	if (ram == MAP_FAILED) {
+		cout << "Can't allocate " << ramSize << " bytes of buffer memory!!\n";
+		exit (1);
+	}
+	setHugePages (numPages * pageSize >= HUGE_PAGE_SIZE);
+	availableRam = make_shared <MyDB_FrameList> (ram, pageSize, maxPages, numPages);
+
+	// nothing has happened yet
+	tempCounters = make_shared <MyDB_BufferCounters> ();
+	tempAllocations = 0;
+	numReserved = 0;
+	numSetAside = 0;
+
+	// temp pages go into the temp file that we were given, until someone says otherwise
+	numTempFiles = 0;
+	numTempFilePages = 0;
+	tempHighWater = 0;
+	sharedTempFile = makeTempFile ();
+
+	// evicted pages are not kept until someone asks for it
+	compressedCache = make_shared <MyDB_CompressedCache> (0, pageSize);
+	batchReader = make_shared <MyDB_BatchReader> (BATCH_READ_THREADS);
+
+	// there is no flusher or preloader until someone asks for one
+	stopPreloader = false;
+	numDirty = 0;
+	stopFlusher = true;
+	flushFraction = 0;
+	flushIntervalMs = 0;
 }
 
-void MyDB_BufferManager :: killTable (MyDB_TablePtr killMe) {
-	
-	// remove from the table of FDs
-	if (fds.count (killMe) > 0) {
-		close (fds[killMe]);
-		unlink (killMe->getStorageLoc ().c_str ());
-		fds.erase (killMe);
+void MyDB_BufferManager :: discardPage (MyDB_Page *discardMe) {
+
+	// a mapped page never gets written anyway
+	if (discardMe->mappedFile != nullptr)
+		return;
+
+	unique_lock <mutex> guard;
+	MyDB_BufferShard &shard = lockShard (discardMe, guard);
+	discardPage (shard, discardMe);
+}
+
+void MyDB_BufferManager :: discardPage (MyDB_BufferShard &shard, MyDB_Page *discardMe) {
+
+	if (discardMe->dead)
+		return;
+	discardMe->dead = true;
+	if (discardMe->isDirty.exchange (false))
+		numDirty--;
+
+	// the next request for a page of a table should get a new page object, and not an old copy
+	if (discardMe->myTable != nullptr) {
+		compressedCache->erase (make_pair (discardMe->myTable, discardMe->pos));
+		auto found = shard.allPages.find (make_pair (discardMe->myTable, discardMe->pos));
+		if (found != shard.allPages.end () && found->second.get () == discardMe)
+			shard.allPages.erase (found);
+	}
+
+	// if nobody has the page pinned, its RAM can be used right away
+	if (discardMe->bytes != nullptr && shard.policy->contains (discardMe)) {
+		shard.policy->remove (discardMe);
+		availableRam->push (discardMe->bytes);
+		discardMe->bytes = nullptr;
+		shard.pool->numFrames--;
 	}
 }
 
-MyDB_BufferManager :: ~MyDB_BufferManager () {
+void MyDB_BufferManager :: killTable (MyDB_TablePtr killMe) {
+
+	// drop all of the table's pages, since nobody is ever going to look at them again
+	for (size_t i = 0; i < numShards; i++) {
+		MyDB_BufferShard &shard = *shards[i];
+		lock_guard <mutex> guard (shard.latch);
+		vector <MyDB_PagePtr> dropMe;
+		for (auto &page : shard.allPages) {
+			if (page.second->myTable->getName () == killMe->getName ())
+				dropMe.push_back (page.second);
+		}
+		for (auto &page : dropMe)
+			discardPage (shard, page.get ());
+	}
+	compressedCache->eraseTable (killMe);
 	
-	for (auto page : allPages) {
+	// remove from the table of mappings, and close and delete the file
+	pthread_rwlock_wrlock (&mapLatch);
+	mappedFiles.erase (killMe);
+	numMappedFiles = mappedFiles.size ();
+	pthread_rwlock_unlock (&mapLatch);
+	fileCache->killFile (killMe);
+}
 
-		if (page.second->bytes != nullptr) {
+MyDB_BufferManager :: ~MyDB_BufferManager () {
 
-			// write it back if necessary
-			if (page.second->isDirty && fds.count (page.second->myTable) > 0) {
-				lseek (fds[page.second->myTable], page.second->pos * pageSize, SEEK_SET);
-				write (fds[page.second->myTable], page.second->bytes, pageSize);
-			}
+	// stop the flusher and the preloader first, since they use everything else
+	setFlusher (0, 0);
+	stopPreloader = true;
+	waitForPreload ();
 
-			free (page.second->bytes);
+	// write everything back, in as few writes as we can
+	flushAll ();
+	for (size_t i = 0; i < numShards; i++) {
+		for (auto page : shards[i]->allPages)
 			page.second->bytes = nullptr;
-		}
 	}
 
-	// delete the rest of the RAM
-	for (auto ram : availableRam) {
-		free (ram);
-	}
+	// delete the RAM
+	munmap (ram, ramSize);
 
 	// finally, close the files
-	for (auto fd : fds) {
-		close (fd.second);
-	}
+	fileCache = nullptr;
 
-	unlink (tempFile.c_str ());
+	pthread_rwlock_destroy (&mapLatch);
+	pthread_rwlock_destroy (&poolLatch);
 }
 
 
 #endif
-
-
@@ -0,0 +1,143 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef BUFFER_STATS_C
+#define BUFFER_STATS_C
+
+#include <iomanip>
+#include "MyDB_BufferStats.h"
+
+using namespace std;
+
+MyDB_BufferCounts :: MyDB_BufferCounts () : readLatency (NUM_LATENCY_BUCKETS, 0),
+	writeLatency (NUM_LATENCY_BUCKETS, 0) {
+	hits = misses = pins = unpins = 0;
+	cleanEvictions = dirtyEvictions = 0;
+	reads = writes = unpacks = 0;
+}
+
+void MyDB_BufferCounts :: add (const MyDB_BufferCounts &other) {
+	hits += other.hits;
+	misses += other.misses;
+	pins += other.pins;
+	unpins += other.unpins;
+	cleanEvictions += other.cleanEvictions;
+	dirtyEvictions += other.dirtyEvictions;
+	reads += other.reads;
+	writes += other.writes;
+	unpacks += other.unpacks;
+	for (int i = 0; i < NUM_LATENCY_BUCKETS; i++) {
+		readLatency[i] += other.readLatency[i];
+		writeLatency[i] += other.writeLatency[i];
+	}
+}
+
+MyDB_BufferCounters :: MyDB_BufferCounters () {
+	reset ();
+}
+
+void MyDB_BufferCounters :: countLatency (atomic <long> *histogram, long nanos) {
+	int bucket = 0;
+	for (long micros = nanos / 1000; micros > 0 && bucket < NUM_LATENCY_BUCKETS - 1; micros >>= 1)
+		bucket++;
+	count (histogram[bucket]);
+}
+
+MyDB_BufferCounts MyDB_BufferCounters :: getCounts () {
+	MyDB_BufferCounts result;
+	result.hits = hits;
+	result.misses = misses;
+	result.pins = pins;
+	result.unpins = unpins;
+	result.cleanEvictions = cleanEvictions;
+	result.dirtyEvictions = dirtyEvictions;
+	result.reads = reads;
+	result.writes = writes;
+	result.unpacks = unpacks;
+	for (int i = 0; i < NUM_LATENCY_BUCKETS; i++) {
+		result.readLatency[i] = readLatency[i];
+		result.writeLatency[i] = writeLatency[i];
+	}
+	return result;
+}
+
+void MyDB_BufferCounters :: reset () {
+	hits = misses = pins = unpins = 0;
+	cleanEvictions = dirtyEvictions = 0;
+	reads = writes = unpacks = 0;
+	for (int i = 0; i < NUM_LATENCY_BUCKETS; i++) {
+		readLatency[i] = 0;
+		writeLatency[i] = 0;
+	}
+}
+
+// prints the non-empty buckets of a latency histogram on one line
+static void printHistogram (std::ostream &os, const char *what, const vector <long> &histogram) {
+	os << what << " latency:";
+	bool any = false;
+	for (int i = 0; i < NUM_LATENCY_BUCKETS; i++) {
+		if (histogram[i] == 0)
+			continue;
+		any = true;
+		if (i == 0)
+			os << " <1us: ";
+		else if (i == NUM_LATENCY_BUCKETS - 1)
+			os << " >=" << (1L << (i - 1)) << "us: ";
+		else
+			os << " " << (1L << (i - 1)) << "-" << (1L << i) << "us: ";
+		os << histogram[i];
+	}
+	if (!any)
+		os << " none";
+	os << "\n";
+}
+
+// prints one row of the table of counts
+static void printCounts (std::ostream &os, const string &name, const MyDB_BufferCounts &counts) {
+	os << left << setw (16) << name << right
+		<< setw (12) << counts.hits << setw (12) << counts.misses
+		<< setw (10) << counts.pins << setw (10) << counts.unpins
+		<< setw (12) << counts.cleanEvictions << setw (12) << counts.dirtyEvictions
+		<< setw (10) << counts.reads << setw (10) << counts.writes << setw (10) << counts.unpacks << "\n";
+}
+
+std::ostream &operator<<(std::ostream &os, const MyDB_BufferStats &printMe) {
+
+	os << "pool: " << printMe.numPages << " pages of " << printMe.pageSize << " bytes; "
+		<< printMe.numDirty << " dirty, " << printMe.numClean << " clean\n";
+	os << "temp pages: " << printMe.tempAllocations << " created; temp files hold "
+		<< printMe.tempFilePages << " pages (high-water mark " << printMe.tempHighWater << ")\n";
+	for (auto &pool : printMe.subPools) {
+		os << "sub-pool " << pool.first << ": " << pool.second.second << " frames in use, quota ";
+		if (pool.second.first == 0)
+			os << "none\n";
+		else
+			os << pool.second.first << "\n";
+	}
+
+	if (printMe.compressedCapacity > 0)
+		os << "compressed cache: " << printMe.compressedPages << " pages in " << printMe.compressedBytes
+			<< " of " << printMe.compressedCapacity << " bytes\n";
+
+	os << left << setw (16) << "table" << right
+		<< setw (12) << "hits" << setw (12) << "misses"
+		<< setw (10) << "pins" << setw (10) << "unpins"
+		<< setw (12) << "clean evict" << setw (12) << "dirty evict"
+		<< setw (10) << "reads" << setw (10) << "writes" << setw (10) << "unpacked" << "\n";
+	for (auto &table : printMe.tables)
+		printCounts (os, table.first, table.second);
+	printCounts (os, "total", printMe.total);
+
+	printHistogram (os, "read", printMe.total.readLatency);
+	printHistogram (os, "write", printMe.total.writeLatency);
+	return os;
+}
+
+#endif
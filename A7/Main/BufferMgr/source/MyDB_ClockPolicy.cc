@@ -0,0 +1,122 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef CLOCK_POLICY_C
+#define CLOCK_POLICY_C
+
+#include "MyDB_ClockPolicy.h"
+
+MyDB_ClockPolicy :: MyDB_ClockPolicy () {
+	hand = nullptr;
+}
+
+void MyDB_ClockPolicy :: advance () {
+	hand = ring.next (hand);
+	if (hand == nullptr)
+		hand = ring.front ();
+}
+
+void MyDB_ClockPolicy :: pageIn (MyDB_Page *page) {
+
+	// new pages go just behind the hand, so they are the last ones it gets to
+	page->referenced = true;
+	if (hand == nullptr)
+		ring.pushBack (page);
+	else
+		ring.insertBefore (page, hand);
+}
+
+void MyDB_ClockPolicy :: pageAccessed (MyDB_Page *page) {
+	page->referenced = true;
+}
+
+void MyDB_ClockPolicy :: pageUnpinned (MyDB_Page *page) {
+	pageIn (page);
+}
+
+void MyDB_ClockPolicy :: remove (MyDB_Page *page) {
+
+	// don't leave the hand pointing at a page that is not in the ring
+	if (hand == page) {
+		advance ();
+		if (hand == page)
+			hand = nullptr;
+	}
+	ring.remove (page);
+}
+
+void MyDB_ClockPolicy :: getVictims (size_t n, vector <MyDB_Page *> &victims) {
+
+	if (ring.empty ())
+		return;
+
+	// the hand skips over the pages whose bits are set, so the first victim is the first page
+	// after the hand whose bit is not set... if every bit is set, the hand goes all the way
+	// around clearing the bits, and the first victim is the page under the hand
+	MyDB_Page *start = (hand == nullptr ? ring.front () : hand);
+	MyDB_Page *page = start;
+	while (page->referenced) {
+		page = ring.next (page);
+		if (page == nullptr)
+			page = ring.front ();
+		if (page == start)
+			break;
+	}
+
+	// after that come the next few pages that the hand will get to whose bits are not set
+	// (or all of the next few pages, if the hand went all the way around)
+	bool allSet = page->referenced;
+	MyDB_Page *first = page;
+	for (size_t i = 0; i < n && victims.size () < n; i++) {
+		if (allSet || !page->referenced)
+			victims.push_back (page);
+		page = ring.next (page);
+		if (page == nullptr)
+			page = ring.front ();
+		if (page == first)
+			break;
+	}
+}
+
+void MyDB_ClockPolicy :: evict (MyDB_Page *page) {
+
+	if (hand == nullptr)
+		hand = ring.front ();
+
+	// if the page's bit is set, then every page's bit was set, and the hand swept all the way
+	// around the ring, giving every page its second chance
+	if (page->referenced) {
+		for (MyDB_Page *cur = ring.front (); cur != nullptr; cur = ring.next (cur))
+			cur->referenced = false;
+	}
+
+	// the hand sweeps up to the page, clearing the bits of the pages that it passes
+	while (hand != page) {
+		hand->referenced = false;
+		advance ();
+	}
+
+	remove (page);
+}
+
+bool MyDB_ClockPolicy :: contains (MyDB_Page *page) {
+	return ring.contains (page);
+}
+
+size_t MyDB_ClockPolicy :: size () {
+	return ring.size ();
+}
+
+MyDB_ReplacementPolicyPtr MyDB_ClockPolicy :: clone () {
+	return make_shared <MyDB_ClockPolicy> ();
+}
+
+#endif
+
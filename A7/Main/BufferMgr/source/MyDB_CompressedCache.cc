@@ -0,0 +1,115 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef COMPRESSED_CACHE_C
+#define COMPRESSED_CACHE_C
+
+#include "MyDB_CompressedCache.h"
+#include "MyDB_PageCompressor.h"
+
+// a page is only kept if it compresses to at most this fraction of its size... otherwise it
+// takes up too much room for what it saves
+#define MAX_COMPRESSED_FRACTION 0.75
+
+MyDB_CompressedCache :: MyDB_CompressedCache (size_t capacityIn, size_t pageSizeIn) {
+	capacity = capacityIn;
+	pageSize = pageSizeIn;
+	numBytes = 0;
+}
+
+void MyDB_CompressedCache :: setCapacity (size_t capacityIn) {
+	lock_guard <mutex> guard (latch);
+	capacity = capacityIn;
+	trim ();
+}
+
+void MyDB_CompressedCache :: put (MyDB_PageKey whichPage, void *bytes) {
+
+	if (capacity == 0)
+		return;
+
+	// compress the page without holding the latch, so that other threads can use the cache
+	string compressed (pageSize * MAX_COMPRESSED_FRACTION, '\0');
+	size_t size = MyDB_PageCompressor :: compress (bytes, pageSize, &compressed[0], compressed.size ());
+
+	lock_guard <mutex> guard (latch);
+	auto found = index.find (whichPage);
+	if (found != index.end ())
+		remove (found->second);
+	if (size == 0 || size > capacity)
+		return;
+
+	compressed.resize (size);
+	compressed.shrink_to_fit ();
+	entries.push_front (Entry {whichPage, whichPage.first->getStorageLoc (), move (compressed)});
+	index[whichPage] = entries.begin ();
+	numBytes += size;
+	trim ();
+}
+
+bool MyDB_CompressedCache :: get (MyDB_PageKey whichPage, void *bytes) {
+
+	lock_guard <mutex> guard (latch);
+	auto found = index.find (whichPage);
+	if (found == index.end ())
+		return false;
+
+	// a page from a different file with the same table name is of no use
+	list <Entry> :: iterator entry = found->second;
+	bool ok = entry->storageLoc == whichPage.first->getStorageLoc () &&
+		MyDB_PageCompressor :: decompress (entry->compressed.data (), entry->compressed.size (), bytes, pageSize);
+	remove (entry);
+	return ok;
+}
+
+void MyDB_CompressedCache :: erase (MyDB_PageKey whichPage) {
+	lock_guard <mutex> guard (latch);
+	auto found = index.find (whichPage);
+	if (found != index.end ())
+		remove (found->second);
+}
+
+void MyDB_CompressedCache :: eraseTable (MyDB_TablePtr whichTable) {
+	lock_guard <mutex> guard (latch);
+	for (auto entry = entries.begin (); entry != entries.end ();) {
+		auto next = entry;
+		next++;
+		if (entry->whichPage.first->getName () == whichTable->getName ())
+			remove (entry);
+		entry = next;
+	}
+}
+
+size_t MyDB_CompressedCache :: getNumPages () {
+	lock_guard <mutex> guard (latch);
+	return entries.size ();
+}
+
+size_t MyDB_CompressedCache :: getNumBytes () {
+	lock_guard <mutex> guard (latch);
+	return numBytes;
+}
+
+size_t MyDB_CompressedCache :: getCapacity () {
+	return capacity;
+}
+
+void MyDB_CompressedCache :: trim () {
+	while (numBytes > capacity)
+		remove (--entries.end ());
+}
+
+void MyDB_CompressedCache :: remove (list <Entry> :: iterator which) {
+	numBytes -= which->compressed.size ();
+	index.erase (which->whichPage);
+	entries.erase (which);
+}
+
+#endif
@@ -0,0 +1,178 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef FILE_CACHE_C
+#define FILE_CACHE_C
+
+#include <fcntl.h>
+#include <iostream>
+#include "MyDB_FileCache.h"
+#include <thread>
+#include <unistd.h>
+
+MyDB_TableFilePtr MyDB_FileCache :: getFile (MyDB_TablePtr whichTable) {
+
+	// almost always, this table object has asked before
+	pthread_rwlock_rdlock (&latch);
+	auto found = tableFiles.find (whichTable);
+	MyDB_TableFilePtr file = (found == tableFiles.end () ? nullptr : found->second);
+	pthread_rwlock_unlock (&latch);
+	if (file != nullptr)
+		return file;
+
+	// it has not, so look for the file by where it is... unless someone beat us to it
+	pthread_rwlock_wrlock (&latch);
+	MyDB_TableFilePtr &atLoc = files[whichTable->getStorageLoc ()];
+	if (atLoc == nullptr) {
+		atLoc = make_shared <MyDB_TableFile> (whichTable->getStorageLoc (), *this);
+		open (atLoc.get ());
+	}
+	tableFiles[whichTable] = atLoc;
+	file = atLoc;
+	pthread_rwlock_unlock (&latch);
+	return file;
+}
+
+void MyDB_FileCache :: killFile (MyDB_TablePtr whichTable) {
+
+	pthread_rwlock_wrlock (&latch);
+	auto found = files.find (whichTable->getStorageLoc ());
+	if (found == files.end ()) {
+		pthread_rwlock_unlock (&latch);
+		return;
+	}
+	MyDB_TableFilePtr file = found->second;
+	file->killed = true;
+
+	// wait for anyone in the middle of reading or writing the file
+	while (true) {
+		long numUsers = file->users;
+		if (numUsers == CLOSED_FILE)
+			break;
+		if (numUsers == 0 && file->users.compare_exchange_weak (numUsers, CLOSED_FILE)) {
+			close (file->fd);
+			file->fd = -1;
+			numOpen--;
+			break;
+		}
+		this_thread :: yield ();
+	}
+	unlink (file->path.c_str ());
+
+	// and forget about it
+	files.erase (found);
+	for (auto table = tableFiles.begin (); table != tableFiles.end ();) {
+		if (table->second == file)
+			table = tableFiles.erase (table);
+		else
+			table++;
+	}
+	pthread_rwlock_unlock (&latch);
+}
+
+void MyDB_FileCache :: setMaxOpen (size_t maxOpenIn) {
+	pthread_rwlock_wrlock (&latch);
+	maxOpen = maxOpenIn < 1 ? 1 : maxOpenIn;
+	while (numOpen > maxOpen && closeOldest ());
+	pthread_rwlock_unlock (&latch);
+}
+
+size_t MyDB_FileCache :: getMaxOpen () {
+	return maxOpen;
+}
+
+size_t MyDB_FileCache :: getNumOpen () {
+	return numOpen;
+}
+
+void MyDB_FileCache :: setDirectIO (bool direct) {
+	pthread_rwlock_wrlock (&latch);
+	directIO = direct;
+	for (auto &file : files) {
+		if (file.second->users == CLOSED_FILE)
+			continue;
+		int flags = fcntl (file.second->fd, F_GETFL);
+		fcntl (file.second->fd, F_SETFL, direct ? (flags | O_DIRECT) : (flags & ~O_DIRECT));
+	}
+	pthread_rwlock_unlock (&latch);
+}
+
+bool MyDB_FileCache :: reopen (MyDB_TableFile *file) {
+	pthread_rwlock_wrlock (&latch);
+	bool alive = !file->killed;
+	if (alive && file->users == CLOSED_FILE)
+		open (file);
+	pthread_rwlock_unlock (&latch);
+	return alive;
+}
+
+void MyDB_FileCache :: open (MyDB_TableFile *file) {
+
+	// make room
+	while (numOpen >= maxOpen && closeOldest ());
+
+	int flags = O_CREAT | O_RDWR | (directIO ? O_DIRECT : 0);
+	int fd = :: open (file->path.c_str (), flags, 0666);
+
+	// not every file system can do direct I/O
+	if (fd < 0 && directIO) {
+		cout << "Could not open a file for direct I/O; using regular I/O.\n";
+		fd = :: open (file->path.c_str (), flags & ~O_DIRECT, 0666);
+	}
+
+	file->fd = fd;
+	file->lastUse = clock.fetch_add (1, memory_order_relaxed);
+	numOpen++;
+	file->users = 0;
+}
+
+bool MyDB_FileCache :: closeOldest () {
+
+	// someone may start using the file that we pick before we can close it, in which case
+	// we try again
+	while (true) {
+		MyDB_TableFile *oldest = nullptr;
+		for (auto &file : files) {
+			MyDB_TableFile *cur = file.second.get ();
+			if (cur->users == 0 && (oldest == nullptr || cur->lastUse < oldest->lastUse))
+				oldest = cur;
+		}
+		if (oldest == nullptr)
+			return false;
+
+		long idle = 0;
+		if (oldest->users.compare_exchange_strong (idle, CLOSED_FILE)) {
+			close (oldest->fd);
+			oldest->fd = -1;
+			numOpen--;
+			return true;
+		}
+	}
+}
+
+MyDB_FileCache :: MyDB_FileCache (size_t maxOpenIn) {
+	pthread_rwlock_init (&latch, nullptr);
+	maxOpen = maxOpenIn < 1 ? 1 : maxOpenIn;
+	numOpen = 0;
+	directIO = false;
+	clock = 0;
+}
+
+MyDB_FileCache :: ~MyDB_FileCache () {
+	for (auto &file : files) {
+		if (file.second->users != CLOSED_FILE)
+			close (file.second->fd);
+		file.second->users = CLOSED_FILE;
+		file.second->killed = true;
+	}
+	pthread_rwlock_destroy (&latch);
+}
+
+#endif
@@ -0,0 +1,64 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef FRAME_LIST_C
+#define FRAME_LIST_C
+
+#include "MyDB_FrameList.h"
+
+MyDB_FrameList :: MyDB_FrameList (void *baseIn, size_t frameSizeIn, size_t maxFrames, size_t numFrames) : 
+	base ((char *) baseIn), frameSize (frameSizeIn), next (new atomic <uint32_t> [maxFrames]) {
+
+	// chain the frames together, with frame 0 on top
+	for (uint32_t i = 0; i < numFrames; i++)
+		next[i].store (i + 1 < numFrames ? i + 2 : 0);
+
+	head.store (numFrames > 0 ? 1 : 0);
+	numFree.store (numFrames);
+}
+
+void MyDB_FrameList :: push (void *frame) {
+
+	uint32_t me = (((char *) frame) - base) / frameSize + 1;
+	uint64_t oldHead = head.load ();
+	uint64_t newHead;
+	do {
+		next[me - 1].store ((uint32_t) oldHead);
+		newHead = (((oldHead >> 32) + 1) << 32) | me;
+	} while (!head.compare_exchange_weak (oldHead, newHead));
+
+	numFree++;
+}
+
+void *MyDB_FrameList :: pop () {
+
+	uint64_t oldHead = head.load ();
+	while (true) {
+
+		uint32_t top = (uint32_t) oldHead;
+		if (top == 0)
+			return nullptr;
+
+		// if another thread changed the stack since we read the head, the counter
+		// will not match and the swap fails, so a stale value here does no harm
+		uint64_t newHead = (((oldHead >> 32) + 1) << 32) | next[top - 1].load ();
+		if (head.compare_exchange_weak (oldHead, newHead)) {
+			numFree--;
+			return base + (top - 1) * frameSize;
+		}
+	}
+}
+
+size_t MyDB_FrameList :: size () {
+	long result = numFree.load ();
+	return result < 0 ? 0 : result;
+}
+
+#endif
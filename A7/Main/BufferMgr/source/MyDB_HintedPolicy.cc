@@ -0,0 +1,111 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef HINTED_POLICY_C
+#define HINTED_POLICY_C
+
+#include "MyDB_HintedPolicy.h"
+
+MyDB_HintedPolicy :: MyDB_HintedPolicy (MyDB_ReplacementPolicyPtr innerIn) {
+	inner = innerIn;
+}
+
+MyDB_PageList *MyDB_HintedPolicy :: listFor (MyDB_Page *page) {
+	if (page->hint == SequentialAccess)
+		return &scanned;
+	if (page->hint == KeepHotAccess)
+		return &hot;
+	return nullptr;
+}
+
+void MyDB_HintedPolicy :: setNumFrames (size_t numFrames) {
+	inner->setNumFrames (numFrames);
+}
+
+void MyDB_HintedPolicy :: pageIn (MyDB_Page *page) {
+	MyDB_PageList *list = listFor (page);
+	if (list != nullptr)
+		list->pushFront (page);
+	else
+		inner->pageIn (page);
+}
+
+void MyDB_HintedPolicy :: pageAccessed (MyDB_Page *page) {
+
+	// see if the page is still where its hint says it belongs
+	MyDB_PageList *list = listFor (page);
+	if (list != nullptr && list->contains (page)) {
+		list->moveToFront (page);
+		return;
+	}
+	if (list == nullptr && inner->contains (page)) {
+		inner->pageAccessed (page);
+		return;
+	}
+
+	// its hint has changed, so move it over
+	remove (page);
+	pageIn (page);
+}
+
+void MyDB_HintedPolicy :: pageUnpinned (MyDB_Page *page) {
+	MyDB_PageList *list = listFor (page);
+	if (list != nullptr)
+		list->pushFront (page);
+	else
+		inner->pageUnpinned (page);
+}
+
+void MyDB_HintedPolicy :: remove (MyDB_Page *page) {
+	if (scanned.contains (page))
+		scanned.remove (page);
+	else if (hot.contains (page))
+		hot.remove (page);
+	else
+		inner->remove (page);
+}
+
+void MyDB_HintedPolicy :: getVictims (size_t n, vector <MyDB_Page *> &victims) {
+
+	// the pages from scans go first, oldest first, and then whatever the wrapped policy picks
+	size_t numAtStart = victims.size ();
+	for (MyDB_Page *page = scanned.back (); page != nullptr && victims.size () < n; page = scanned.prev (page))
+		victims.push_back (page);
+	inner->getVictims (n, victims);
+
+	// the hot pages are only offered up if there is nothing else
+	if (victims.size () == numAtStart) {
+		for (MyDB_Page *page = hot.back (); page != nullptr && victims.size () < n; page = hot.prev (page))
+			victims.push_back (page);
+	}
+}
+
+void MyDB_HintedPolicy :: evict (MyDB_Page *page) {
+	if (scanned.contains (page))
+		scanned.remove (page);
+	else if (hot.contains (page))
+		hot.remove (page);
+	else
+		inner->evict (page);
+}
+
+bool MyDB_HintedPolicy :: contains (MyDB_Page *page) {
+	return scanned.contains (page) || hot.contains (page) || inner->contains (page);
+}
+
+size_t MyDB_HintedPolicy :: size () {
+	return scanned.size () + hot.size () + inner->size ();
+}
+
+MyDB_ReplacementPolicyPtr MyDB_HintedPolicy :: clone () {
+	return make_shared <MyDB_HintedPolicy> (inner->clone ());
+}
+
+#endif
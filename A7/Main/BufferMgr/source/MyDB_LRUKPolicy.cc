@@ -0,0 +1,122 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef LRUK_POLICY_C
+#define LRUK_POLICY_C
+
+#include "MyDB_LRUKPolicy.h"
+
+MyDB_LRUKPolicy :: MyDB_LRUKPolicy (size_t kIn, long correlatedPeriodIn) {
+	k = kIn < 1 ? 1 : kIn;
+	correlatedPeriod = correlatedPeriodIn;
+	currentTick = 0;
+	maxRetained = 0;
+	nextSeqNum = 0;
+}
+
+void MyDB_LRUKPolicy :: setNumFrames (size_t numFrames) {
+	maxRetained = numFrames;
+}
+
+pair <pair <long, long>, MyDB_Page *> MyDB_LRUKPolicy :: getKey (MyDB_Page *page) {
+
+	// a page with fewer than K accesses has an infinite backward K-distance
+	long kthAccess = 0;
+	if (page->history.size () >= k)
+		kthAccess = page->history[k - 1];
+	return make_pair (make_pair (kthAccess, page->history[0]), page);
+}
+
+void MyDB_LRUKPolicy :: recordAccess (MyDB_Page *page) {
+	page->history.insert (page->history.begin (), ++currentTick);
+	if (page->history.size () > k)
+		page->history.resize (k);
+	candidates.insert (getKey (page));
+}
+
+void MyDB_LRUKPolicy :: pageIn (MyDB_Page *page) {
+
+	// see if we remember this page from the last time it was buffered
+	page->history.clear ();
+	if (page->myTable != nullptr) {
+		auto found = retained.find (make_pair (page->myTable, page->pos));
+		if (found != retained.end ()) {
+			page->history = found->second.second;
+			retained.erase (found);
+		}
+	}
+
+	recordAccess (page);
+}
+
+void MyDB_LRUKPolicy :: pageAccessed (MyDB_Page *page) {
+	candidates.erase (getKey (page));
+
+	// an access that comes right on the heels of the last one (for example, the next
+	// record on a page that is being scanned) is not counted as a new reference
+	if (currentTick - page->history[0] <= correlatedPeriod) {
+		page->history[0] = ++currentTick;
+		candidates.insert (getKey (page));
+		return;
+	}
+
+	recordAccess (page);
+}
+
+void MyDB_LRUKPolicy :: pageUnpinned (MyDB_Page *page) {
+	recordAccess (page);
+}
+
+void MyDB_LRUKPolicy :: remove (MyDB_Page *page) {
+	candidates.erase (getKey (page));
+}
+
+void MyDB_LRUKPolicy :: getVictims (size_t n, vector <MyDB_Page *> &victims) {
+	for (auto it = candidates.begin (); it != candidates.end () && victims.size () < n; it++)
+		victims.push_back (it->second);
+}
+
+void MyDB_LRUKPolicy :: evict (MyDB_Page *victim) {
+
+	candidates.erase (getKey (victim));
+
+	// hold onto the history of the victim, in case it comes back soon
+	if (victim->myTable != nullptr && maxRetained > 0) {
+		MyDB_PageKey whichPage = make_pair (victim->myTable, victim->pos);
+		retained[whichPage] = make_pair (nextSeqNum, victim->history);
+		retainedOrder.push_back (make_pair (whichPage, nextSeqNum++));
+
+		// and forget the oldest histories... entries in retainedOrder whose page has
+		// since come back into the buffer (or been evicted again) are just dropped
+		while (retained.size () > maxRetained || retainedOrder.size () > 2 * maxRetained) {
+			auto found = retained.find (retainedOrder.front ().first);
+			if (found != retained.end () && found->second.first == retainedOrder.front ().second)
+				retained.erase (found);
+			retainedOrder.pop_front ();
+		}
+	}
+}
+
+bool MyDB_LRUKPolicy :: contains (MyDB_Page *page) {
+	if (page->history.empty ())
+		return false;
+	return candidates.count (getKey (page)) != 0;
+}
+
+size_t MyDB_LRUKPolicy :: size () {
+	return candidates.size ();
+}
+
+MyDB_ReplacementPolicyPtr MyDB_LRUKPolicy :: clone () {
+	return make_shared <MyDB_LRUKPolicy> (k, correlatedPeriod);
+}
+
+#endif
+
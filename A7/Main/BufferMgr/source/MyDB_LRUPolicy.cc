@@ -0,0 +1,54 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef LRU_POLICY_C
+#define LRU_POLICY_C
+
+#include "MyDB_LRUPolicy.h"
+
+void MyDB_LRUPolicy :: pageIn (MyDB_Page *page) {
+	lastUsed.pushFront (page);
+}
+
+void MyDB_LRUPolicy :: pageAccessed (MyDB_Page *page) {
+	lastUsed.moveToFront (page);
+}
+
+void MyDB_LRUPolicy :: pageUnpinned (MyDB_Page *page) {
+	lastUsed.pushFront (page);
+}
+
+void MyDB_LRUPolicy :: remove (MyDB_Page *page) {
+	lastUsed.remove (page);
+}
+
+void MyDB_LRUPolicy :: getVictims (size_t n, vector <MyDB_Page *> &victims) {
+	for (MyDB_Page *page = lastUsed.back (); page != nullptr && victims.size () < n; page = lastUsed.prev (page))
+		victims.push_back (page);
+}
+
+void MyDB_LRUPolicy :: evict (MyDB_Page *page) {
+	lastUsed.remove (page);
+}
+
+bool MyDB_LRUPolicy :: contains (MyDB_Page *page) {
+	return lastUsed.contains (page);
+}
+
+size_t MyDB_LRUPolicy :: size () {
+	return lastUsed.size ();
+}
+
+MyDB_ReplacementPolicyPtr MyDB_LRUPolicy :: clone () {
+	return make_shared <MyDB_LRUPolicy> ();
+}
+
+#endif
+
@@ -0,0 +1,42 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef MEMORY_GRANT_C
+#define MEMORY_GRANT_C
+
+#include "MyDB_BufferManager.h"
+#include "MyDB_MemoryGrant.h"
+
+size_t MyDB_MemoryGrant :: getNumFrames () {
+	lock_guard <mutex> guard (parent.grantLatch);
+	return numFrames;
+}
+
+size_t MyDB_MemoryGrant :: getNumUsed () {
+	lock_guard <mutex> guard (parent.grantLatch);
+	return numUsed;
+}
+
+size_t MyDB_MemoryGrant :: grow (size_t numMore) {
+	return parent.grantFrames (*this, numMore);
+}
+
+void MyDB_MemoryGrant :: release () {
+	parent.releaseFrames (*this);
+}
+
+MyDB_MemoryGrant :: MyDB_MemoryGrant (MyDB_BufferManager &parentIn) :
+	parent (parentIn), numFrames (0), numUsed (0) {}
+
+MyDB_MemoryGrant :: ~MyDB_MemoryGrant () {
+	release ();
+}
+
+#endif
@@ -16,27 +16,64 @@
 #include "MyDB_Page.h"
 #include "MyDB_Table.h"
 
-void *MyDB_Page :: getBytes (MyDB_PagePtr me) {
-	parent.access (me);	
+void *MyDB_Page :: getBytes () {
+	parent.access (this);	
 	return bytes;
 }
 
 void MyDB_Page :: wroteBytes () {
-	isDirty = true;
+	if (!isDirty.exchange (true))
+		parent.numDirty++;
+}
+
+void MyDB_Page :: discard () {
+	parent.discardPage (this);
 }
 
 MyDB_Page :: ~MyDB_Page () {}
 
-MyDB_Page :: MyDB_Page (MyDB_TablePtr myTableIn, size_t iin, MyDB_BufferManager &parentIn) : 
-	parent (parentIn), myTable (myTableIn), pos (iin) { 
+MyDB_Page :: MyDB_Page (MyDB_BufferManager &parentIn) : parent (parentIn) {
+	refCount = 0;
+	useCount = 0;
+	bytes = nullptr;
+	listNext = nullptr;
+}
+
+void MyDB_Page :: init (MyDB_TablePtr myTableIn, size_t iin) {
+	myTable = myTableIn;
+	pos = iin;
 	bytes = nullptr;
+	numBytes = 0;
 	isDirty = false;	
-	refCount = 0;
-	timeTick = -1;
+	listPrev = nullptr;
+	listNext = nullptr;
+	myList = nullptr;
+	referenced = false;
+	hot = false;
+	hint = NormalAccess;
+	wasWritten = false;
+	dead = false;
+	grant = nullptr;
+	shard = parent.pickShard (myTable, pos);
+	counters = parent.getCounters (myTable);
+	file = (myTable == nullptr ? nullptr : parent.fileCache->getFile (myTable));
+}
+
+void MyDB_Page :: clear () {
+	myTable = nullptr;
+	file = nullptr;
+	tempFile = nullptr;
+	mappedFile = nullptr;
+	grant = nullptr;
+	history.clear ();
+}
+
+void MyDB_Page :: killpage () {
+	parent.killPage (this);
 }
 
-void MyDB_Page :: killpage (MyDB_PagePtr me) {
-	parent.killPage (me);
+void MyDB_Page :: recycle () {
+	parent.pagePool->put (this);
 }
 
 MyDB_BufferManager &MyDB_Page :: getParent () {
@@ -0,0 +1,193 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef PAGE_COMPRESSOR_C
+#define PAGE_COMPRESSOR_C
+
+#include <cstring>
+#include <stdint.h>
+#include "MyDB_PageCompressor.h"
+
+// the number of bits in the hash of four bytes that is used to find earlier matches
+#define HASH_BITS 12
+
+// the shortest match, and the furthest back that a match can start
+#define MIN_MATCH 4
+#define MAX_OFFSET 65535
+
+// no match runs into the last this many bytes, so that the four-byte reads stay in bounds
+#define END_LITERALS 5
+
+static inline uint32_t read32 (const unsigned char *p) {
+	uint32_t value;
+	memcpy (&value, p, sizeof (value));
+	return value;
+}
+
+static inline uint32_t hashOf (uint32_t value) {
+	return (value * 2654435761U) >> (32 - HASH_BITS);
+}
+
+// writes out the part of a length that did not fit into its four bits of the token
+static unsigned char *putLength (unsigned char *op, size_t len) {
+	for (; len >= 255; len -= 255)
+		*op++ = 255;
+	*op++ = (unsigned char) len;
+	return op;
+}
+
+// reads in the rest of a length whose four bits in the token were all set
+static bool getLength (const unsigned char *&ip, const unsigned char *iend, size_t &len) {
+	unsigned char next;
+	do {
+		if (ip == iend)
+			return false;
+		next = *ip++;
+		len += next;
+	} while (next == 255);
+	return true;
+}
+
+// the most bytes that a sequence with the given number of literals and match length can take
+static size_t worstCase (size_t litLen, size_t matchLen) {
+	return 1 + (litLen / 255 + 1) + litLen + 2 + (matchLen / 255 + 1);
+}
+
+size_t MyDB_PageCompressor :: compress (const void *in, size_t len, void *out, size_t capacity) {
+
+	const unsigned char *src = (const unsigned char *) in;
+	const unsigned char *ip = src;
+	const unsigned char *anchor = src;
+	const unsigned char *end = src + len;
+	unsigned char *op = (unsigned char *) out;
+	unsigned char *oend = op + capacity;
+
+	// where the last four bytes with each hash value were seen
+	uint32_t lastSeen[1 << HASH_BITS];
+	memset (lastSeen, 0, sizeof (lastSeen));
+
+	if (len > MIN_MATCH + END_LITERALS) {
+		const unsigned char *lastMatchStart = end - END_LITERALS - MIN_MATCH;
+		const unsigned char *matchLimit = end - END_LITERALS;
+		while (ip <= lastMatchStart) {
+
+			uint32_t seq = read32 (ip);
+			uint32_t hash = hashOf (seq);
+			const unsigned char *ref = src + lastSeen[hash];
+			lastSeen[hash] = (uint32_t) (ip - src);
+
+			// no match, so move on... the longer we go without one, the bigger the steps, so
+			// that we don't waste much time on data that does not compress
+			if (ref >= ip || ip - ref > MAX_OFFSET || read32 (ref) != seq) {
+				ip += 1 + ((ip - anchor) >> 6);
+				continue;
+			}
+
+			// extend the match forward, and then backward over the pending literals
+			size_t matchLen = MIN_MATCH;
+			while (ip + matchLen < matchLimit && ref[matchLen] == ip[matchLen])
+				matchLen++;
+			while (ip > anchor && ref > src && ip[-1] == ref[-1]) {
+				ip--;
+				ref--;
+				matchLen++;
+			}
+
+			// write out the sequence
+			size_t litLen = ip - anchor;
+			if ((size_t) (oend - op) < worstCase (litLen, matchLen))
+				return 0;
+			unsigned char *token = op++;
+			*token = (unsigned char) ((litLen >= 15 ? 15 : litLen) << 4);
+			if (litLen >= 15)
+				op = putLength (op, litLen - 15);
+			memcpy (op, anchor, litLen);
+			op += litLen;
+
+			size_t offset = ip - ref;
+			*op++ = (unsigned char) (offset & 255);
+			*op++ = (unsigned char) (offset >> 8);
+			size_t extra = matchLen - MIN_MATCH;
+			*token |= (unsigned char) (extra >= 15 ? 15 : extra);
+			if (extra >= 15)
+				op = putLength (op, extra - 15);
+
+			ip += matchLen;
+			anchor = ip;
+		}
+	}
+
+	// and the last of the literals
+	size_t litLen = end - anchor;
+	if ((size_t) (oend - op) < worstCase (litLen, 0))
+		return 0;
+	*op++ = (unsigned char) ((litLen >= 15 ? 15 : litLen) << 4);
+	if (litLen >= 15)
+		op = putLength (op, litLen - 15);
+	memcpy (op, anchor, litLen);
+	op += litLen;
+
+	return op - (unsigned char *) out;
+}
+
+bool MyDB_PageCompressor :: decompress (const void *in, size_t inLen, void *out, size_t outLen) {
+
+	const unsigned char *ip = (const unsigned char *) in;
+	const unsigned char *iend = ip + inLen;
+	unsigned char *start = (unsigned char *) out;
+	unsigned char *op = start;
+	unsigned char *oend = op + outLen;
+
+	while (ip < iend) {
+
+		// copy over the literals
+		unsigned char token = *ip++;
+		size_t litLen = token >> 4;
+		if (litLen == 15 && !getLength (ip, iend, litLen))
+			return false;
+		if ((size_t) (iend - ip) < litLen || (size_t) (oend - op) < litLen)
+			return false;
+		memcpy (op, ip, litLen);
+		ip += litLen;
+		op += litLen;
+
+		// the last sequence has no match
+		if (ip == iend)
+			break;
+
+		if (iend - ip < 2)
+			return false;
+		size_t offset = ip[0] | (ip[1] << 8);
+		ip += 2;
+		size_t matchLen = token & 15;
+		if (matchLen == 15 && !getLength (ip, iend, matchLen))
+			return false;
+		matchLen += MIN_MATCH;
+		if (offset == 0 || offset > (size_t) (op - start) || (size_t) (oend - op) < matchLen)
+			return false;
+
+		// a match can overlap the bytes that it produces (a run of one byte has an offset of one),
+		// so it is copied in pieces that each end before they start... the bytes repeat every
+		// offset bytes, so every piece can be copied from the start of the match
+		const unsigned char *match = op - offset;
+		for (size_t copied = 0; copied < matchLen;) {
+			size_t piece = offset + copied;
+			if (piece > matchLen - copied)
+				piece = matchLen - copied;
+			memcpy (op + copied, match, piece);
+			copied += piece;
+		}
+		op += matchLen;
+	}
+
+	return op == oend;
+}
+
+#endif
@@ -0,0 +1,71 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef PAGE_POOL_C
+#define PAGE_POOL_C
+
+#include "MyDB_PagePool.h"
+
+MyDB_PagePool :: MyDB_PagePool (MyDB_BufferManager &parentIn, size_t maxFreeIn) : parent (parentIn) {
+	freePages = nullptr;
+	numFree = 0;
+	maxFree = maxFreeIn;
+}
+
+MyDB_PagePool :: ~MyDB_PagePool () {
+	while (freePages != nullptr) {
+		MyDB_Page *next = freePages->listNext;
+		delete freePages;
+		freePages = next;
+	}
+}
+
+MyDB_PagePtr MyDB_PagePool :: get (MyDB_TablePtr whichTable, size_t i) {
+
+	MyDB_Page *page = nullptr;
+	{
+		lock_guard <mutex> guard (latch);
+		if (freePages != nullptr) {
+			page = freePages;
+			freePages = page->listNext;
+			numFree--;
+		}
+	}
+
+	// there is no unused object, so we make one
+	if (page == nullptr)
+		page = new MyDB_Page (parent);
+
+	page->init (whichTable, i);
+	return MyDB_PagePtr (page);
+}
+
+void MyDB_PagePool :: put (MyDB_Page *page) {
+
+	// the page may be holding on to its table, its temp file, or a mapping, none of which
+	// should be kept around just because the object is
+	page->clear ();
+
+	lock_guard <mutex> guard (latch);
+	if (numFree >= maxFree) {
+		delete page;
+		return;
+	}
+	page->listNext = freePages;
+	freePages = page;
+	numFree++;
+}
+
+size_t MyDB_PagePool :: getNumFree () {
+	lock_guard <mutex> guard (latch);
+	return numFree;
+}
+
+#endif
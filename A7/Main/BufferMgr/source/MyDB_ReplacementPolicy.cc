@@ -0,0 +1,51 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef REPLACEMENT_POLICY_C
+#define REPLACEMENT_POLICY_C
+
+#include "MyDB_ClockPolicy.h"
+#include "MyDB_LRUKPolicy.h"
+#include "MyDB_LRUPolicy.h"
+#include "MyDB_ReplacementPolicy.h"
+#include "MyDB_TwoQPolicy.h"
+
+// accesses to the same page that are this close together are counted as one by LRU-K... this
+// covers reading all of the records on one page, even when the reads are interleaved with
+// reads from a handful of other pages (such as in a merge)
+#define LRUK_CORRELATED_PERIOD 16
+
+MyDB_ReplacementPolicyPtr MyDB_ReplacementPolicy :: makePolicy (string name) {
+
+	if (name == "lru")
+		return make_shared <MyDB_LRUPolicy> ();
+	else if (name == "clock")
+		return make_shared <MyDB_ClockPolicy> ();
+	else if (name == "lru2")
+		return make_shared <MyDB_LRUKPolicy> (2, LRUK_CORRELATED_PERIOD);
+	else if (name == "2q")
+		return make_shared <MyDB_TwoQPolicy> ();
+
+	return nullptr;
+}
+
+MyDB_Page *MyDB_ReplacementPolicy :: pickVictim () {
+
+	vector <MyDB_Page *> victims;
+	getVictims (1, victims);
+	if (victims.empty ())
+		return nullptr;
+
+	evict (victims[0]);
+	return victims[0];
+}
+
+#endif
+
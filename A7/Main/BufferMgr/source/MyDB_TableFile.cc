@@ -0,0 +1,69 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef TABLE_FILE_C
+#define TABLE_FILE_C
+
+#include "MyDB_FileCache.h"
+#include "MyDB_TableFile.h"
+
+int MyDB_TableFile :: use () {
+
+	// almost always, the file is open, and we just need to count ourselves in
+	while (true) {
+		long numUsers = users;
+		if (numUsers != CLOSED_FILE) {
+			if (users.compare_exchange_weak (numUsers, numUsers + 1))
+				break;
+		} else if (!cache.reopen (this)) {
+			return -1;
+		}
+	}
+
+	// a file that could not be opened is no use to anyone
+	if (fd < 0) {
+		users--;
+		return -1;
+	}
+
+	lastUse = cache.clock.fetch_add (1, memory_order_relaxed);
+	return fd;
+}
+
+void MyDB_TableFile :: done () {
+	users--;
+}
+
+string &MyDB_TableFile :: getPath () {
+	return path;
+}
+
+MyDB_TableFile :: MyDB_TableFile (string pathIn, MyDB_FileCache &cacheIn) : path (pathIn), cache (cacheIn) {
+	fd = -1;
+	users = CLOSED_FILE;
+	lastUse = 0;
+	killed = false;
+}
+
+MyDB_FileUse :: MyDB_FileUse (MyDB_TableFile *fileIn) {
+	fd = fileIn == nullptr ? -1 : fileIn->use ();
+	file = fd < 0 ? nullptr : fileIn;
+}
+
+MyDB_FileUse :: ~MyDB_FileUse () {
+	if (file != nullptr)
+		file->done ();
+}
+
+int MyDB_FileUse :: getFD () {
+	return fd;
+}
+
+#endif
@@ -0,0 +1,120 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef TEMP_FILE_C
+#define TEMP_FILE_C
+
+#include <cstdlib>
+#include <fcntl.h>
+#include <iostream>
+#include <unistd.h>
+#include "MyDB_TempFile.h"
+
+size_t MyDB_TempFile :: allocate () {
+
+	lock_guard <mutex> guard (latch);
+	if (fds.empty ())
+		open ();
+
+	// reuse the lowest free position, so that the end of the file can be cut off
+	if (!freePositions.empty ()) {
+		size_t pos = *freePositions.begin ();
+		freePositions.erase (freePositions.begin ());
+		return pos;
+	}
+
+	numFilePages++;
+	return lastPos++;
+}
+
+void MyDB_TempFile :: free (size_t pos, bool wasWritten) {
+
+	lock_guard <mutex> guard (latch);
+	freePositions.insert (pos);
+
+	// if the page was at the end of the file, cut the file back to the last page in use
+	if (pos + 1 == lastPos) {
+		while (lastPos > 0 && freePositions.count (lastPos - 1) > 0) {
+			freePositions.erase (lastPos - 1);
+			lastPos--;
+			numFilePages--;
+		}
+		truncate ();
+		return;
+	}
+
+	// otherwise, give its space back without changing the size of the file
+	if (wasWritten && canPunch) {
+		if (fallocate (getFD (pos), FALLOC_FL_PUNCH_HOLE | FALLOC_FL_KEEP_SIZE, getOffset (pos), pageSize) != 0)
+			canPunch = false;
+	}
+}
+
+int MyDB_TempFile :: getFD (size_t pos) {
+	return fds[pos % fds.size ()];
+}
+
+off_t MyDB_TempFile :: getOffset (size_t pos) {
+	return (off_t) (pos / fds.size ()) * pageSize;
+}
+
+size_t MyDB_TempFile :: getNumPages () {
+	lock_guard <mutex> guard (latch);
+	return lastPos;
+}
+
+void MyDB_TempFile :: setDirectIO (bool direct) {
+	lock_guard <mutex> guard (latch);
+	directIO = direct;
+	for (int fd : fds) {
+		int flags = fcntl (fd, F_GETFL);
+		fcntl (fd, F_SETFL, direct ? (flags | O_DIRECT) : (flags & ~O_DIRECT));
+	}
+}
+
+void MyDB_TempFile :: open () {
+	for (string &path : paths) {
+		int flags = O_CREAT | O_RDWR | O_TRUNC;
+		int fd = :: open (path.c_str (), flags | (directIO ? O_DIRECT : 0), 0666);
+
+		// not every file system can do direct I/O
+		if (fd < 0 && directIO) {
+			cout << "Could not open a temp file for direct I/O; using regular I/O.\n";
+			fd = :: open (path.c_str (), flags, 0666);
+		}
+		if (fd < 0) {
+			cout << "Could not open temp file " << path << "!!\n";
+			exit (1);
+		}
+		fds.push_back (fd);
+	}
+}
+
+void MyDB_TempFile :: truncate () {
+	for (size_t i = 0; i < fds.size (); i++) {
+		size_t numPages = lastPos > i ? (lastPos - 1 - i) / fds.size () + 1 : 0;
+		if (ftruncate (fds[i], numPages * pageSize) != 0)
+			cout << "Could not shrink temp file " << paths[i] << ".\n";
+	}
+}
+
+MyDB_TempFile :: MyDB_TempFile (vector <string> pathsIn, size_t pageSizeIn, bool directIOIn,
+	atomic <long> &numFilePagesIn) : paths (pathsIn), pageSize (pageSizeIn), directIO (directIOIn),
+	lastPos (0), canPunch (true), numFilePages (numFilePagesIn) {}
+
+MyDB_TempFile :: ~MyDB_TempFile () {
+	numFilePages -= lastPos;
+	for (size_t i = 0; i < fds.size (); i++) {
+		close (fds[i]);
+		unlink (paths[i].c_str ());
+	}
+}
+
+#endif
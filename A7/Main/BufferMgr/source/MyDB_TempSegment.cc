@@ -0,0 +1,34 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef TEMP_SEGMENT_C
+#define TEMP_SEGMENT_C
+
+#include "MyDB_BufferManager.h"
+#include "MyDB_TempSegment.h"
+
+size_t MyDB_TempSegment :: getNumPages () {
+	return file == nullptr ? 0 : file->getNumPages ();
+}
+
+void MyDB_TempSegment :: end () {
+	if (file != nullptr)
+		parent.endTempSegment (file);
+	file = nullptr;
+}
+
+MyDB_TempSegment :: MyDB_TempSegment (MyDB_BufferManager &parentIn, MyDB_TempFilePtr fileIn) :
+	parent (parentIn), file (fileIn) {}
+
+MyDB_TempSegment :: ~MyDB_TempSegment () {
+	end ();
+}
+
+#endif
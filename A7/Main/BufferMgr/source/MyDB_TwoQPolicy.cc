@@ -0,0 +1,133 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A1.  You should not be looking at this file     **
+** unless you have completed A1!                   **
+****************************************************/
+
+#ifndef TWOQ_POLICY_C
+#define TWOQ_POLICY_C
+
+#include "MyDB_TwoQPolicy.h"
+
+MyDB_TwoQPolicy :: MyDB_TwoQPolicy () {
+	nextSeqNum = 0;
+	kIn = 1;
+	kOut = 1;
+}
+
+void MyDB_TwoQPolicy :: setNumFrames (size_t numFrames) {
+
+	// these are the settings recommended in the 2Q paper
+	kIn = numFrames / 4;
+	kOut = numFrames / 2;
+	if (kIn < 1)
+		kIn = 1;
+	if (kOut < 1)
+		kOut = 1;
+}
+
+void MyDB_TwoQPolicy :: admit (MyDB_Page *page) {
+
+	// a page that was recently kicked out of A1in has now been accessed twice, so it is hot
+	if (!page->hot && page->myTable != nullptr) {
+		auto found = a1out.find (make_pair (page->myTable, page->pos));
+		if (found != a1out.end ()) {
+			a1out.erase (found);
+			page->hot = true;
+		}
+	}
+
+	if (page->hot)
+		am.pushFront (page);
+	else
+		a1in.pushFront (page);
+}
+
+void MyDB_TwoQPolicy :: pageIn (MyDB_Page *page) {
+
+	// pages that were evicted from Am start over
+	page->hot = false;
+	admit (page);
+}
+
+void MyDB_TwoQPolicy :: pageAccessed (MyDB_Page *page) {
+
+	// accesses to a page in A1in are treated as correlated with the first one, so
+	// it stays where it is in the FIFO
+	if (am.contains (page))
+		am.moveToFront (page);
+}
+
+void MyDB_TwoQPolicy :: pageUnpinned (MyDB_Page *page) {
+	admit (page);
+}
+
+void MyDB_TwoQPolicy :: remove (MyDB_Page *page) {
+	if (am.contains (page))
+		am.remove (page);
+	else
+		a1in.remove (page);
+}
+
+void MyDB_TwoQPolicy :: rememberGhost (MyDB_Page *page) {
+
+	// temp pages are never looked up again by position, so there is no point
+	if (page->myTable == nullptr)
+		return;
+
+	MyDB_PageKey whichPage = make_pair (page->myTable, page->pos);
+	a1out[whichPage] = nextSeqNum;
+	a1outOrder.push_back (make_pair (whichPage, nextSeqNum++));
+
+	// trim the ghost queue... entries in the FIFO whose page has since been
+	// readmitted (or been evicted again) are just dropped
+	while (a1out.size () > kOut || a1outOrder.size () > 2 * kOut) {
+		auto found = a1out.find (a1outOrder.front ().first);
+		if (found != a1out.end () && found->second == a1outOrder.front ().second)
+			a1out.erase (found);
+		a1outOrder.pop_front ();
+	}
+}
+
+void MyDB_TwoQPolicy :: getVictims (size_t n, vector <MyDB_Page *> &victims) {
+
+	// pages come from A1in while it is over its target size (or if there is nothing else)
+	MyDB_Page *page = a1in.back ();
+	size_t numFromA1in = (am.empty () ? a1in.size () : (a1in.size () > kIn ? a1in.size () - kIn : 0));
+	for (size_t i = 0; i < numFromA1in && victims.size () < n; i++, page = a1in.prev (page))
+		victims.push_back (page);
+
+	// then the LRU pages from Am, and then the rest of A1in
+	for (MyDB_Page *cur = am.back (); cur != nullptr && victims.size () < n; cur = am.prev (cur))
+		victims.push_back (cur);
+	for (; page != nullptr && victims.size () < n; page = a1in.prev (page))
+		victims.push_back (page);
+}
+
+void MyDB_TwoQPolicy :: evict (MyDB_Page *page) {
+	if (am.contains (page)) {
+		am.remove (page);
+	} else {
+		a1in.remove (page);
+		rememberGhost (page);
+	}
+}
+
+bool MyDB_TwoQPolicy :: contains (MyDB_Page *page) {
+	return a1in.contains (page) || am.contains (page);
+}
+
+size_t MyDB_TwoQPolicy :: size () {
+	return a1in.size () + am.size ();
+}
+
+MyDB_ReplacementPolicyPtr MyDB_TwoQPolicy :: clone () {
+	return make_shared <MyDB_TwoQPolicy> ();
+}
+
+#endif
+
@@ -2,12 +2,16 @@
 #ifndef CATALOG_UNIT_H
 #define CATALOG_UNIT_H
 
+#include <fcntl.h>
+#include <sys/stat.h>
 #include "MyDB_BufferManager.h"
 #include "MyDB_PageHandle.h"
 #include "MyDB_Table.h"
 #include "QUnit.h"
+#include <atomic>
 #include <cstring>
 #include <iostream>
+#include <thread>
 #include <time.h>
 #include <unistd.h>
 #include <vector>
@@ -271,6 +275,786 @@ int main () {
 	}
 	cout << "COMPLETE" << endl << flush;
 	QUNIT_IS_TRUE(flag9);
+
+	// rolling temp and rolling table pages, under every replacement policy
+	cout << "TEST 10..." << flush;
+	bool flag10 = true;
+	for (string policy : {"lru", "clock", "lru2", "2q"}) {
+		cout << policy << "..." << flush;
+		MyDB_BufferManager myMgr(64, 16, "tempDSFSD", MyDB_ReplacementPolicy::makePolicy(policy));
+		MyDB_TablePtr table1 = make_shared <MyDB_Table>("table1", "file1");
+		vector<MyDB_PageHandle> pages(100);
+		for (int i = 0; i < 100; i++) {
+			pages[i] = (i % 2 == 0) ? myMgr.getPage() : myMgr.getPage(table1, i);
+			char *bytes = (char *)pages[i]->getBytes();
+			memset(bytes, (char)('!' + i), 64);
+			pages[i]->wroteBytes();
+		}
+		for (int j = 0; j < 3; j++) {
+			for (int i = 0; i < 100; i += 1 + j) {
+				char *bytes = (char *)pages[i]->getBytes();
+				for (int k = 0; k < 64; k++) {
+					if (bytes[k] != (char)('!' + i)) flag10 = false;
+				}
+			}
+		}
+	}
+	if (flag10) cout << "correct..." << flush;
+	else cout << "INCORRECT..." << flush;
+	cout << "COMPLETE" << endl << flush;
+	QUNIT_IS_TRUE(flag10);
+
+	// a big scan should not flush a set of hot pages out of a scan-resistant policy...
+	// after the scan, the hot pages are changed on disk behind the buffer manager's back,
+	// so a hot page that is still buffered will come back with its old contents
+	cout << "TEST 11..." << flush;
+	for (string policy : {"lru", "clock", "lru2", "2q"}) {
+		cout << policy << "..." << flush;
+		char hot[64], changed[64];
+		memset(hot, 'H', 64);
+		memset(changed, 'X', 64);
+		int fd = open("file3", O_CREAT | O_TRUNC | O_RDWR, 0666);
+		for (int i = 0; i < 6; i++)
+			pwrite(fd, hot, 64, i * 64);
+
+		int numStillBuffered = 0;
+		{
+			MyDB_BufferManager myMgr(64, 16, "tempDSFSD", MyDB_ReplacementPolicy::makePolicy(policy));
+			MyDB_TablePtr table3 = make_shared <MyDB_Table>("table3", "file3");
+
+			// touch the hot pages twice, with some other work in between
+			for (int i = 0; i < 6; i++)
+				myMgr.getPage(table3, i)->getBytes();
+			for (int i = 100; i < 116; i++)
+				myMgr.getPage(table3, i)->getBytes();
+			for (int i = 0; i < 6; i++)
+				myMgr.getPage(table3, i)->getBytes();
+
+			// now the scan
+			for (int i = 1000; i < 2000; i++)
+				myMgr.getPage(table3, i)->getBytes();
+
+			// and see who is still around
+			for (int i = 0; i < 6; i++)
+				pwrite(fd, changed, 64, i * 64);
+			for (int i = 0; i < 6; i++) {
+				char *bytes = (char *)myMgr.getPage(table3, i)->getBytes();
+				if (bytes[0] == 'H') numStillBuffered++;
+			}
+		}
+		close(fd);
+		cout << numStillBuffered << " hot pages left..." << flush;
+		if (policy == "lru2" || policy == "2q") {
+			QUNIT_IS_EQUAL(numStillBuffered, 6);
+		} else {
+			QUNIT_IS_EQUAL(numStillBuffered, 0);
+		}
+	}
+	unlink("file3");
+	cout << "COMPLETE" << endl << flush;
+
+	// a bunch of threads share one small, sharded pool... each thread reads shared table
+	// pages (pinned, so the bytes can't go away while they are checked), writes and checks
+	// pages of a table that only it writes, and uses temp pages
+	cout << "TEST 12..." << flush;
+	{
+		char pageData[64];
+		int fd = open("file4", O_CREAT | O_TRUNC | O_RDWR, 0666);
+		for (int i = 0; i < 256; i++) {
+			memset(pageData, (char)('!' + i % 90), 64);
+			pwrite(fd, pageData, 64, i * 64);
+		}
+		close(fd);
+
+		atomic <bool> flag12(true);
+		{
+			MyDB_BufferManager myMgr(64, 64, "tempDSFSD", MyDB_ReplacementPolicy::makePolicy("lru"), 4);
+			MyDB_TablePtr table4 = make_shared <MyDB_Table>("table4", "file4");
+			MyDB_TablePtr table5 = make_shared <MyDB_Table>("table5", "file5");
+			vector<thread> threads;
+			for (int t = 0; t < 8; t++) {
+				threads.push_back(thread([&myMgr, &flag12, table4, table5, t] () {
+					unsigned int state = t + 1;
+					vector<char> lastWritten(16, 0);
+					for (int j = 0; j < 4000; j++) {
+						state = state * 1103515245 + 12345;
+						int which = (state >> 8) % 256;
+						int mine = (state >> 8) % 16;
+						switch ((state >> 20) % 4) {
+						case 0: {
+							MyDB_PageHandle page = myMgr.getPinnedPage(table4, which);
+							char *bytes = (char *)page->getBytes();
+							for (int k = 0; k < 64; k++)
+								if (bytes[k] != (char)('!' + which % 90)) flag12 = false;
+							break;
+						}
+						case 1: {
+							myMgr.getPage(table4, which)->getBytes();
+							break;
+						}
+						case 2: {
+							MyDB_PageHandle page = myMgr.getPinnedPage(table5, mine * 8 + t);
+							char *bytes = (char *)page->getBytes();
+							for (int k = 0; k < 64 && lastWritten[mine] != 0; k++)
+								if (bytes[k] != lastWritten[mine]) flag12 = false;
+							lastWritten[mine] = (char)('a' + j % 26);
+							memset(bytes, lastWritten[mine], 64);
+							page->wroteBytes();
+							break;
+						}
+						case 3: {
+							MyDB_PageHandle page = myMgr.getPinnedPage();
+							char *bytes = (char *)page->getBytes();
+							memset(bytes, (char)t, 64);
+							page->wroteBytes();
+							for (int k = 0; k < 64; k++)
+								if (bytes[k] != (char)t) flag12 = false;
+							break;
+						}
+						}
+					}
+				}));
+			}
+			for (auto &thread : threads)
+				thread.join();
+		}
+		unlink("file4");
+		unlink("file5");
+		if (flag12) cout << "correct..." << flush;
+		else cout << "INCORRECT..." << flush;
+		cout << "COMPLETE" << endl << flush;
+		QUNIT_IS_TRUE(flag12);
+	}
+
+	// the flusher should write dirty pages back without their being evicted, and a page
+	// miss should pick a clean victim over a dirty one
+	cout << "TEST 13..." << flush;
+	{
+		MyDB_BufferManager myMgr(64, 16, "tempDSFSD");
+		MyDB_TablePtr table6 = make_shared <MyDB_Table>("table6", "file6");
+
+		// eight dirty pages, and then eight clean ones
+		myMgr.setFlusher(0, 0);
+		for (int i = 0; i < 16; i++) {
+			MyDB_PageHandle page = myMgr.getPage(table6, i);
+			char *bytes = (char *)page->getBytes();
+			if (i < 8) {
+				memset(bytes, (char)('a' + i), 64);
+				page->wroteBytes();
+			}
+		}
+		QUNIT_IS_EQUAL(myMgr.getNumDirty(), 8);
+		QUNIT_IS_EQUAL(myMgr.getNumClean(), 8);
+
+		// the dirty pages are the least recently used, but the clean ones go first
+		for (int i = 16; i < 24; i++)
+			myMgr.getPage(table6, i)->getBytes();
+		QUNIT_IS_EQUAL(myMgr.getNumDirty(), 8);
+
+		// now let the flusher clean everything
+		myMgr.setFlusher(1.0, 1);
+		for (int i = 0; i < 1000 && myMgr.getNumDirty() > 0; i++)
+			usleep(1000);
+		QUNIT_IS_EQUAL(myMgr.getNumDirty(), 0);
+		QUNIT_IS_EQUAL(myMgr.getNumClean(), 16);
+
+		// and the data should be on disk
+		bool flag13 = true;
+		int fd = open("file6", O_RDONLY);
+		char pageData[64];
+		for (int i = 0; i < 8; i++) {
+			pread(fd, pageData, 64, i * 64);
+			for (int k = 0; k < 64; k++)
+				if (pageData[k] != (char)('a' + i)) flag13 = false;
+		}
+		close(fd);
+		QUNIT_IS_TRUE(flag13);
+	}
+	unlink("file6");
+	cout << "COMPLETE" << endl << flush;
+
+	// flushing a table writes all of its dirty pages (and only its dirty pages) back, even when
+	// they were written in a scattered order and are spread over several runs in the file
+	cout << "TEST 14..." << flush;
+	{
+		MyDB_BufferManager myMgr(64, 256, "tempDSFSD");
+		MyDB_TablePtr table7 = make_shared <MyDB_Table>("table7", "file7");
+		MyDB_TablePtr table8 = make_shared <MyDB_Table>("table8", "file8");
+		for (int i = 0; i < 200; i++) {
+			int which = (i * 37) % 200;
+			if (which % 50 == 49) continue;
+			MyDB_PageHandle page = myMgr.getPage(i % 2 == 0 ? table7 : table8, which);
+			memset(page->getBytes(), (char)('0' + which % 64), 64);
+			page->wroteBytes();
+		}
+		QUNIT_IS_EQUAL(myMgr.getNumDirty(), 196);
+
+		myMgr.flushTable(table7);
+		QUNIT_IS_EQUAL(myMgr.getNumDirty(), 96);
+		myMgr.flushAll();
+		QUNIT_IS_EQUAL(myMgr.getNumDirty(), 0);
+
+		bool flag14 = true;
+		char pageData[64];
+		int fd7 = open("file7", O_RDONLY), fd8 = open("file8", O_RDONLY);
+		for (int i = 0; i < 200; i++) {
+			int which = (i * 37) % 200;
+			if (which % 50 == 49) continue;
+			pread(i % 2 == 0 ? fd7 : fd8, pageData, 64, which * 64);
+			for (int k = 0; k < 64; k++)
+				if (pageData[k] != (char)('0' + which % 64)) flag14 = false;
+		}
+		close(fd7);
+		close(fd8);
+		QUNIT_IS_TRUE(flag14);
+	}
+	unlink("file7");
+	unlink("file8");
+	cout << "COMPLETE" << endl << flush;
+
+	// the frames come from one aligned chunk of RAM, and pages written and read with direct
+	// I/O (which bypasses the OS cache, and needs that alignment) make it to disk and back
+	cout << "TEST 15..." << flush;
+	{
+		bool flag15 = true;
+		{
+			MyDB_BufferManager myMgr(4096, 64, "tempDSFSD");
+			myMgr.setDirectIO(true);
+			MyDB_TablePtr table9 = make_shared <MyDB_Table>("table9", "file9");
+			for (int i = 0; i < 200; i++) {
+				MyDB_PageHandle page = myMgr.getPage(table9, i);
+				char *bytes = (char *)page->getBytes();
+				if (((size_t) bytes) % 4096 != 0) flag15 = false;
+				memset(bytes, (char)('A' + i % 26), 4096);
+				page->wroteBytes();
+			}
+		}
+		{
+			MyDB_BufferManager myMgr(4096, 16, "tempDSFSD");
+			myMgr.setDirectIO(true);
+			MyDB_TablePtr table9 = make_shared <MyDB_Table>("table9", "file9");
+			for (int i = 199; i >= 0; i--) {
+				char *bytes = (char *)myMgr.getPage(table9, i)->getBytes();
+				for (int k = 0; k < 4096; k++)
+					if (bytes[k] != (char)('A' + i % 26)) flag15 = false;
+			}
+		}
+		QUNIT_IS_TRUE(flag15);
+	}
+	unlink("file9");
+	cout << "COMPLETE" << endl << flush;
+
+	// the pages of a read-only table point into a mapping of its file, so that any number of
+	// them can be pinned at once without using up the pool; once the table is writable again,
+	// new handles see new writes, while the old ones still see the old mapping
+	cout << "TEST 16..." << flush;
+	{
+		MyDB_BufferManager myMgr(64, 4, "tempDSFSD");
+		MyDB_TablePtr table10 = make_shared <MyDB_Table>("table10", "file10");
+		for (int i = 0; i < 100; i++) {
+			MyDB_PageHandle page = myMgr.getPage(table10, i);
+			memset(page->getBytes(), (char)('a' + i % 26), 64);
+			page->wroteBytes();
+		}
+		myMgr.setReadOnly(table10, true);
+
+		bool flag16 = true;
+		vector <MyDB_PageHandle> pinned;
+		for (int i = 0; i < 100; i++) {
+			MyDB_PageHandle page = myMgr.getPinnedPage(table10, i);
+			if (page == nullptr) {
+				flag16 = false;
+				break;
+			}
+			char *bytes = (char *)page->getBytes();
+			for (int k = 0; k < 64; k++)
+				if (bytes[k] != (char)('a' + i % 26)) flag16 = false;
+			pinned.push_back(page);
+		}
+		QUNIT_IS_TRUE(flag16);
+		QUNIT_IS_EQUAL(myMgr.getNumDirty(), 0);
+
+		myMgr.setReadOnly(table10, false);
+		MyDB_PageHandle page = myMgr.getPage(table10, 3);
+		memset(page->getBytes(), 'Z', 64);
+		page->wroteBytes();
+		QUNIT_IS_EQUAL(((char *)pinned[3]->getBytes())[0], 'd');
+		pinned.clear();
+
+		myMgr.setReadOnly(table10, true);
+		QUNIT_IS_EQUAL(((char *)myMgr.getPage(table10, 3)->getBytes())[0], 'Z');
+	}
+	unlink("file10");
+	cout << "COMPLETE" << endl << flush;
+
+	// the stats count every hit, miss, pin, unpin, eviction, and write, under the right table
+	cout << "TEST 17..." << flush;
+	{
+		MyDB_BufferManager myMgr(64, 8, "tempDSFSD");
+		MyDB_TablePtr table11 = make_shared <MyDB_Table>("table11", "file11");
+
+		// 16 misses, the last 8 of which kick out a dirty page, and then 8 hits
+		for (int i = 0; i < 16; i++) {
+			MyDB_PageHandle page = myMgr.getPage(table11, i);
+			memset(page->getBytes(), 'A', 64);
+			page->wroteBytes();
+		}
+		for (int i = 8; i < 16; i++)
+			myMgr.getPage(table11, i)->getBytes();
+
+		// one more miss and dirty eviction, for a pin that is later dropped
+		myMgr.getPinnedPage(table11, 0);
+
+		vector <MyDB_PageHandle> temps;
+		for (int i = 0; i < 3; i++)
+			temps.push_back(myMgr.getPage());
+
+		// the last 7 dirty pages are adjacent, so they go out in one write
+		myMgr.flushAll();
+
+		MyDB_BufferStats stats = myMgr.stats();
+		MyDB_BufferCounts &counts = stats.tables["table11"];
+		long numWriteCalls = 0;
+		for (long bucket : stats.total.writeLatency)
+			numWriteCalls += bucket;
+		bool flag17 = counts.hits == 8 && counts.misses == 17 && counts.reads == 17 &&
+			counts.pins == 1 && counts.unpins == 1 && counts.cleanEvictions == 0 &&
+			counts.dirtyEvictions == 9 && counts.writes == 16 && numWriteCalls == 10 &&
+			stats.tempAllocations == 3 && stats.tempHighWater == 3 && stats.total.hits == 8;
+		if (!flag17)
+			cout << stats << flush;
+		QUNIT_IS_TRUE(flag17);
+
+		myMgr.resetStats();
+		QUNIT_IS_EQUAL(myMgr.stats().total.misses, 0);
+	}
+	unlink("file11");
+	cout << "COMPLETE" << endl << flush;
+
+	// grants never add up to more frames than can be pinned (less the few that are kept back),
+	// and pinned pages reduce what can be granted
+	cout << "TEST 18..." << flush;
+	{
+		MyDB_BufferManager myMgr(64, 64, "tempDSFSD");
+		size_t numGrantable = myMgr.getNumGrantableFrames();
+		MyDB_MemoryGrantPtr grant1 = myMgr.reserveFrames(50);
+		MyDB_MemoryGrantPtr grant2 = myMgr.reserveFrames(50);
+		bool flag18 = numGrantable == 60 && grant1->getNumFrames() == 50 && grant2->getNumFrames() == 10 &&
+			myMgr.getNumGrantableFrames() == 0;
+
+		vector <MyDB_PageHandle> pinned;
+		for (int i = 0; i < 20; i++)
+			pinned.push_back(myMgr.getPinnedPage(grant1));
+		grant1->release();
+		flag18 = flag18 && myMgr.getNumGrantableFrames() == 30 && grant2->grow(100) == 30;
+		QUNIT_IS_TRUE(flag18);
+
+		grant2 = nullptr;
+		pinned.clear();
+		QUNIT_IS_EQUAL(myMgr.getNumGrantableFrames(), 60);
+	}
+
+	// the frames of a grant can only be pinned through it, and a page that can't get a frame
+	// is reported to the caller
+	{
+		MyDB_BufferManager myMgr(64, 16, "tempDSFSD");
+		MyDB_MemoryGrantPtr grant = myMgr.reserveFrames(8);
+		bool flag18 = grant->getNumFrames() == 8;
+
+		vector <MyDB_PageHandle> pinned;
+		for (int i = 0; i < 8; i++)
+			pinned.push_back(myMgr.getPinnedPage());
+		flag18 = flag18 && pinned[7] != nullptr && myMgr.getPinnedPage() == nullptr;
+
+		vector <MyDB_PageHandle> granted;
+		for (int i = 0; i < 8; i++)
+			granted.push_back(myMgr.getPinnedPage(grant));
+		flag18 = flag18 && granted[7] != nullptr && grant->getNumUsed() == 8 && myMgr.getPinnedPage(grant) == nullptr;
+		flag18 = flag18 && myMgr.getPage()->getBytes() == nullptr;
+
+		granted.clear();
+		flag18 = flag18 && grant->getNumUsed() == 0 && myMgr.getPinnedPage() == nullptr;
+		grant = nullptr;
+		flag18 = flag18 && myMgr.getPinnedPage() != nullptr;
+		QUNIT_IS_TRUE(flag18);
+	}
+	cout << "COMPLETE" << endl << flush;
+
+	// the pool can shrink (writing back the pages that it kicks out, but never the pinned
+	// ones) and grow again, and a sub-pool with a quota never takes more frames than that
+	cout << "TEST 19..." << flush;
+	{
+		MyDB_BufferManager myMgr(64, 16, "tempDSFSD");
+		MyDB_TablePtr table12 = make_shared <MyDB_Table>("table12", "file12");
+		MyDB_TablePtr table13 = make_shared <MyDB_Table>("table13", "file13");
+
+		vector <MyDB_PageHandle> pinned;
+		for (int i = 0; i < 16; i++) {
+			pinned.push_back(myMgr.getPinnedPage(table12, i));
+			memset(pinned[i]->getBytes(), 'a' + i, 64);
+			pinned[i]->wroteBytes();
+		}
+		bool flag19 = myMgr.setNumPages(8) == 16;
+		pinned.clear();
+		flag19 = flag19 && myMgr.setNumPages(8) == 8 && myMgr.getNumPages() == 8;
+		for (int i = 0; i < 16; i++)
+			flag19 = flag19 && ((char *)myMgr.getPage(table12, i)->getBytes())[63] == 'a' + i;
+
+		flag19 = flag19 && myMgr.setNumPages(32) == 32;
+		for (int i = 0; i < 32; i++)
+			pinned.push_back(myMgr.getPinnedPage(table12, i));
+		flag19 = flag19 && pinned[31] != nullptr && myMgr.setNumPages(1000) == 16 * MAX_POOL_GROWTH;
+		pinned.clear();
+		QUNIT_IS_TRUE(flag19);
+
+		myMgr.setSubPool("small", 4);
+		bool flag20 = myMgr.useSubPool(table13, "small") && !myMgr.useSubPool(table13, "nosuchpool");
+		for (int i = 0; i < 20; i++)
+			myMgr.getPage(table13, i)->getBytes();
+		MyDB_BufferStats stats = myMgr.stats();
+		flag20 = flag20 && stats.subPools["small"].second == 4 && stats.subPools[DEFAULT_SUB_POOL].second == 32;
+
+		// moving a table's buffered pages into a sub-pool that can't hold them kicks some out
+		flag20 = flag20 && myMgr.useSubPool(table12, "small");
+		stats = myMgr.stats();
+		flag20 = flag20 && stats.subPools["small"].second == 4 && stats.subPools[DEFAULT_SUB_POOL].second == 0;
+		if (!flag20)
+			cout << stats << flush;
+		QUNIT_IS_TRUE(flag20);
+	}
+	unlink("file12");
+	unlink("file13");
+	cout << "COMPLETE" << endl << flush;
+
+	// dead temp pages give their space back (the file is cut short if they were at its end),
+	// a query's temp segment is deleted once it is over and its pages are gone, and temp
+	// pages can be striped over several directories
+	cout << "TEST 20..." << flush;
+	{
+		MyDB_BufferManager myMgr(64, 4, "tempDSFSD");
+		vector <MyDB_PageHandle> temps;
+		for (int i = 0; i < 8; i++) {
+			temps.push_back(myMgr.getPage());
+			memset(temps[i]->getBytes(), 'a' + i, 64);
+			temps[i]->wroteBytes();
+		}
+		struct stat info;
+		bool flag21 = myMgr.stats().tempFilePages == 8 && stat("tempDSFSD", &info) == 0 && info.st_size == 4 * 64;
+		temps[7] = nullptr;
+		temps[6] = nullptr;
+		temps[2] = nullptr;
+		flag21 = flag21 && myMgr.stats().tempFilePages == 6 && stat("tempDSFSD", &info) == 0 && info.st_size == 6 * 64;
+		temps[2] = myMgr.getPage();
+		flag21 = flag21 && myMgr.stats().tempFilePages == 6 && ((char *)temps[0]->getBytes())[0] == 'a';
+		QUNIT_IS_TRUE(flag21);
+
+		MyDB_TempSegmentPtr segment = myMgr.startTempSegment();
+		vector <MyDB_PageHandle> segmentTemps;
+		for (int i = 0; i < 6; i++) {
+			segmentTemps.push_back(myMgr.getPage());
+			memset(segmentTemps[i]->getBytes(), 'A' + i, 64);
+			segmentTemps[i]->wroteBytes();
+		}
+		bool flag22 = segment->getNumPages() == 6 && myMgr.stats().tempFilePages == 12 &&
+			stat("tempDSFSD.1", &info) == 0 && ((char *)segmentTemps[0]->getBytes())[0] == 'A';
+		segment = nullptr;
+		temps.push_back(myMgr.getPage());
+		flag22 = flag22 && myMgr.stats().tempFilePages == 13;
+		segmentTemps.clear();
+		flag22 = flag22 && myMgr.stats().tempFilePages == 7 && stat("tempDSFSD.1", &info) != 0;
+		QUNIT_IS_TRUE(flag22);
+
+		mkdir("spill1", 0777);
+		mkdir("spill2", 0777);
+		myMgr.setSpillDirectories({"spill1", "spill2"});
+		vector <MyDB_PageHandle> spilled;
+		for (int i = 0; i < 8; i++) {
+			spilled.push_back(myMgr.getPage());
+			memset(spilled[i]->getBytes(), '0' + i, 64);
+			spilled[i]->wroteBytes();
+		}
+		bool flag23 = stat("spill1/tempDSFSD.2", &info) == 0 && info.st_size >= 2 * 64 &&
+			stat("spill2/tempDSFSD.2", &info) == 0 && info.st_size >= 2 * 64;
+		for (int i = 0; i < 8; i++)
+			flag23 = flag23 && ((char *)spilled[i]->getBytes())[63] == '0' + i;
+		QUNIT_IS_TRUE(flag23);
+	}
+	rmdir("spill1");
+	rmdir("spill2");
+	cout << "COMPLETE" << endl << flush;
+
+	// the dirty pages of a killed table, and temp pages that were discarded, are dropped from
+	// the pool right away and never written
+	cout << "TEST 21..." << flush;
+	{
+		MyDB_BufferManager myMgr(64, 8, "tempDSFSD");
+		MyDB_TablePtr table14 = make_shared <MyDB_Table>("table14", "file14");
+		vector <MyDB_PageHandle> pages;
+		for (int i = 0; i < 4; i++) {
+			pages.push_back(myMgr.getPage(table14, i));
+			memset(pages[i]->getBytes(), 'k', 64);
+			pages[i]->wroteBytes();
+		}
+		pages.push_back(myMgr.getPinnedPage(table14, 4));
+		pages[4]->wroteBytes();
+		myMgr.killTable(table14);
+		struct stat info;
+		bool flag24 = myMgr.getNumDirty() == 0 && myMgr.getNumClean() == 1 && stat("file14", &info) != 0;
+		pages.clear();
+		flag24 = flag24 && myMgr.getNumClean() == 0 && myMgr.stats().tables["table14"].writes == 0;
+		QUNIT_IS_TRUE(flag24);
+
+		vector <MyDB_PageHandle> temps;
+		for (int i = 0; i < 8; i++) {
+			temps.push_back(myMgr.getPage());
+			memset(temps[i]->getBytes(), 't', 64);
+			temps[i]->wroteBytes();
+		}
+		for (int i = 0; i < 6; i++)
+			temps[i]->discard();
+		bool flag25 = myMgr.getNumDirty() == 2 && myMgr.getNumClean() == 0;
+
+		// only two of the pages that get kicked out to make room for these were not discarded
+		for (int i = 0; i < 8; i++) {
+			temps.push_back(myMgr.getPage());
+			memset(temps.back()->getBytes(), 'u', 64);
+			temps.back()->wroteBytes();
+		}
+		flag25 = flag25 && myMgr.stats().tables[TEMP_PAGES_NAME].writes == 2;
+		QUNIT_IS_TRUE(flag25);
+	}
+	unlink("file14");
+	cout << "COMPLETE" << endl << flush;
+
+	// the pages that were buffered when one buffer manager was shut down can be read back
+	// in by the next one, so that asking for them is a hit
+	cout << "TEST 22..." << flush;
+	{
+		MyDB_TablePtr table15 = make_shared <MyDB_Table>("table15", "file15");
+		MyDB_TablePtr table16 = make_shared <MyDB_Table>("table16", "file16");
+		{
+			MyDB_BufferManager myMgr(64, 16, "tempDSFSD");
+			for (int i = 0; i < 12; i++) {
+				MyDB_PageHandle page = myMgr.getPage(table15, i);
+				memset(page->getBytes(), 'a' + i, 64);
+				page->wroteBytes();
+			}
+			for (int i = 0; i < 2; i++) {
+				MyDB_PageHandle page = myMgr.getPage(table16, i);
+				memset(page->getBytes(), 'z', 64);
+				page->wroteBytes();
+			}
+			myMgr.flushAll();
+			myMgr.saveResidentPages("warmDSFSD");
+		}
+
+		// table16 is not listed, so it is not preloaded; only 8 of table15's pages fit
+		MyDB_BufferManager myMgr(64, 8, "tempDSFSD");
+		map <string, MyDB_TablePtr> tables;
+		tables["table15"] = table15;
+		myMgr.preload("warmDSFSD", tables);
+		myMgr.waitForPreload();
+		MyDB_BufferStats stats = myMgr.stats();
+		bool flag26 = stats.tables["table15"].reads == 8 && stats.tables.count("table16") == 0;
+		for (int i = 0; i < 8; i++)
+			flag26 = flag26 && ((char *)myMgr.getPage(table15, i)->getBytes())[0] == 'a' + i;
+		stats = myMgr.stats();
+		flag26 = flag26 && stats.tables["table15"].hits == 8 && stats.tables["table15"].misses == 0;
+		if (!flag26)
+			cout << stats << flush;
+		QUNIT_IS_TRUE(flag26);
+	}
+	unlink("file15");
+	unlink("file16");
+	unlink("warmDSFSD");
+	cout << "COMPLETE" << endl << flush;
+
+	// a scan whose pages are marked as read-once only recycles a frame or two, and hot pages
+	// outlast any kind of scan, under every replacement policy
+	cout << "TEST 23..." << flush;
+	bool flag27 = true;
+	for (string policy : {"lru", "clock", "lru2", "2q"}) {
+		cout << policy << "..." << flush;
+		MyDB_BufferManager myMgr(64, 8, "tempDSFSD", MyDB_ReplacementPolicy::makePolicy(policy));
+		MyDB_TablePtr table17 = make_shared <MyDB_Table>("table17", "file17");
+		for (int i = 0; i < 4; i++)
+			myMgr.getPage(table17, i, KeepHotAccess)->getBytes();
+		for (int i = 4; i < 6; i++)
+			myMgr.getPage(table17, i)->getBytes();
+
+		// a read-once scan does not disturb anybody, even when it goes over buffered pages
+		for (int i = 4; i < 30; i++)
+			myMgr.getPage(table17, i, SequentialAccess)->getBytes();
+		myMgr.resetStats();
+		for (int i = 0; i < 6; i++)
+			myMgr.getPage(table17, i)->getBytes();
+		flag27 = flag27 && myMgr.stats().tables["table17"].misses == 0;
+
+		// an ordinary scan pushes out the ordinary pages, but not the hot ones
+		for (int i = 30; i < 50; i++)
+			myMgr.getPage(table17, i)->getBytes();
+		myMgr.resetStats();
+		for (int i = 0; i < 4; i++)
+			myMgr.getPage(table17, i, KeepHotAccess)->getBytes();
+		flag27 = flag27 && myMgr.stats().tables["table17"].misses == 0;
+		myMgr.getPage(table17, 4)->getBytes();
+		flag27 = flag27 && myMgr.stats().tables["table17"].misses == 1;
+	}
+	unlink("file17");
+	QUNIT_IS_TRUE(flag27);
+	cout << "COMPLETE" << endl << flush;
+
+	// with the compressed cache on, pages that were kicked out come back without a read from
+	// disk, pages that don't compress are not kept, and a killed table's pages are dropped
+	cout << "TEST 24..." << flush;
+	{
+		MyDB_BufferManager myMgr(64, 4, "tempDSFSD");
+		myMgr.setCompressedCache(4096);
+		MyDB_TablePtr table18 = make_shared <MyDB_Table>("table18", "file18");
+		for (int i = 0; i < 16; i++) {
+			MyDB_PageHandle page = myMgr.getPage(table18, i);
+			char *bytes = (char *)page->getBytes();
+			memset(bytes, 'a' + i, 64);
+			if (i == 15) {
+				for (int j = 0; j < 64; j++)
+					bytes[j] = (char)(j * 7919 % 251);
+			}
+			page->wroteBytes();
+		}
+		myMgr.flushAll();
+		bool flag28 = myMgr.stats().compressedPages == 12;
+
+		// 12 of the pages come out of the compressed cache, and the rest are still buffered
+		myMgr.resetStats();
+		for (int i = 0; i < 12; i++)
+			flag28 = flag28 && ((char *)myMgr.getPage(table18, i)->getBytes())[63] == 'a' + i;
+		MyDB_BufferStats stats = myMgr.stats();
+		flag28 = flag28 && stats.tables["table18"].reads == 0 && stats.tables["table18"].unpacks == 12;
+
+		// the page full of noise was not kept, so it is read from disk
+		myMgr.resetStats();
+		flag28 = flag28 && ((char *)myMgr.getPage(table18, 15)->getBytes())[1] == (char)(7919 % 251);
+		flag28 = flag28 && myMgr.stats().tables["table18"].reads == 1;
+		QUNIT_IS_TRUE(flag28);
+
+		myMgr.killTable(table18);
+		bool flag29 = myMgr.stats().compressedPages == 0;
+		myMgr.setCompressedCache(0);
+		QUNIT_IS_TRUE(flag29);
+	}
+	unlink("file18");
+	cout << "COMPLETE" << endl << flush;
+
+	// a copy of a handle keeps the page pinned until the last copy goes, a moved-from handle
+	// refers to nothing, and page objects that are reused from the pool start out clean
+	cout << "TEST 25..." << flush;
+	{
+		MyDB_BufferManager myMgr(64, 32, "tempDSFSD");
+		MyDB_TablePtr table19 = make_shared <MyDB_Table>("table19", "file19");
+		MyDB_TablePtr table20 = make_shared <MyDB_Table>("table20", "file20");
+		size_t numGrantable = myMgr.getNumGrantableFrames();
+
+		MyDB_PageHandle first = myMgr.getPinnedPage(table19, 0);
+		MyDB_PageHandle copy = first;
+		first = nullptr;
+		bool flag30 = first == nullptr && copy != nullptr && myMgr.getNumGrantableFrames() == numGrantable - 1;
+		MyDB_PageHandle moved = std::move(copy);
+		flag30 = flag30 && copy == nullptr && myMgr.getNumGrantableFrames() == numGrantable - 1;
+		moved = nullptr;
+		flag30 = flag30 && myMgr.getNumGrantableFrames() == numGrantable;
+		QUNIT_IS_TRUE(flag30);
+
+		// page objects of both tables and temp pages keep getting recycled
+		for (int i = 0; i < 200; i++) {
+			MyDB_PageHandle page = myMgr.getPage(i % 2 == 0 ? table19 : table20, i);
+			memset(page->getBytes(), 'a' + i % 26, 64);
+			page->wroteBytes();
+			MyDB_PageHandle temp = myMgr.getPage();
+			memset(temp->getBytes(), 'z', 64);
+			temp->wroteBytes();
+		}
+		bool flag31 = true;
+		for (int i = 0; i < 200; i++) {
+			MyDB_PageHandle page = myMgr.getPage(i % 2 == 0 ? table19 : table20, i);
+			flag31 = flag31 && ((char *)page->getBytes())[63] == 'a' + i % 26;
+		}
+		QUNIT_IS_TRUE(flag31);
+	}
+	unlink("file19");
+	unlink("file20");
+	cout << "COMPLETE" << endl << flush;
+
+	// a batch of pages comes back in order, with each page read once, and pinned if asked
+	cout << "TEST 26..." << flush;
+	{
+		MyDB_TablePtr table21 = make_shared <MyDB_Table>("table21", "file21");
+		{
+			MyDB_BufferManager myMgr(64, 64, "tempDSFSD");
+			for (int i = 0; i < 40; i++) {
+				MyDB_PageHandle page = myMgr.getPage(table21, i);
+				memset(page->getBytes(), 'a' + i % 26, 64);
+				page->wroteBytes();
+			}
+		}
+
+		MyDB_BufferManager myMgr(64, 64, "tempDSFSD");
+		vector <long> positions;
+		for (int i = 39; i >= 0; i -= 3)
+			positions.push_back(i);
+		vector <MyDB_PageHandle> pages = myMgr.getPages(table21, positions);
+		MyDB_BufferStats stats = myMgr.stats();
+		bool flag32 = pages.size() == positions.size() && (size_t) stats.tables["table21"].reads == positions.size() &&
+			(size_t) stats.tables["table21"].misses == positions.size();
+		for (size_t i = 0; i < pages.size(); i++)
+			flag32 = flag32 && ((char *)pages[i]->getBytes())[63] == 'a' + positions[i] % 26;
+		flag32 = flag32 && (size_t) myMgr.stats().tables["table21"].reads == positions.size();
+		QUNIT_IS_TRUE(flag32);
+
+		size_t numGrantable = myMgr.getNumGrantableFrames();
+		pages = myMgr.getPinnedPages(table21, positions);
+		bool flag33 = myMgr.getNumGrantableFrames() == numGrantable - positions.size() &&
+			(size_t) myMgr.stats().tables["table21"].reads == positions.size();
+		pages.clear();
+		flag33 = flag33 && myMgr.getNumGrantableFrames() == numGrantable;
+		QUNIT_IS_TRUE(flag33);
+	}
+	unlink("file21");
+	cout << "COMPLETE" << endl << flush;
+
+	// no more than the allowed number of table files are open at once, and a file that was
+	// closed to make room is opened again when its pages are needed
+	cout << "TEST 27..." << flush;
+	{
+		vector <MyDB_TablePtr> tables;
+		for (int t = 0; t < 6; t++)
+			tables.push_back(make_shared <MyDB_Table>("table" + to_string(22 + t), "file" + to_string(22 + t)));
+		bool flag34 = true;
+		{
+			MyDB_BufferManager myMgr(64, 8, "tempDSFSD");
+			myMgr.setMaxOpenFiles(2);
+			for (int i = 0; i < 60; i++) {
+				MyDB_PageHandle page = myMgr.getPage(tables[i % 6], i / 6);
+				memset(page->getBytes(), 'a' + i % 26, 64);
+				page->wroteBytes();
+				flag34 = flag34 && myMgr.getNumOpenFiles() <= 2;
+			}
+		}
+		QUNIT_IS_TRUE(flag34);
+
+		MyDB_BufferManager myMgr(64, 8, "tempDSFSD");
+		myMgr.setMaxOpenFiles(3);
+		bool flag35 = true;
+		for (int i = 59; i >= 0; i--) {
+			MyDB_PageHandle page = myMgr.getPage(tables[i % 6], i / 6);
+			flag35 = flag35 && ((char *)page->getBytes())[63] == 'a' + i % 26 && myMgr.getNumOpenFiles() <= 3;
+		}
+		myMgr.killTable(tables[0]);
+		flag35 = flag35 && access("file22", F_OK) != 0 && myMgr.getNumOpenFiles() <= 3;
+		QUNIT_IS_TRUE(flag35);
+	}
+	for (int t = 22; t < 28; t++)
+		unlink(("file" + to_string(t)).c_str());
+	cout << "COMPLETE" << endl << flush;
 }
 
 #endif
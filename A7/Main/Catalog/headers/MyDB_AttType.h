@@ -24,6 +24,10 @@ public:
 	virtual MyDB_AttValPtr createAttMax () = 0;
 	virtual string toString () = 0;
 	virtual bool isBool () = 0;
+
+	// the number of bytes that a value of this type takes up in a serialized record (including
+	// its length), or -1 if that depends on the value
+	virtual int getBinarySize () = 0;
 };
 
 class MyDB_IntAttType : public MyDB_AttType {
@@ -50,6 +54,10 @@ public:
 		return false;
 	}
 
+	int getBinarySize () {
+		return sizeof (short) + sizeof (int);
+	}
+
 	MyDB_AttValPtr createAtt () {
 		return make_shared <MyDB_IntAttVal> ();
 	}	
@@ -86,6 +94,10 @@ public:
 		return false;
 	}
 
+	int getBinarySize () {
+		return sizeof (short) + sizeof (double);
+	}
+
 	MyDB_AttValPtr createAtt () {
 		return make_shared <MyDB_DoubleAttVal> ();
 	}	
@@ -117,6 +129,10 @@ public:
 		return false;
 	}
 
+	int getBinarySize () {
+		return -1;
+	}
+
 	string toString () {
 		return "string";
 	}
@@ -152,6 +168,10 @@ public:
 		return true;
 	}
 
+	int getBinarySize () {
+		return sizeof (short) + sizeof (char);
+	}
+
 	string toString () {
 		return "bool";
 	}
@@ -1,3 +1,14 @@
 
-// this lists all of the different page types
-enum MyDB_PageType {RegularPage, DirectoryPage};
+#ifndef PAGE_TYPE_H
+#define PAGE_TYPE_H
+
+// this lists all of the different page types... a PaxPage holds the same kind of records as a
+// RegularPage, but stored a column at a time (see MyDB_PageLayout.h)
+enum MyDB_PageType {RegularPage, DirectoryPage, PaxPage};
+
+// how the records are laid out on a page (see MyDB_PageLayout.h): one after another, which
+// is how pages used to be written, or one after another with a directory of slots at the end
+// of the page, so that any record can be found without reading the ones before it
+enum MyDB_PageFormat {StreamFormat, SlottedFormat};
+
+#endif
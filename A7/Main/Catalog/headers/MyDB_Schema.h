@@ -10,6 +10,23 @@
 
 using namespace std;
 
+// where the attributes' data sits in a serialized record with a particular schema
+class MyDB_RecordLayout;
+typedef shared_ptr <MyDB_RecordLayout> MyDB_RecordLayoutPtr;
+
+class MyDB_RecordLayout {
+
+public:
+
+	// the number of attributes that the schema had when this was worked out
+	size_t numAtts;
+
+	// the offset of each attribute's data (just past its length) within a serialized record,
+	// for those attributes (at the front of the schema) where this is the same for every
+	// record... that is, up to and including the first attribute whose size can vary
+	vector <size_t> fixedOffsets;
+};
+
 // create a smart pointer for records
 class MyDB_Schema;
 typedef shared_ptr <MyDB_Schema> MyDB_SchemaPtr;
@@ -27,6 +44,10 @@ public:
 	// append another attribute to the schema
 	void appendAtt (pair <string, MyDB_AttTypePtr> addAtt);
 
+	// where the attributes' data is in a serialized record... this is only worked out again if
+	// attributes have been added since the last time, so all of the records can share it
+	MyDB_RecordLayoutPtr getLayout ();
+
 	// create this schema by loading from the catalog
 	void fromCatalog (string tableName, MyDB_CatalogPtr catalog);
 
@@ -45,6 +66,9 @@ private:
 	// this is a list, in order, of the attributes in the schema
 	// the string is the name of the attribute, and we also know the types
 	vector <pair <string, MyDB_AttTypePtr>> allAtts;
+
+	// the layout that was last worked out (see getLayout)
+	MyDB_RecordLayoutPtr layout;
 };
 
 #endif
@@ -71,9 +71,15 @@ public:
 	// the sort att
 	string &getSortAtt ();
 
-	// the file type (ex: "heap" or "bplustree")
+	// the file type (ex: "heap", "heap-pax" or "bplustree")
 	string &getFileType ();
 
+	// true if the file is a heap, of either kind ("heap" or "heap-pax")
+	bool isHeap ();
+
+	// true if the full pages of the file are stored a column at a time ("heap-pax")
+	bool isPax ();
+
 	// get/set the root location
 	void setRootLocation (int toMe);
 	int getRootLocation ();
@@ -82,6 +82,30 @@ void MyDB_Schema :: putInCatalog (string tableName, MyDB_CatalogPtr catalog) {
 	}	
 }
 
+MyDB_RecordLayoutPtr MyDB_Schema :: getLayout () {
+
+	// records can be made on many threads at once, so the layout is swapped in atomically...
+	// two threads that both work it out get the same answer
+	MyDB_RecordLayoutPtr returnVal = atomic_load (&layout);
+	if (returnVal != nullptr && returnVal->numAtts == allAtts.size ())
+		return returnVal;
+
+	// the offsets are known up to and including the first attribute whose size can vary
+	returnVal = make_shared <MyDB_RecordLayout> ();
+	returnVal->numAtts = allAtts.size ();
+	int offset = sizeof (short);
+	for (auto &entry : allAtts) {
+		if (offset < 0)
+			break;
+		returnVal->fixedOffsets.push_back (offset + sizeof (short));
+		int size = entry.second->getBinarySize ();
+		offset = (size < 0 ? -1 : offset + size);
+	}
+
+	atomic_store (&layout, returnVal);
+	return returnVal;
+}
+
 vector <pair <string, MyDB_AttTypePtr>> &MyDB_Schema :: getAtts () {
 	return allAtts;
 }
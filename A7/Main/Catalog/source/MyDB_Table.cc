@@ -104,6 +104,16 @@ string &MyDB_Table ::getFileType()
 	return fileType;
 }
 
+bool MyDB_Table ::isHeap()
+{
+	return fileType == "heap" || fileType == "heap-pax";
+}
+
+bool MyDB_Table ::isPax()
+{
+	return fileType == "heap-pax";
+}
+
 string &MyDB_Table ::getSortAtt()
 {
 	return sortAtt;
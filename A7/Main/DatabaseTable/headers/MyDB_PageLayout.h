@@ -0,0 +1,78 @@
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A2.  You should not be looking at this file     **
+** unless you have completed A2!                   **
+****************************************************/
+
+
+#ifndef PAGE_LAYOUT_H
+#define PAGE_LAYOUT_H
+
+#include <cstddef>
+#include <cstdint>
+#include "MyDB_PageType.h"
+
+// every page starts with a header giving the type of the page, a tag that says how the records
+// are laid out, and the number of bytes at the start of the page that are taken up by the header
+// and the records (which are written one after another, right after the header).  A slotted page
+// also has a directory at the very end: the number of records in the last sizeof (size_t) bytes,
+// and just before that, one slot per record, holding the offset of the record on the page.  Slot
+// i is the i^th one going back from the record count, so the directory grows down towards the
+// records.  The records of a slotted page are visited in slot order, which is not necessarily the
+// order that they are in on the page, so a page can be sorted by moving its slots around
+struct MyDB_PageHeader {
+	MyDB_PageType type;
+	uint32_t format;
+	size_t bytesUsed;
+};
+
+static_assert (sizeof (MyDB_PageHeader) == 2 * sizeof (size_t), "the page header changed size");
+
+// the format tag of a slotted page... anything else is a page whose records are just written one
+// after another (before there were slotted pages, these bytes were never set, so they hold junk)
+#define SLOTTED_PAGE_TAG 0x510773D5
+
+// the number of bytes that a slot takes up
+#define SLOT_SIZE sizeof (uint32_t)
+
+inline MyDB_PageHeader *getPageHeader (void *bytes) {
+	return (MyDB_PageHeader *) bytes;
+}
+
+inline MyDB_PageFormat getPageFormat (void *bytes) {
+	return getPageHeader (bytes)->format == SLOTTED_PAGE_TAG ? SlottedFormat : StreamFormat;
+}
+
+// the record count of a slotted page
+inline size_t &getNumSlots (void *bytes, size_t pageSize) {
+	return *((size_t *) (((char *) bytes) + pageSize - sizeof (size_t)));
+}
+
+// slot i of a slotted page
+inline uint32_t &getSlot (void *bytes, size_t pageSize, size_t i) {
+	return *((uint32_t *) (((char *) bytes) + pageSize - sizeof (size_t) - (i + 1) * SLOT_SIZE));
+}
+
+// a page of type MyDB_PageType :: PaxPage stores its records a column at a time.  After the page
+// header comes this header, then the offset on the page where each column starts, and then the
+// columns themselves.  Each column holds the values of one attribute, one after another in record
+// order, each serialized just as it would be in a record (a length, followed by the data)
+struct MyDB_PaxHeader {
+	uint32_t numRecs;
+	uint32_t numCols;
+};
+
+inline MyDB_PaxHeader *getPaxHeader (void *bytes) {
+	return (MyDB_PaxHeader *) (((char *) bytes) + sizeof (MyDB_PageHeader));
+}
+
+// the offset where column i of a PAX page starts
+inline uint32_t &getColumnStart (void *bytes, size_t i) {
+	return ((uint32_t *) (((char *) bytes) + sizeof (MyDB_PageHeader) + sizeof (MyDB_PaxHeader)))[i];
+}
+
+#endif
@@ -28,6 +28,9 @@ public:
         // load the current record into the parameter
         void getCurrent (MyDB_RecordPtr intoMe) override;
 
+        // load the current record into the parameter, without copying it off of the page
+        void getCurrentView (MyDB_RecordPtr intoMe) override;
+
         // after a call to advance (), a call to getCurrentPointer () will get the address
         // of the record.  At a later time, it is then possible to reconstitute the record
         // by calling MyDB_Record.fromBinary (obtainedPointer)... ASSUMING that the page that
@@ -39,8 +42,9 @@ public:
         // be called until after getCurrent () has been called
         bool advance () override;
 
-	// destructor and contructor
-	MyDB_PageListIteratorAlt (vector <MyDB_PageReaderWriter> &forUs);
+	// destructor and contructor... if consume is true, each page is discarded once the
+	// iterator has moved past it
+	MyDB_PageListIteratorAlt (vector <MyDB_PageReaderWriter> &forUs, bool consume);
 	~MyDB_PageListIteratorAlt ();
 
 private:
@@ -48,6 +52,7 @@ private:
 	MyDB_RecordIteratorAltPtr myIter;
 	vector <MyDB_PageReaderWriter> forUs;
 	int curPage;
+	bool consume;
 };
 
 #endif
@@ -19,6 +19,10 @@
 #include "MyDB_RecordIteratorAlt.h"
 #include "MyDB_TableReaderWriter.h"
 
+// the number of pages that the table and page list iterators try to keep in flight
+// ahead of the page that they are working on
+#define READ_AHEAD_PAGES 32
+
 using namespace std;
 class MyDB_PageReaderWriter;
 typedef shared_ptr <MyDB_PageReaderWriter> MyDB_PageReaderWriterPtr;
@@ -36,16 +40,55 @@ public:
 	// constructor for a page that can be pinned, if desired
 	MyDB_PageReaderWriter (bool pinned, MyDB_TableReaderWriter &parent, int whichPage);
 
+	// like the above, but also tells the buffer manager how the page is going to be used
+	MyDB_PageReaderWriter (bool pinned, MyDB_TableReaderWriter &parent, int whichPage, MyDB_AccessHint hint);
+
+	// constructor for a page that we already have a handle to
+	MyDB_PageReaderWriter (MyDB_PageHandle myPage, size_t pageSize);
+
 	// constructor for an anonymous page
 	MyDB_PageReaderWriter (MyDB_BufferManager &parent);
 
 	// constructor for an anonymous page that can be pinned, if desired
 	MyDB_PageReaderWriter (bool pinned, MyDB_BufferManager &parent);
 
+	// constructor for an anonymous page that is pinned through the grant
+	MyDB_PageReaderWriter (MyDB_BufferManager &parent, MyDB_MemoryGrantPtr grant);
+
+	// false if there is no page, or if its bytes can't be had: a page that was to be pinned
+	// gets no frame if every one is pinned or set aside for a grant, and a page that is not
+	// buffered can't be read in if every frame is pinned.  Nothing else may be done with
+	// such a page (an anonymous one is only cleared by its constructor if this is true)
+	bool hasRAM ();
+
 	// empties out the contents of this page, so that it has no records in it
-	// the type of the page is set to MyDB_PageType :: RegularPage
+	// the type of the page is set to MyDB_PageType :: RegularPage, and the page
+	// is given a slot directory
 	void clear ();	
 
+	// like the above, but the records are laid out as asked
+	void clear (MyDB_PageFormat format);	
+
+	// gets the way that records are laid out on the page
+	MyDB_PageFormat getFormat ();
+
+	// the number of records on the page... on a page without slots (that is not a
+	// PAX page), the records have to be read (into temp) to count them
+	size_t getNumRecords (MyDB_RecordPtr temp);
+
+	// loads the i^th record on the page into intoMe... on a slotted page, this goes
+	// right to the record, and on a PAX page, right to the values in each column whose
+	// values are all the same size; otherwise, all of the values before it are skipped
+	void getRecord (size_t i, MyDB_RecordPtr intoMe);
+
+	// finds the first record on the page for which test returns true, given that
+	// test is false for every record before that one and true for every one after
+	// it (as when the page is sorted and test compares intoMe, where each record
+	// is loaded, to a key)... on a slotted page this is a binary search, and
+	// otherwise it is a linear one.  Returns the number of records if test is
+	// never true, and leaves intoMe holding whatever record was looked at last
+	size_t findFirst (function <bool ()> test, MyDB_RecordPtr intoMe);
+
 	// return an itrator over this page... each time returnVal->next () is
 	// called, the resulting record will be placed into the record pointed to
 	// by iterateIntoMe
@@ -55,13 +98,30 @@ public:
 	// iterator that has the alternate getCurrent ()/advance () interface
 	MyDB_RecordIteratorAltPtr getIteratorAlt ();
 
+	// like the above, but only the attributes in whichAtts need to be loaded into
+	// the record... on a PAX page, the other attributes are not even looked at
+	MyDB_RecordIteratorAltPtr getIteratorAlt (vector <int> &whichAtts);
+
 	// gets an instance of an alternatie iterator over a list of pages
 	friend MyDB_RecordIteratorAltPtr getIteratorAlt (vector <MyDB_PageReaderWriter> &forUs);
 
 	// appends a record to this page... return false is the append fails because
-	// there is not enough space on the page; otherwise, return true
+	// there is not enough space on the page (or because it is a PAX page, which
+	// cannot be appended to); otherwise, return true
 	bool append (MyDB_RecordPtr appendMe);
 
+	// rewrites this page, which must be a regular page with slots, as a PAX page:
+	// one where all of the values of the first attribute come first, then all of
+	// the values of the second, and so on (see MyDB_PaxHeader).  This is done when
+	// the page is full, as a PAX page can be read but not added to.  temp is a
+	// record with the page's schema.  Returns false (and leaves the page alone)
+	// if the page is empty or cannot be converted
+	bool toPax (MyDB_RecordPtr temp);
+
+	// empties out toMe and writes all of the records on this page into it, as
+	// regular records; temp is used to hold each one
+	void copyTo (MyDB_PageReaderWriter &toMe, MyDB_RecordPtr temp);
+
 	// appends a record to this page... return a pointer to the location of where
 	// the record is written if there is enough space on the page; otherwise, return
 	// a nullptr
@@ -80,7 +140,9 @@ public:
 	// this lambda would have been created via a call to buildRecordComparator
 	MyDB_PageReaderWriterPtr sort (function <bool ()> comparator, MyDB_RecordPtr lhs,  MyDB_RecordPtr rhs);
 
-	// like the above, except that the sorting is done in place, on the page
+	// like the above, except that the sorting is done in place, on the page... on
+	// a slotted page, only the slots are moved, and a PAX page is first turned
+	// back into a regular one
 	void sortInPlace (function <bool ()> comparator, MyDB_RecordPtr lhs,  MyDB_RecordPtr rhs);
 
 	// returns the page size
@@ -89,8 +151,25 @@ public:
 	// returns the actual bytes
 	void *getBytes ();
 
+	// lets the buffer manager know that the page is going to be read soon, so that the
+	// read from disk can get going in the background
+	void prefetch ();
+
+	// tells the buffer manager how the page is going to be used from now on
+	void setHint (MyDB_AccessHint hint);
+
+	// lets the buffer manager know that nobody is going to look at the page again, so that
+	// it is never written back (and its RAM can be reused right away), and lets go of it
+	void discard ();
+
 private:
 
+	// the number of bytes that are still free for records (and their slots)
+	size_t getBytesLeft ();
+
+	// the list of all of the attributes stored on this PAX page
+	vector <int> getAllColumns ();
+
 	// this is the page that we are messing with
 	MyDB_PageHandle myPage;	
 	
@@ -101,4 +180,15 @@ private:
 // gets an instance of an alternatie iterator over a list of pages
 MyDB_RecordIteratorAltPtr getIteratorAlt (vector <MyDB_PageReaderWriter> &forUs);
 
+// like the above, but each page is discarded as soon as the iterator is done with it... this
+// is for lists of temp pages that are read exactly once, such as the sorted runs that are
+// merged during a sort, so that their pages are never written to disk after they are read
+MyDB_RecordIteratorAltPtr getConsumingIteratorAlt (vector <MyDB_PageReaderWriter> &forUs);
+
+// puts the address of each of the records on a page into locations, in the order that they are
+// iterated over... bytes can be the page itself, or a copy of it.  temp is used to read through
+// the records of a page without slots.  This does not work on a PAX page, whose records are not
+// stored in one piece
+void getRecordLocations (void *bytes, size_t pageSize, MyDB_RecordPtr temp, vector <void *> &locations);
+
 #endif
@@ -35,12 +35,16 @@ public:
         void *getCurrentPointer () override;
 
 	// destructor and contructor
-	MyDB_PageRecIterator (MyDB_PageHandle myPageIn, MyDB_RecordPtr myRecIn); 
+	MyDB_PageRecIterator (MyDB_PageHandle myPageIn, size_t pageSizeIn, MyDB_RecordPtr myRecIn); 
 	~MyDB_PageRecIterator ();
 
 private:
 
+	// how far we are into the page... the records of a slotted page are visited in slot
+	// order, and those of any other page in the order that they are on the page
 	int bytesConsumed;
+	long slotsConsumed;
+	size_t pageSize;
 	MyDB_PageHandle myPage;
 	MyDB_RecordPtr myRec;
 	
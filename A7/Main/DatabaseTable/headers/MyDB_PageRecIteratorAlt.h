@@ -24,6 +24,9 @@ public:
         // load the current record into the parameter
         void getCurrent (MyDB_RecordPtr intoMe) override;
 
+        // load the current record into the parameter, without copying it off of the page
+        void getCurrentView (MyDB_RecordPtr intoMe) override;
+
         // after a call to advance (), a call to getCurrentPointer () will get the address
         // of the record.  At a later time, it is then possible to reconstitute the record
         // by calling MyDB_Record.fromBinary (obtainedPointer)... ASSUMING that the page that
@@ -36,12 +39,16 @@ public:
         bool advance () override;
 
 	// destructor and contructor
-	MyDB_PageRecIteratorAlt (MyDB_PageHandle myPageIn); 
+	MyDB_PageRecIteratorAlt (MyDB_PageHandle myPageIn, size_t pageSizeIn); 
 	~MyDB_PageRecIteratorAlt ();
 
 private:
 
+	// how far we are into the page... the records of a slotted page are visited in slot
+	// order, and those of any other page in the order that they are on the page
 	int bytesConsumed;
+	long slotsConsumed;
+	size_t pageSize;
 	int nextRecSize;
 	MyDB_PageHandle myPage;
 };
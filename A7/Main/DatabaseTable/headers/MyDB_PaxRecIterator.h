@@ -0,0 +1,47 @@
+
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A2.  You should not be looking at this file     **
+** unless you have completed A2!                   **
+****************************************************/
+
+
+#ifndef PAX_REC_ITER_H
+#define PAX_REC_ITER_H
+
+#include "MyDB_PaxRecIteratorAlt.h"
+#include "MyDB_RecordIterator.h"
+
+// the hasNext ()/getNext () version of MyDB_PaxRecIteratorAlt; every attribute is loaded
+class MyDB_PaxRecIterator : public MyDB_RecordIterator {
+
+public:
+
+	// put the contents of the next record in the page into the iterator record
+	void getNext () override;
+
+	// return true iff there is another record in the page
+	bool hasNext () override;
+
+	// the records on a PAX page are not stored in one piece, so this always returns a nullptr
+        void *getCurrentPointer () override;
+
+	// destructor and contructor
+	MyDB_PaxRecIterator (MyDB_PageHandle myPageIn, vector <int> &whichAtts, MyDB_RecordPtr myRecIn); 
+	~MyDB_PaxRecIterator ();
+
+private:
+
+	MyDB_PaxRecIteratorAlt myIter;
+	MyDB_RecordPtr myRec;
+
+	// true if myIter has been advanced to the record that getNext () returns next
+	bool advanced;
+	bool more;
+};
+
+#endif
@@ -0,0 +1,63 @@
+
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A2.  You should not be looking at this file     **
+** unless you have completed A2!                   **
+****************************************************/
+
+
+#ifndef PAX_REC_ITER_ALT_H
+#define PAX_REC_ITER_ALT_H
+
+#include <vector>
+#include "MyDB_PageHandle.h"
+#include "MyDB_Record.h"
+#include "MyDB_RecordIteratorAlt.h"
+
+// iterates through the records on a page of type MyDB_PageType :: PaxPage... only the
+// attributes that are asked for are loaded into the record, and the columns holding
+// the rest of them are never looked at
+class MyDB_PaxRecIteratorAlt : public MyDB_RecordIteratorAlt {
+
+public:
+
+        // load the current record into the parameter
+        void getCurrent (MyDB_RecordPtr intoMe) override;
+
+        // load the current record into the parameter, without copying it off of the page
+        void getCurrentView (MyDB_RecordPtr intoMe) override;
+
+        // the records on a PAX page are not stored in one piece, so there is no pointer
+        // that can be given out; this always returns a nullptr
+        void *getCurrentPointer ();
+
+        // advance to the next record... returns true if there is a next record, and
+        // false if there are no more records to iterate over
+        bool advance () override;
+
+	// destructor and contructor; whichAtts lists the attributes to load
+	MyDB_PaxRecIteratorAlt (MyDB_PageHandle myPageIn, vector <int> &whichAtts); 
+	~MyDB_PaxRecIteratorAlt ();
+
+private:
+
+	// the attributes that we load, and where the current value of each is on the page
+	vector <int> whichAtts;
+	vector <size_t> cursors;
+
+	// the same as cursors, but as addresses; this is what is given to the record
+	vector <char *> locations;
+
+	// the record that we are on
+	long curRec;
+	MyDB_PageHandle myPage;
+
+	// gets the addresses of the current values
+	void setLocations ();
+};
+
+#endif
@@ -20,6 +20,14 @@ public:
 	// load the current record into the parameter
 	virtual void getCurrent (MyDB_RecordPtr intoMe) = 0;
 
+	// like the above, except that the record is loaded via MyDB_Record.viewBinary (), so
+	// that it is not copied out of the page that it is on... the record can only be used
+	// until the next call to advance (), and only if nothing that might push the page out
+	// of the buffer is done in the meantime.  Iterators that cannot do this just copy
+	virtual void getCurrentView (MyDB_RecordPtr intoMe) {
+		getCurrent (intoMe);
+	}
+
         // after a call to advance (), a call to getCurrentPointer () will get the address
         // of the record.  At a later time, it is then possible to reconstitute the record
         // by calling MyDB_Record.fromBinary (obtainedPointer)... ASSUMING that the page that
@@ -42,7 +42,8 @@ public:
 	// gets an empty record from this table
 	MyDB_RecordPtr getEmptyRecord ();
 
-	// append a record to the table
+	// append a record to the table... if the table is stored as PAX (see
+	// MyDB_Table.isPax ()), each page is made into a PAX page once it fills up
 	virtual void append (MyDB_RecordPtr appendMe);
 
 	// return an itrator over this table... each time returnVal->next () is
@@ -59,6 +60,11 @@ public:
 	// highPage inclusive
 	MyDB_RecordIteratorAltPtr getIteratorAlt (int lowPage, int highPage);
 
+	// gets an instance of an alternate iterator over the table that only needs
+	// to load the attributes in whichAtts into the record (see
+	// MyDB_PageReaderWriter.getIteratorAlt (whichAtts))
+	MyDB_RecordIteratorAltPtr getIteratorAlt (vector <int> &whichAtts);
+
 	// load a text file into this table... this returns a pair where the first
 	// entry is a list of (approximate) distinct value counts for each of the
 	// attributes in the table, and the second entry is the number of tuples that
@@ -71,9 +77,28 @@ public:
 	// access the i^th page in this file
 	MyDB_PageReaderWriter operator [] (size_t i);
 
+	// like the above, but also tells the buffer manager how the page is going to be used
+	MyDB_PageReaderWriter getPage (size_t i, MyDB_AccessHint hint);
+
 	// access the i^th page in this file... getting a pinned version of the page
 	MyDB_PageReaderWriter getPinned (size_t i);
 
+	// access the pages at the given positions in this file, reading all of the ones that are
+	// not buffered at once (see MyDB_BufferManager :: getPages)
+	vector <MyDB_PageReaderWriter> getPages (vector <long> &positions, MyDB_AccessHint hint);
+
+	// like the above, but getting pinned versions of the pages
+	vector <MyDB_PageReaderWriter> getPinnedPages (vector <long> &positions);
+
+	// like the above, but the pages are pinned through the grant
+	vector <MyDB_PageReaderWriter> getPinnedPages (vector <long> &positions, MyDB_MemoryGrantPtr grant);
+
+	// read-ahead for a scan that is now on page curPage and that will stop after page highPage:
+	// if fewer than READ_AHEAD_PAGES / 2 pages past curPage have been asked for (the last one
+	// asked for is prefetchedThrough), asks the buffer manager to prefetch the pages up to
+	// READ_AHEAD_PAGES past curPage.  Returns the new value for prefetchedThrough
+	int readAhead (int curPage, int prefetchedThrough, int highPage);
+
 	// access the last page in the file
 	MyDB_PageReaderWriter last ();
 
@@ -49,6 +49,13 @@ private:
 	MyDB_TablePtr myTable;
         MyDB_RecordPtr myRec;
 
+	// the last page that we have asked the buffer manager to prefetch
+	int prefetchedThrough;
+
+	// asks the table to prefetch the pages ahead of the current one (see
+	// MyDB_TableReaderWriter.readAhead ())
+	void readAhead ();
+
 };
 
 #endif
@@ -25,6 +25,9 @@ public:
         // load the current record into the parameter
         void getCurrent (MyDB_RecordPtr intoMe) override;
 
+        // load the current record into the parameter, without copying it off of the page
+        void getCurrentView (MyDB_RecordPtr intoMe) override;
+
         // after a call to advance (), a call to getCurrentPointer () will get the address
         // of the record.  At a later time, it is then possible to reconstitute the record
         // by calling MyDB_Record.fromBinary (obtainedPointer)... ASSUMING that the page that
@@ -41,6 +44,9 @@ public:
 	~MyDB_TableRecIteratorAlt ();
 	MyDB_TableRecIteratorAlt (MyDB_TableReaderWriter &myParent, MyDB_TablePtr myTableIn, int lowPage, int highPage);
 
+	// iterates over the whole table, only needing to load the attributes in whichAtts
+	MyDB_TableRecIteratorAlt (MyDB_TableReaderWriter &myParent, MyDB_TablePtr myTableIn, vector <int> &whichAtts);
+
 private:
 
 	MyDB_RecordIteratorAltPtr myIter;
@@ -48,6 +54,20 @@ private:
 	int highPage;	
 	MyDB_TableReaderWriter &myParent;
 	MyDB_TablePtr myTable;
+
+	// the attributes to load, if we were not asked to load them all
+	vector <int> whichAtts;
+	bool someAtts;
+
+	// the last page that we have asked the buffer manager to prefetch
+	int prefetchedThrough;
+
+	// asks the table to prefetch the pages ahead of the current one (see
+	// MyDB_TableReaderWriter.readAhead ())
+	void readAhead ();
+
+	// gets an iterator over the current page
+	MyDB_RecordIteratorAltPtr getPageIterator ();
 };
 
 #endif
@@ -18,8 +18,8 @@ public:
 	}
 
 	bool operator () (void *lhsPtr, void *rhsPtr) {
-		lhs->fromBinary (lhsPtr);
-		rhs->fromBinary (rhsPtr);
+		lhs->viewBinary (lhsPtr);
+		rhs->viewBinary (rhsPtr);
 		return comparator ();	
 	}
 
@@ -79,8 +79,8 @@ MyDB_RecordIteratorAltPtr MyDB_BPlusTreeReaderWriter :: getRangeIteratorAlt (MyD
 bool MyDB_BPlusTreeReaderWriter :: discoverPages (int whichPage, vector <MyDB_PageReaderWriter> &list,
 	MyDB_AttValPtr low, MyDB_AttValPtr high) {
 
-	// figure out the page to search
-	MyDB_PageReaderWriter pageToSearch = (*this)[whichPage];
+	// figure out the page to search... the leaves that a search finds are a few out of many
+	MyDB_PageReaderWriter pageToSearch = getPage (whichPage, RandomAccess);
 
 	// it is a regular page (data page)
 	if (pageToSearch.getType () == MyDB_PageType :: RegularPage) {
@@ -91,8 +91,8 @@ bool MyDB_BPlusTreeReaderWriter :: discoverPages (int whichPage, vector <MyDB_Pa
 	// we have an internal node, so find the subtrees to seach
 	} else {
 
-		// iterate through the various subtrees
-		MyDB_RecordIteratorAltPtr temp = pageToSearch.getIteratorAlt ();
+		// every search goes through the internal nodes, so the buffer should hold on to them
+		pageToSearch.setHint (KeepHotAccess);
 
 		// set up all of the comparisons that we need
 		MyDB_INRecordPtr otherRec = getINRecord ();
@@ -103,30 +103,30 @@ bool MyDB_BPlusTreeReaderWriter :: discoverPages (int whichPage, vector <MyDB_Pa
 		function <bool ()> comparatorLow = buildComparator (otherRec, llow);
 		function <bool ()> comparatorHigh = buildComparator (hhigh, otherRec);
 
-		// if the low bound and the high bound are both engaged, then we are discovering records
-		bool lowEngaged = false;
-		bool highEngaged = true;
+		// the subtrees to search start with the first one whose key is not below the low bound
+		// (the directory is sorted, so this is a binary search), and end with the first one whose
+		// key is past the high bound
+		size_t numRecs = pageToSearch.getNumRecords (otherRec);
+		size_t first = pageToSearch.findFirst ([&] () {return !comparatorLow ();}, otherRec);
 		bool foundLeaf = false;
-		while (temp->advance ()) {
+		vector <long> leaves;
+		for (size_t i = first; i < numRecs; i++) {
 			
-			temp->getCurrent (otherRec);
-
-			if (!comparatorLow ()) 
-				lowEngaged = true;
-
-			// see if the new key is less than the key in the directory record
-			if (lowEngaged && highEngaged) {
-				if (foundLeaf) {
-					list.push_back ((*this)[otherRec->getPtr ()]);
+			pageToSearch.getRecord (i, otherRec);
+			if (foundLeaf) {
+				leaves.push_back (otherRec->getPtr ());
 
-				} else {
-					foundLeaf = discoverPages (otherRec->getPtr (), list, low, high);	
-				}
+			} else {
+				foundLeaf = discoverPages (otherRec->getPtr (), list, low, high);	
 			}
 
 			if (comparatorHigh ())
-				highEngaged = false;
+				break;
 		}
+
+		// the rest of the leaves under this node are read all at once
+		for (MyDB_PageReaderWriter &leaf : getPages (leaves, RandomAccess))
+			list.push_back (leaf);
 		return false;
 	}
 
@@ -189,8 +189,6 @@ void MyDB_BPlusTreeReaderWriter :: append (MyDB_RecordPtr appendMe) {
 	}
 }
 
-#define NUM_BYTES_USED *((size_t *) (((char *) temp) + sizeof (size_t)))
-
 MyDB_RecordPtr MyDB_BPlusTreeReaderWriter :: split (MyDB_PageReaderWriter splitMe, MyDB_RecordPtr andMe) {
 	
 	// get a new page for the lower one half
@@ -222,13 +220,7 @@ MyDB_RecordPtr MyDB_BPlusTreeReaderWriter :: split (MyDB_PageReaderWriter splitM
 	vector <void *> positions;
 
 	// compute where all of the records are located
-	int bytesConsumed = sizeof (size_t) * 2;
-	while (bytesConsumed != NUM_BYTES_USED) {
-		void *pos = bytesConsumed + (char *) temp;
-		positions.push_back (pos);
-		void *nextPos = lhs->fromBinary (pos);
-		bytesConsumed += ((char *) nextPos) - ((char *) pos);
-	}
+	getRecordLocations (temp, splitMe.getPageSize (), lhs, positions);
 	
 	// and get a postition for the last guy
 	void *spaceForLastGuy = malloc (andMe->getBinarySize ());
@@ -297,35 +289,33 @@ MyDB_RecordPtr MyDB_BPlusTreeReaderWriter :: append (int whichPage, MyDB_RecordP
 	// we have an internal node, so find the subtree to insert into
 	} else {
 
-		// iterate through the various subtrees
-		MyDB_RecordIteratorAltPtr temp = pageToAddTo.getIteratorAlt ();
+		// find the subtree to insert into: the first one whose key is bigger than the new record's
+		// (the directory is sorted, so this is a binary search)
 		MyDB_INRecordPtr otherRec = getINRecord ();
 		function <bool ()> comparator = buildComparator (appendMe, otherRec);
-		while (temp->advance ()) {
+		size_t numRecs = pageToAddTo.getNumRecords (otherRec);
+		size_t which = pageToAddTo.findFirst (comparator, otherRec);
+		if (which < numRecs) {
 			
-			// see if the new key is less than the key in the directory record
-			temp->getCurrent (otherRec);
-			if (comparator ()) {
-
-				// recursively append
-				auto res = append (otherRec->getPtr (), appendMe);
-
-				// we got a child split
-				if (res != nullptr) {
-
-					// attempt to add the new one	
-					if (pageToAddTo.append (res)) {
-						MyDB_INRecordPtr otherRec = getINRecord ();
-						function <bool ()> comparator = buildComparator (res, otherRec);	
-						pageToAddTo.sortInPlace (comparator, res, otherRec);
-						return nullptr;
-					}
-
-					// could not fit the new one, so split it
-					return split (pageToAddTo, res);
+			// recursively append
+			pageToAddTo.getRecord (which, otherRec);
+			auto res = append (otherRec->getPtr (), appendMe);
+
+			// we got a child split
+			if (res != nullptr) {
+
+				// attempt to add the new one	
+				if (pageToAddTo.append (res)) {
+					MyDB_INRecordPtr otherRec = getINRecord ();
+					function <bool ()> comparator = buildComparator (res, otherRec);	
+					pageToAddTo.sortInPlace (comparator, res, otherRec);
+					return nullptr;
 				}
-				return nullptr;
+
+				// could not fit the new one, so split it
+				return split (pageToAddTo, res);
 			}
+			return nullptr;
 		}
 	}
 
@@ -20,15 +20,28 @@ void MyDB_PageListIteratorAlt :: getCurrent (MyDB_RecordPtr intoMe) {
 	myIter->getCurrent (intoMe);
 }
 
+void MyDB_PageListIteratorAlt :: getCurrentView (MyDB_RecordPtr intoMe) {
+	myIter->getCurrentView (intoMe);
+}
+
 bool MyDB_PageListIteratorAlt :: advance () {
 
 	if (myIter->advance ())
 		return true;
 
+	if (consume)
+		forUs[curPage].discard ();
+
 	if (curPage == forUs.size () - 1)
 		return false;
 
 	curPage++;
+
+	// the pages may be all over the temp file, so we ask for them one at a time, keeping
+	// READ_AHEAD_PAGES pages in flight
+	if (curPage + READ_AHEAD_PAGES - 1 < (int) forUs.size ())
+		forUs[curPage + READ_AHEAD_PAGES - 1].prefetch ();
+
 	myIter = forUs[curPage].getIteratorAlt ();
 	return advance ();
 }
@@ -37,9 +50,12 @@ void *MyDB_PageListIteratorAlt :: getCurrentPointer () {
 	return myIter->getCurrentPointer ();
 }
 
-MyDB_PageListIteratorAlt :: MyDB_PageListIteratorAlt (vector <MyDB_PageReaderWriter> &forUsIn) {
+MyDB_PageListIteratorAlt :: MyDB_PageListIteratorAlt (vector <MyDB_PageReaderWriter> &forUsIn, bool consumeIn) {
 	forUs = forUsIn;
 	curPage = 0;
+	consume = consumeIn;
+	for (int i = 0; i < READ_AHEAD_PAGES && i < (int) forUs.size (); i++)
+		forUs[i].prefetch ();
 	myIter = forUsIn[curPage].getIteratorAlt ();		
 }
 
@@ -14,15 +14,18 @@
 #define PAGE_RW_C
 
 #include <algorithm>
+#include "MyDB_PageLayout.h"
 #include "MyDB_PageReaderWriter.h"
 #include "MyDB_PageRecIterator.h"
 #include "MyDB_PageRecIteratorAlt.h"
 #include "MyDB_PageListIteratorAlt.h"
+#include "MyDB_PaxRecIterator.h"
+#include "MyDB_PaxRecIteratorAlt.h"
 #include "RecordComparator.h"
 
-#define PAGE_TYPE *((MyDB_PageType *) ((char *) myPage->getBytes ()))
-#define NUM_BYTES_USED *((size_t *) (((char *) myPage->getBytes ()) + sizeof (size_t)))
-#define NUM_BYTES_LEFT (pageSize - NUM_BYTES_USED)
+#define PAGE_TYPE getPageHeader (myPage->getBytes ())->type
+#define NUM_BYTES_USED getPageHeader (myPage->getBytes ())->bytesUsed
+#define NUM_SLOTS getNumSlots (myPage->getBytes (), pageSize)
 
 MyDB_PageReaderWriter :: MyDB_PageReaderWriter () {
 	myPage = nullptr;
@@ -36,21 +39,31 @@ MyDB_PageReaderWriter :: MyDB_PageReaderWriter (MyDB_TableReaderWriter &parent,
 	pageSize = parent.getBufferMgr ()->getPageSize ();
 }
 
-MyDB_PageReaderWriter :: MyDB_PageReaderWriter (bool pinned, MyDB_TableReaderWriter &parent, int whichPage) {
+MyDB_PageReaderWriter :: MyDB_PageReaderWriter (bool pinned, MyDB_TableReaderWriter &parent, int whichPage) :
+	MyDB_PageReaderWriter (pinned, parent, whichPage, NormalAccess) {}
+
+MyDB_PageReaderWriter :: MyDB_PageReaderWriter (bool pinned, MyDB_TableReaderWriter &parent, int whichPage,
+	MyDB_AccessHint hint) {
 
 	// get the actual page
 	if (pinned) {
-		myPage = parent.getBufferMgr ()->getPinnedPage (parent.getTable (), whichPage);
+		myPage = parent.getBufferMgr ()->getPinnedPage (parent.getTable (), whichPage, hint);
 	} else {
-		myPage = parent.getBufferMgr ()->getPage (parent.getTable (), whichPage);
+		myPage = parent.getBufferMgr ()->getPage (parent.getTable (), whichPage, hint);
 	}
 	pageSize = parent.getBufferMgr ()->getPageSize ();
 }
 
+MyDB_PageReaderWriter :: MyDB_PageReaderWriter (MyDB_PageHandle myPageIn, size_t pageSizeIn) {
+	myPage = myPageIn;
+	pageSize = pageSizeIn;
+}
+
 MyDB_PageReaderWriter :: MyDB_PageReaderWriter (MyDB_BufferManager &parent) {
 	myPage = parent.getPage ();	
 	pageSize = parent.getPageSize ();
-	clear ();
+	if (hasRAM ())
+		clear ();
 }
 
 MyDB_PageReaderWriter :: MyDB_PageReaderWriter (bool pinned, MyDB_BufferManager &parent) {
@@ -61,12 +74,32 @@ MyDB_PageReaderWriter :: MyDB_PageReaderWriter (bool pinned, MyDB_BufferManager
 		myPage = parent.getPage ();	
 	}
 	pageSize = parent.getPageSize ();
-	clear ();
+	if (hasRAM ())
+		clear ();
+}
+
+MyDB_PageReaderWriter :: MyDB_PageReaderWriter (MyDB_BufferManager &parent, MyDB_MemoryGrantPtr grant) {
+	myPage = parent.getPinnedPage (grant);
+	pageSize = parent.getPageSize ();
+	if (hasRAM ())
+		clear ();
+}
+
+bool MyDB_PageReaderWriter :: hasRAM () {
+	return myPage != nullptr && myPage->getBytes () != nullptr;
 }
 
 void MyDB_PageReaderWriter :: clear () {
-	NUM_BYTES_USED = 2 * sizeof (size_t);
-	PAGE_TYPE = MyDB_PageType :: RegularPage;
+	clear (SlottedFormat);
+}
+
+void MyDB_PageReaderWriter :: clear (MyDB_PageFormat format) {
+	MyDB_PageHeader *header = getPageHeader (myPage->getBytes ());
+	header->type = MyDB_PageType :: RegularPage;
+	header->format = (format == SlottedFormat ? SLOTTED_PAGE_TAG : 0);
+	header->bytesUsed = sizeof (MyDB_PageHeader);
+	if (format == SlottedFormat)
+		NUM_SLOTS = 0;
 	myPage->wroteBytes ();	
 }
 
@@ -74,16 +107,154 @@ MyDB_PageType MyDB_PageReaderWriter :: getType () {
 	return PAGE_TYPE;
 }
 
+MyDB_PageFormat MyDB_PageReaderWriter :: getFormat () {
+	return getPageFormat (myPage->getBytes ());
+}
+
+size_t MyDB_PageReaderWriter :: getBytesLeft () {
+	if (getFormat () == SlottedFormat)
+		return pageSize - NUM_BYTES_USED - sizeof (size_t) - NUM_SLOTS * SLOT_SIZE;
+	return pageSize - NUM_BYTES_USED;
+}
+
+void getRecordLocations (void *bytes, size_t pageSize, MyDB_RecordPtr temp, vector <void *> &locations) {
+
+	// on a slotted page, the slots say where everyone is
+	if (getPageFormat (bytes) == SlottedFormat) {
+		size_t numSlots = getNumSlots (bytes, pageSize);
+		for (size_t i = 0; i < numSlots; i++)
+			locations.push_back (((char *) bytes) + getSlot (bytes, pageSize, i));
+		return;
+	}
+
+	// otherwise, this basically iterates through all of the records on the page
+	size_t bytesConsumed = sizeof (MyDB_PageHeader);
+	while (bytesConsumed != getPageHeader (bytes)->bytesUsed) {
+		void *pos = bytesConsumed + (char *) bytes;
+		locations.push_back (pos);
+		void *nextPos = temp->fromBinary (pos);
+		bytesConsumed += ((char *) nextPos) - ((char *) pos);
+	}
+}
+
+vector <int> MyDB_PageReaderWriter :: getAllColumns () {
+	vector <int> returnVal;
+	for (uint32_t i = 0; i < getPaxHeader (myPage->getBytes ())->numCols; i++)
+		returnVal.push_back (i);
+	return returnVal;
+}
+
+size_t MyDB_PageReaderWriter :: getNumRecords (MyDB_RecordPtr temp) {
+	if (getType () == MyDB_PageType :: PaxPage)
+		return getPaxHeader (myPage->getBytes ())->numRecs;
+	if (getFormat () == SlottedFormat)
+		return NUM_SLOTS;
+
+	vector <void *> locations;
+	getRecordLocations (myPage->getBytes (), pageSize, temp, locations);
+	return locations.size ();
+}
+
+void MyDB_PageReaderWriter :: getRecord (size_t i, MyDB_RecordPtr intoMe) {
+
+	// the records of a PAX page are gotten at by going down each column to its i-th value... in a
+	// column whose values are all the same size, this is found directly, and otherwise we walk to it
+	if (getType () == MyDB_PageType :: PaxPage) {
+		char *bytes = (char *) myPage->getBytes ();
+		vector <pair <string, MyDB_AttTypePtr>> &atts = intoMe->getSchema ()->getAtts ();
+		vector <int> allAtts = getAllColumns ();
+		vector <char *> locations;
+		for (int col : allAtts) {
+			char *pos = bytes + getColumnStart (bytes, col);
+			if (atts[col].second->getBinarySize () >= 0) {
+				pos += i * *((short *) pos);
+			} else {
+				for (size_t j = 0; j < i; j++)
+					pos += *((short *) pos);
+			}
+			locations.push_back (pos);
+		}
+		intoMe->fromColumns (allAtts, locations, true);
+		return;
+	}
+
+	void *bytes = myPage->getBytes ();
+	if (getPageFormat (bytes) == SlottedFormat) {
+		intoMe->fromBinary (((char *) bytes) + getSlot (bytes, pageSize, i));
+		return;
+	}
+
+	vector <void *> locations;
+	getRecordLocations (bytes, pageSize, intoMe, locations);
+	intoMe->fromBinary (locations[i]);
+}
+
+size_t MyDB_PageReaderWriter :: findFirst (function <bool ()> test, MyDB_RecordPtr intoMe) {
+
+	if (getType () == MyDB_PageType :: PaxPage) {
+		MyDB_RecordIteratorAltPtr myIter = getIteratorAlt ();
+		size_t i = 0;
+		for (; myIter->advance (); i++) {
+			myIter->getCurrent (intoMe);
+			if (test ())
+				return i;
+		}
+		return i;
+	}
+
+	void *bytes = myPage->getBytes ();
+	if (getPageFormat (bytes) == SlottedFormat) {
+		size_t low = 0, high = getNumSlots (bytes, pageSize);
+		while (low < high) {
+			size_t mid = low + (high - low) / 2;
+			intoMe->fromBinary (((char *) bytes) + getSlot (bytes, pageSize, mid));
+			if (test ())
+				high = mid;
+			else
+				low = mid + 1;
+		}
+		return low;
+	}
+
+	// without slots, we can't jump to the middle of the page
+	vector <void *> locations;
+	getRecordLocations (bytes, pageSize, intoMe, locations);
+	for (size_t i = 0; i < locations.size (); i++) {
+		intoMe->fromBinary (locations[i]);
+		if (test ())
+			return i;
+	}
+	return locations.size ();
+}
+
 MyDB_RecordIteratorAltPtr getIteratorAlt (vector <MyDB_PageReaderWriter> &forUs) {
-	return make_shared <MyDB_PageListIteratorAlt> (forUs);
+	return make_shared <MyDB_PageListIteratorAlt> (forUs, false);
+}
+
+MyDB_RecordIteratorAltPtr getConsumingIteratorAlt (vector <MyDB_PageReaderWriter> &forUs) {
+	return make_shared <MyDB_PageListIteratorAlt> (forUs, true);
 }
 
 MyDB_RecordIteratorPtr MyDB_PageReaderWriter :: getIterator (MyDB_RecordPtr iterateIntoMe) {
-	return make_shared <MyDB_PageRecIterator> (myPage, iterateIntoMe);
+	if (getType () == MyDB_PageType :: PaxPage) {
+		vector <int> allAtts = getAllColumns ();
+		return make_shared <MyDB_PaxRecIterator> (myPage, allAtts, iterateIntoMe);
+	}
+	return make_shared <MyDB_PageRecIterator> (myPage, pageSize, iterateIntoMe);
 }
 
 MyDB_RecordIteratorAltPtr MyDB_PageReaderWriter :: getIteratorAlt () {
-	return make_shared <MyDB_PageRecIteratorAlt> (myPage);
+	if (getType () == MyDB_PageType :: PaxPage) {
+		vector <int> allAtts = getAllColumns ();
+		return make_shared <MyDB_PaxRecIteratorAlt> (myPage, allAtts);
+	}
+	return make_shared <MyDB_PageRecIteratorAlt> (myPage, pageSize);
+}
+
+MyDB_RecordIteratorAltPtr MyDB_PageReaderWriter :: getIteratorAlt (vector <int> &whichAtts) {
+	if (getType () == MyDB_PageType :: PaxPage)
+		return make_shared <MyDB_PaxRecIteratorAlt> (myPage, whichAtts);
+	return make_shared <MyDB_PageRecIteratorAlt> (myPage, pageSize);
 }
 
 void MyDB_PageReaderWriter :: setType (MyDB_PageType toMe) {
@@ -100,43 +271,137 @@ void *MyDB_PageReaderWriter :: appendAndReturnLocation (MyDB_RecordPtr appendMe)
 }
 
 bool MyDB_PageReaderWriter :: append (MyDB_RecordPtr appendMe) {
+
+	// there is no room to add anything to a PAX page
+	if (PAGE_TYPE == MyDB_PageType :: PaxPage)
+		return false;
 	
+	// on a slotted page, the record also needs a slot
+	bool slotted = getFormat () == SlottedFormat;
 	size_t recSize = appendMe->getBinarySize ();
-	if (recSize > NUM_BYTES_LEFT)
+	if (recSize + (slotted ? SLOT_SIZE : 0) > getBytesLeft ())
 		return false;
 
 	// write at the end
 	void *address = myPage->getBytes ();
 	appendMe->toBinary (NUM_BYTES_USED + (char *) address);
+	if (slotted) {
+		getSlot (address, pageSize, NUM_SLOTS) = NUM_BYTES_USED;
+		NUM_SLOTS++;
+	}
 	NUM_BYTES_USED += recSize;
 	myPage->wroteBytes ();
 	return true;
 }
 
+bool MyDB_PageReaderWriter :: toPax (MyDB_RecordPtr temp) {
+
+	// only a page with slots is converted, so that its records are sure to fit when they are
+	// put back on a page with slots (see copyTo)
+	if (getType () != MyDB_PageType :: RegularPage || getFormat () != SlottedFormat)
+		return false;
+
+	vector <void *> locations;
+	getRecordLocations (myPage->getBytes (), pageSize, temp, locations);
+	if (locations.size () == 0)
+		return false;
+
+	// figure out how big each column is... each record is its size, followed by its values
+	size_t numCols = temp->getSchema ()->getAtts ().size ();
+	vector <size_t> colSizes (numCols, 0);
+	for (void *loc : locations) {
+		char *pos = ((char *) loc) + sizeof (short);
+		for (size_t i = 0; i < numCols; i++) {
+			colSizes[i] += *((short *) pos);
+			pos += *((short *) pos);
+		}
+	}
+
+	size_t totSize = sizeof (MyDB_PageHeader) + sizeof (MyDB_PaxHeader) + numCols * sizeof (uint32_t);
+	for (size_t size : colSizes)
+		totSize += size;
+	if (totSize > pageSize)
+		return false;
+
+	// build the new page off to the side, since it is made from the records on this one
+	char *paxBytes = (char *) malloc (pageSize);
+	MyDB_PageHeader *header = getPageHeader (paxBytes);
+	header->type = MyDB_PageType :: PaxPage;
+	header->format = 0;
+	header->bytesUsed = totSize;
+	getPaxHeader (paxBytes)->numRecs = locations.size ();
+	getPaxHeader (paxBytes)->numCols = numCols;
+
+	vector <size_t> cursors;
+	size_t colStart = sizeof (MyDB_PageHeader) + sizeof (MyDB_PaxHeader) + numCols * sizeof (uint32_t);
+	for (size_t i = 0; i < numCols; i++) {
+		getColumnStart (paxBytes, i) = colStart;
+		cursors.push_back (colStart);
+		colStart += colSizes[i];
+	}
+
+	// and deal the values out to the columns
+	for (void *loc : locations) {
+		char *pos = ((char *) loc) + sizeof (short);
+		for (size_t i = 0; i < numCols; i++) {
+			short len = *((short *) pos);
+			memcpy (paxBytes + cursors[i], pos, len);
+			cursors[i] += len;
+			pos += len;
+		}
+	}
+
+	memcpy (myPage->getBytes (), paxBytes, pageSize);
+	myPage->wroteBytes ();
+	free (paxBytes);
+	return true;
+}
+
+void MyDB_PageReaderWriter :: copyTo (MyDB_PageReaderWriter &toMe, MyDB_RecordPtr temp) {
+	toMe.clear ();
+	MyDB_RecordIteratorAltPtr myIter = getIteratorAlt ();
+	while (myIter->advance ()) {
+		myIter->getCurrent (temp);
+		toMe.append (temp);
+	}
+}
+
 void MyDB_PageReaderWriter :: 
 	sortInPlace (function <bool ()> comparator, MyDB_RecordPtr lhs,  MyDB_RecordPtr rhs) {
 
+	// a PAX page is turned back into a regular page with slots, which is then sorted below
+	if (getType () == MyDB_PageType :: PaxPage) {
+		MyDB_PageReaderWriter rows (myPage->getParent ());
+		copyTo (rows, lhs);
+		memcpy (myPage->getBytes (), rows.getBytes (), pageSize);
+		myPage->wroteBytes ();
+	}
+
+	// on a slotted page, the records stay where they are, and we just put the slots in order
+	void *bytes = myPage->getBytes ();
+	RecordComparator myComparator (comparator, lhs, rhs);
+	if (getPageFormat (bytes) == SlottedFormat) {
+		vector <void *> positions;
+		getRecordLocations (bytes, pageSize, lhs, positions);
+		std::stable_sort (positions.begin (), positions.end (), myComparator);
+		for (size_t i = 0; i < positions.size (); i++)
+			getSlot (bytes, pageSize, i) = ((char *) positions[i]) - ((char *) bytes);
+		myPage->wroteBytes ();
+		return;
+	}
+
 	void *temp = malloc (pageSize);
-	memcpy (temp, myPage->getBytes (), pageSize);
+	memcpy (temp, bytes, pageSize);
 
 	// first, read in the positions of all of the records
 	vector <void *> positions;
-	
-	// this basically iterates through all of the records on the page
-	int bytesConsumed = sizeof (size_t) * 2;
-	while (bytesConsumed != NUM_BYTES_USED) {
-		void *pos = bytesConsumed + (char *) temp;
-		positions.push_back (pos);
-		void *nextPos = lhs->fromBinary (pos);
-		bytesConsumed += ((char *) nextPos) - ((char *) pos);
-	}
+	getRecordLocations (temp, pageSize, lhs, positions);
 
 	// and now we sort the vector of positions, using the record contents to build a comparator
-	RecordComparator myComparator (comparator, lhs, rhs);
 	std::stable_sort (positions.begin (), positions.end (), myComparator);
 
 	// and write the guys back
-	NUM_BYTES_USED = 2 * sizeof (size_t);
+	NUM_BYTES_USED = sizeof (MyDB_PageHeader);
 	myPage->wroteBytes ();	
 	for (void *pos : positions) {
 		lhs->fromBinary (pos);
@@ -149,25 +414,30 @@ void MyDB_PageReaderWriter ::
 MyDB_PageReaderWriterPtr MyDB_PageReaderWriter :: 
 	sort (function <bool ()> comparator, MyDB_RecordPtr lhs,  MyDB_RecordPtr rhs) {
 
+	// a slotted page is copied over as it is, and then its slots are put in order
+	MyDB_PageReaderWriterPtr returnVal = make_shared <MyDB_PageReaderWriter> (myPage->getParent ());
+	if (getType () == MyDB_PageType :: PaxPage) {
+		copyTo (*returnVal, lhs);
+		returnVal->sortInPlace (comparator, lhs, rhs);
+		return returnVal;
+	}
+	if (getFormat () == SlottedFormat) {
+		memcpy (returnVal->getBytes (), myPage->getBytes (), pageSize);
+		returnVal->sortInPlace (comparator, lhs, rhs);
+		return returnVal;
+	}
+
 	// first, read in the positions of all of the records
 	vector <void *> positions;
-	
-	// this basically iterates through all of the records on the page
-	int bytesConsumed = sizeof (size_t) * 2;
-	while (bytesConsumed != NUM_BYTES_USED) {
-		void *pos = bytesConsumed + (char *) myPage->getBytes ();
-		positions.push_back (pos);
-		void *nextPos = lhs->fromBinary (pos);
-		bytesConsumed += ((char *) nextPos) - ((char *) pos);
-	}
+	getRecordLocations (myPage->getBytes (), pageSize, lhs, positions);
 
 	// and now we sort the vector of positions, using the record contents to build a comparator
 	RecordComparator myComparator (comparator, lhs, rhs);
 	std::stable_sort (positions.begin (), positions.end (), myComparator);
 
-	// and now create the page to return
-	MyDB_PageReaderWriterPtr returnVal = make_shared <MyDB_PageReaderWriter> (myPage->getParent ());
-	returnVal->clear ();
+	// and now fill up the page to return... it has no slots either, since the records of a
+	// full page without slots might not fit on a page with them
+	returnVal->clear (StreamFormat);
 	
 	// loop through all of the sorted records and write them out
 	for (void *pos : positions) {
@@ -186,4 +456,20 @@ void *MyDB_PageReaderWriter :: getBytes () {
 	return myPage->getBytes ();
 }
 
+void MyDB_PageReaderWriter :: prefetch () {
+	if (myPage != nullptr)
+		myPage->getParent ().prefetch (myPage);
+}
+
+void MyDB_PageReaderWriter :: setHint (MyDB_AccessHint hint) {
+	if (myPage != nullptr)
+		myPage->getParent ().setHint (myPage, hint);
+}
+
+void MyDB_PageReaderWriter :: discard () {
+	if (myPage != nullptr)
+		myPage->discard ();
+	myPage = nullptr;
+}
+
 #endif
@@ -13,28 +13,35 @@
 #ifndef PAGE_REC_ITER_C
 #define PAGE_REC_ITER_C
 
+#include "MyDB_PageLayout.h"
 #include "MyDB_PageRecIterator.h"
-#include "MyDB_PageType.h"
-
-#define NUM_BYTES_USED *((size_t *) (((char *) myPage->getBytes ()) + sizeof (size_t)))
 
 void MyDB_PageRecIterator :: getNext () {
-	void *pos = bytesConsumed + (char *) myPage->getBytes ();
+	void *pos = getCurrentPointer ();
  	void *nextPos = myRec->fromBinary (pos);
 	bytesConsumed += ((char *) nextPos) - ((char *) pos);	
+	slotsConsumed++;
 }
 
 void *MyDB_PageRecIterator :: getCurrentPointer () {
-	return bytesConsumed + (char *) myPage->getBytes ();
+	char *bytes = (char *) myPage->getBytes ();
+	if (getPageFormat (bytes) == SlottedFormat)
+		return bytes + getSlot (bytes, pageSize, slotsConsumed);
+	return bytes + bytesConsumed;
 }
 
 bool MyDB_PageRecIterator :: hasNext () {
-	return bytesConsumed != NUM_BYTES_USED;
+	void *bytes = myPage->getBytes ();
+	if (getPageFormat (bytes) == SlottedFormat)
+		return (size_t) slotsConsumed < getNumSlots (bytes, pageSize);
+	return bytesConsumed != getPageHeader (bytes)->bytesUsed;
 }
 
-MyDB_PageRecIterator :: MyDB_PageRecIterator (MyDB_PageHandle myPageIn, MyDB_RecordPtr myRecIn) {
-	bytesConsumed = sizeof (size_t) * 2;
+MyDB_PageRecIterator :: MyDB_PageRecIterator (MyDB_PageHandle myPageIn, size_t pageSizeIn, MyDB_RecordPtr myRecIn) {
+	bytesConsumed = sizeof (MyDB_PageHeader);
+	slotsConsumed = 0;
 	myPage = myPageIn;
+	pageSize = pageSizeIn;
 	myRec = myRecIn;
 }
 
@@ -13,19 +13,26 @@
 #ifndef PAGE_REC_ITER_ALT_C
 #define PAGE_REC_ITER_ALT_C
 
+#include "MyDB_PageLayout.h"
 #include "MyDB_PageRecIteratorAlt.h"
-#include "MyDB_PageType.h"
-
-#define NUM_BYTES_USED *((size_t *) (((char *) myPage->getBytes ()) + sizeof (size_t)))
 
 void MyDB_PageRecIteratorAlt :: getCurrent (MyDB_RecordPtr intoMe) {
-	void *pos = bytesConsumed + (char *) myPage->getBytes ();
+	void *pos = getCurrentPointer ();
  	void *nextPos = intoMe->fromBinary (pos);
 	nextRecSize = ((char *) nextPos) - ((char *) pos);	
 }
 
+void MyDB_PageRecIteratorAlt :: getCurrentView (MyDB_RecordPtr intoMe) {
+	void *pos = getCurrentPointer ();
+ 	void *nextPos = intoMe->viewBinary (pos);
+	nextRecSize = ((char *) nextPos) - ((char *) pos);	
+}
+
 void *MyDB_PageRecIteratorAlt :: getCurrentPointer () {
-	return bytesConsumed + (char *) myPage->getBytes ();
+	char *bytes = (char *) myPage->getBytes ();
+	if (getPageFormat (bytes) == SlottedFormat)
+		return bytes + getSlot (bytes, pageSize, slotsConsumed);
+	return bytes + bytesConsumed;
 }
 
 bool MyDB_PageRecIteratorAlt :: advance () {
@@ -34,13 +41,22 @@ bool MyDB_PageRecIteratorAlt :: advance () {
 		exit (1);
 	}
 	bytesConsumed += nextRecSize;
+	slotsConsumed++;
 	nextRecSize = -1;
-	return bytesConsumed != NUM_BYTES_USED;
+
+	void *bytes = myPage->getBytes ();
+	if (getPageFormat (bytes) == SlottedFormat)
+		return (size_t) slotsConsumed < getNumSlots (bytes, pageSize);
+	return bytesConsumed != getPageHeader (bytes)->bytesUsed;
 }
 
-MyDB_PageRecIteratorAlt :: MyDB_PageRecIteratorAlt (MyDB_PageHandle myPageIn) {
-	bytesConsumed = sizeof (size_t) * 2;
+MyDB_PageRecIteratorAlt :: MyDB_PageRecIteratorAlt (MyDB_PageHandle myPageIn, size_t pageSizeIn) {
+	bytesConsumed = sizeof (MyDB_PageHeader);
+
+	// the first call to advance () moves to the first slot
+	slotsConsumed = -1;
 	myPage = myPageIn;
+	pageSize = pageSizeIn;
 	nextRecSize = 0;
 }
 
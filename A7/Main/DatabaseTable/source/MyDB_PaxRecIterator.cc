@@ -0,0 +1,46 @@
+
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A2.  You should not be looking at this file     **
+** unless you have completed A2!                   **
+****************************************************/
+
+
+#ifndef PAX_REC_ITER_C
+#define PAX_REC_ITER_C
+
+#include "MyDB_PaxRecIterator.h"
+
+void MyDB_PaxRecIterator :: getNext () {
+	if (hasNext ()) {
+		myIter.getCurrent (myRec);
+		advanced = false;
+	}
+}
+
+void *MyDB_PaxRecIterator :: getCurrentPointer () {
+	return nullptr;
+}
+
+bool MyDB_PaxRecIterator :: hasNext () {
+	if (!advanced) {
+		more = myIter.advance ();
+		advanced = true;
+	}
+	return more;
+}
+
+MyDB_PaxRecIterator :: MyDB_PaxRecIterator (MyDB_PageHandle myPageIn, vector <int> &whichAtts, MyDB_RecordPtr myRecIn) :
+	myIter (myPageIn, whichAtts) {
+	myRec = myRecIn;
+	advanced = false;
+	more = false;
+}
+
+MyDB_PaxRecIterator :: ~MyDB_PaxRecIterator () {}
+
+#endif
@@ -0,0 +1,65 @@
+
+
+/****************************************************
+** COPYRIGHT 2016, Chris Jermaine, Rice University **
+**                                                 **
+** The MyDB Database System, COMP 530              **
+** Note that this file contains SOLUTION CODE for  **
+** A2.  You should not be looking at this file     **
+** unless you have completed A2!                   **
+****************************************************/
+
+
+#ifndef PAX_REC_ITER_ALT_C
+#define PAX_REC_ITER_ALT_C
+
+#include "MyDB_PageLayout.h"
+#include "MyDB_PaxRecIteratorAlt.h"
+
+void MyDB_PaxRecIteratorAlt :: setLocations () {
+	char *bytes = (char *) myPage->getBytes ();
+	for (size_t i = 0; i < cursors.size (); i++)
+		locations[i] = bytes + cursors[i];
+}
+
+void MyDB_PaxRecIteratorAlt :: getCurrent (MyDB_RecordPtr intoMe) {
+	setLocations ();
+	intoMe->fromColumns (whichAtts, locations, true);
+}
+
+void MyDB_PaxRecIteratorAlt :: getCurrentView (MyDB_RecordPtr intoMe) {
+	setLocations ();
+	intoMe->fromColumns (whichAtts, locations, false);
+}
+
+void *MyDB_PaxRecIteratorAlt :: getCurrentPointer () {
+	return nullptr;
+}
+
+bool MyDB_PaxRecIteratorAlt :: advance () {
+	char *bytes = (char *) myPage->getBytes ();
+
+	// the first call moves to the start of each column; after that, we move past the current values
+	if (curRec == -1) {
+		for (size_t i = 0; i < cursors.size (); i++)
+			cursors[i] = getColumnStart (bytes, whichAtts[i]);
+	} else {
+		for (size_t i = 0; i < cursors.size (); i++)
+			cursors[i] += *((short *) (bytes + cursors[i]));
+	}
+
+	curRec++;
+	return curRec < getPaxHeader (bytes)->numRecs;
+}
+
+MyDB_PaxRecIteratorAlt :: MyDB_PaxRecIteratorAlt (MyDB_PageHandle myPageIn, vector <int> &whichAttsIn) {
+	myPage = myPageIn;
+	whichAtts = whichAttsIn;
+	cursors.resize (whichAtts.size ());
+	locations.resize (whichAtts.size ());
+	curRec = -1;
+}
+
+MyDB_PaxRecIteratorAlt :: ~MyDB_PaxRecIteratorAlt () {}
+
+#endif
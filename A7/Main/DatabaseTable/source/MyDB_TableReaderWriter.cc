@@ -69,6 +69,10 @@ MyDB_PageReaderWriter MyDB_TableReaderWriter :: getPinned (size_t i) {
 }
 
 MyDB_PageReaderWriter MyDB_TableReaderWriter :: operator [] (size_t i) {
+	return getPage (i, NormalAccess);
+}
+
+MyDB_PageReaderWriter MyDB_TableReaderWriter :: getPage (size_t i, MyDB_AccessHint hint) {
 	
 	// see if we are going off of the end of the file... if so, then clear those pages
 	while (i > forMe->lastPage ()) {
@@ -78,10 +82,51 @@ MyDB_PageReaderWriter MyDB_TableReaderWriter :: operator [] (size_t i) {
 	}
 
 	// now get the page
-	MyDB_PageReaderWriter arrayAccessBuffer (*this, i);
+	MyDB_PageReaderWriter arrayAccessBuffer (false, *this, i, hint);
 	return arrayAccessBuffer;
 }
 
+vector <MyDB_PageReaderWriter> MyDB_TableReaderWriter :: getPages (vector <long> &positions, MyDB_AccessHint hint) {
+	vector <MyDB_PageReaderWriter> pages;
+	for (MyDB_PageHandle page : myBuffer->getPages (forMe, positions, hint))
+		pages.push_back (MyDB_PageReaderWriter (page, myBuffer->getPageSize ()));
+	return pages;
+}
+
+vector <MyDB_PageReaderWriter> MyDB_TableReaderWriter :: getPinnedPages (vector <long> &positions) {
+	return getPinnedPages (positions, nullptr);
+}
+
+vector <MyDB_PageReaderWriter> MyDB_TableReaderWriter :: getPinnedPages (vector <long> &positions,
+	MyDB_MemoryGrantPtr grant) {
+	vector <MyDB_PageReaderWriter> pages;
+	for (MyDB_PageHandle page : myBuffer->getPinnedPages (forMe, positions, grant))
+		pages.push_back (MyDB_PageReaderWriter (page, myBuffer->getPageSize ()));
+	return pages;
+}
+
+int MyDB_TableReaderWriter :: readAhead (int curPage, int prefetchedThrough, int highPage) {
+
+	// keep between READ_AHEAD_PAGES / 2 and READ_AHEAD_PAGES pages in flight, asking
+	// for them half a window at a time
+	if (prefetchedThrough >= curPage + READ_AHEAD_PAGES / 2)
+		return prefetchedThrough;
+
+	int lastWanted = curPage + READ_AHEAD_PAGES;
+	if (lastWanted > forMe->lastPage ())
+		lastWanted = forMe->lastPage ();
+	if (lastWanted > highPage)
+		lastWanted = highPage;
+
+	int firstWanted = prefetchedThrough + 1;
+	if (firstWanted < curPage)
+		firstWanted = curPage;
+
+	if (lastWanted >= firstWanted)
+		myBuffer->prefetch (forMe, firstWanted, lastWanted - firstWanted + 1);
+	return lastWanted;
+}
+
 MyDB_RecordPtr MyDB_TableReaderWriter :: getEmptyRecord () {
 
 	// use the schema to produce an empty record
@@ -98,6 +143,10 @@ void MyDB_TableReaderWriter :: append (MyDB_RecordPtr appendMe) {
 	// try to append the record on the current page...
 	if (!lastPage->append (appendMe)) {
 
+		// the full page is not going to change any more, so it can be stored a column at a time
+		if (forMe->isPax ())
+			lastPage->toPax (getEmptyRecord ());
+
 		// if we cannot, then get a new last page and append
 		forMe->setLastPage (forMe->lastPage () + 1);
 		lastPage = make_shared <MyDB_PageReaderWriter> (*this, forMe->lastPage ());
@@ -186,6 +235,10 @@ MyDB_RecordIteratorAltPtr MyDB_TableReaderWriter :: getIteratorAlt (int lowPage,
 	return make_shared <MyDB_TableRecIteratorAlt> (*this, forMe, lowPage, highPage);
 }
 
+MyDB_RecordIteratorAltPtr MyDB_TableReaderWriter :: getIteratorAlt (vector <int> &whichAtts) {
+	return make_shared <MyDB_TableRecIteratorAlt> (*this, forMe, whichAtts);
+}
+
 void MyDB_TableReaderWriter :: writeIntoTextFile (string fName) {
 	
 	// open up the output file
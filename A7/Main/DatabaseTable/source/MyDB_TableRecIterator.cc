@@ -25,22 +25,29 @@ void *MyDB_TableRecIterator :: getCurrentPointer () {
 }
 
 bool MyDB_TableRecIterator :: hasNext () {
-	if (myParent[curPage].getType () == MyDB_PageType :: RegularPage && myIter->hasNext ())
+	if (myParent[curPage].getType () != MyDB_PageType :: DirectoryPage && myIter->hasNext ())
 		return true;
 
 	if (curPage == myTable->lastPage ())
 		return false;
 
 	curPage++;
+	readAhead ();
 	myIter = myParent[curPage].getIterator (myRec);
 	return hasNext ();
 }
 
+void MyDB_TableRecIterator :: readAhead () {
+	prefetchedThrough = myParent.readAhead (curPage, prefetchedThrough, myTable->lastPage ());
+}
+
 MyDB_TableRecIterator :: MyDB_TableRecIterator (MyDB_TableReaderWriter &myParent, MyDB_TablePtr myTableIn,
 	MyDB_RecordPtr myRecIn) : myParent (myParent) {
 	myTable = myTableIn;
 	myRec = myRecIn;
 	curPage = 0;
+	prefetchedThrough = -1;
+	readAhead ();
 	myIter = myParent[curPage].getIterator (myRec);		
 }
 
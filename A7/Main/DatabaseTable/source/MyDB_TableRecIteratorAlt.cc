@@ -20,30 +20,49 @@ void MyDB_TableRecIteratorAlt :: getCurrent (MyDB_RecordPtr intoMe) {
 	myIter->getCurrent (intoMe);
 }
 
+void MyDB_TableRecIteratorAlt :: getCurrentView (MyDB_RecordPtr intoMe) {
+	myIter->getCurrentView (intoMe);
+}
+
 void *MyDB_TableRecIteratorAlt :: getCurrentPointer () {
 	return myIter->getCurrentPointer ();
 }
 
 bool MyDB_TableRecIteratorAlt :: advance () {
 
-	if (myParent[curPage].getType () == MyDB_PageType :: RegularPage && myIter->advance ())
+	// a scan reads each page once, so its pages go at the eviction end of the buffer
+	if (myParent.getPage (curPage, SequentialAccess).getType () != MyDB_PageType :: DirectoryPage && myIter->advance ())
 		return true;
 
 	if (curPage == myTable->lastPage () || curPage == highPage)
 		return false;
 
 	curPage++;
-	myIter = myParent[curPage].getIteratorAlt ();
+	readAhead ();
+	myIter = getPageIterator ();
 	return advance ();
 }
 
+MyDB_RecordIteratorAltPtr MyDB_TableRecIteratorAlt :: getPageIterator () {
+	if (someAtts)
+		return myParent.getPage (curPage, SequentialAccess).getIteratorAlt (whichAtts);
+	return myParent.getPage (curPage, SequentialAccess).getIteratorAlt ();
+}
+
+void MyDB_TableRecIteratorAlt :: readAhead () {
+	prefetchedThrough = myParent.readAhead (curPage, prefetchedThrough, highPage);
+}
+
 MyDB_TableRecIteratorAlt :: MyDB_TableRecIteratorAlt (MyDB_TableReaderWriter &myParent, MyDB_TablePtr myTableIn,
 	int lowPage, int highPageIn) :
 	myParent (myParent) {
 	myTable = myTableIn;
 	curPage = lowPage;
 	highPage = highPageIn;
-	myIter = myParent[curPage].getIteratorAlt ();		
+	someAtts = false;
+	prefetchedThrough = lowPage - 1;
+	readAhead ();
+	myIter = getPageIterator ();		
 }
 
 MyDB_TableRecIteratorAlt :: MyDB_TableRecIteratorAlt (MyDB_TableReaderWriter &myParent, MyDB_TablePtr myTableIn) :
@@ -51,7 +70,23 @@ MyDB_TableRecIteratorAlt :: MyDB_TableRecIteratorAlt (MyDB_TableReaderWriter &my
 	myTable = myTableIn;
 	curPage = 0;
 	highPage = 1999999999;
-	myIter = myParent[curPage].getIteratorAlt ();		
+	someAtts = false;
+	prefetchedThrough = -1;
+	readAhead ();
+	myIter = getPageIterator ();		
+}
+
+MyDB_TableRecIteratorAlt :: MyDB_TableRecIteratorAlt (MyDB_TableReaderWriter &myParent, MyDB_TablePtr myTableIn,
+	vector <int> &whichAttsIn) :
+	myParent (myParent) {
+	myTable = myTableIn;
+	curPage = 0;
+	highPage = 1999999999;
+	whichAtts = whichAttsIn;
+	someAtts = true;
+	prefetchedThrough = -1;
+	readAhead ();
+	myIter = getPageIterator ();
 }
 
 MyDB_TableRecIteratorAlt :: ~MyDB_TableRecIteratorAlt () {}
@@ -27,6 +27,15 @@ void appendRecord (MyDB_PageReaderWriter &curPage, vector <MyDB_PageReaderWriter
 	}
 }
 
+// the page that records are gathered on before they are sorted... it is pinned if there is a
+// frame for it, but nothing points into it, so it can be written out if there is not
+MyDB_PageReaderWriter getStagingPage (MyDB_BufferManagerPtr parent) {
+	MyDB_PageReaderWriter returnVal (true, *parent);
+	if (!returnVal.hasRAM ())
+		returnVal = MyDB_PageReaderWriter (*parent);
+	return returnVal;
+}
+
 vector <MyDB_PageReaderWriter> mergeIntoList (MyDB_BufferManagerPtr parent, MyDB_RecordIteratorAltPtr leftIter, 
 	MyDB_RecordIteratorAltPtr rightIter, function <bool ()> comparator, MyDB_RecordPtr lhs, MyDB_RecordPtr rhs) {
 	
@@ -124,10 +133,10 @@ MyDB_RecordIteratorAltPtr buildItertorOverSortedRuns (int runSize, MyDB_TableRea
 	vector <MyDB_RecordIteratorAltPtr> runIters;
 	
 	// process the file 
-	MyDB_PageReaderWriter tempPage (true, *sortMe.getBufferMgr ());
+	MyDB_PageReaderWriter tempPage = getStagingPage (sortMe.getBufferMgr ());
 	for (int i = 0; i < sortMe.getNumPages (); i++) {
 		
-		if (sortMe[i].getType () == MyDB_PageType :: RegularPage) {
+		if (sortMe[i].getType () != MyDB_PageType :: DirectoryPage) {
 
 			if (skipPred) {
 				vector <MyDB_PageReaderWriter> run;
@@ -149,7 +158,7 @@ MyDB_RecordIteratorAltPtr buildItertorOverSortedRuns (int runSize, MyDB_TableRea
 						pagesToSort.push_back (run);
 	
 						// get the new page
-						tempPage = MyDB_PageReaderWriter (true, *sortMe.getBufferMgr ());	
+						tempPage = getStagingPage (sortMe.getBufferMgr ());
 						temp->getCurrent (lhs);
 						tempPage.append (lhs);
 					}
@@ -191,8 +200,8 @@ MyDB_RecordIteratorAltPtr buildItertorOverSortedRuns (int runSize, MyDB_TableRea
 				pagesToSort.pop_back ();
 		
 				// merge them
-				newPagesToSort.push_back (mergeIntoList (sortMe.getBufferMgr (), getIteratorAlt (runOne), 
-					getIteratorAlt (runTwo), comparator, lhs, rhs));
+				newPagesToSort.push_back (mergeIntoList (sortMe.getBufferMgr (), getConsumingIteratorAlt (runOne), 
+					getConsumingIteratorAlt (runTwo), comparator, lhs, rhs));
 			}
 	
 			pagesToSort = newPagesToSort;
@@ -200,7 +209,7 @@ MyDB_RecordIteratorAltPtr buildItertorOverSortedRuns (int runSize, MyDB_TableRea
 
 		
 		// now we have a single list, so create an iterator for it
-		runIters.push_back (getIteratorAlt (pagesToSort[0]));
+		runIters.push_back (getConsumingIteratorAlt (pagesToSort[0]));
 
 		// and start over on the next run
 		pagesToSort.clear ();
@@ -180,11 +180,20 @@ MyDB_TableReaderWriterPtr LogicalJoin ::execute()
 
 	MyDB_TableReaderWriterPtr outputTable = make_shared<MyDB_TableReaderWriter>(outputSpec, left->getBufferMgr());
 
-	// SortMergeJoin sortMergeJoin(left, right, outputTable, finalPred, projections, equalityChecks[0], leftSelectionPredicateString, rightSelectionPredicateString);
-	// sortMergeJoin.run();
-
-	ScanJoin scanJoin(left, right, outputTable, finalPred, projections, equalityChecks, leftSelectionPredicateString, rightSelectionPredicateString);
-	scanJoin.run();
+	// a scan join pins every page of the smaller input, so we only use one if the buffer manager
+	// can spare that many frames (or if there is nothing to sort on); otherwise, we use a
+	// sort-merge join, which gets by with whatever RAM it is granted
+	size_t smallerSide = min(left->getNumPages(), right->getNumPages());
+	if (equalityChecks[0].first == "bool[true]" || smallerSide <= bufferMgr->getNumGrantableFrames())
+	{
+		ScanJoin scanJoin(left, right, outputTable, finalPred, projections, equalityChecks, leftSelectionPredicateString, rightSelectionPredicateString);
+		scanJoin.run();
+	}
+	else
+	{
+		SortMergeJoin sortMergeJoin(left, right, outputTable, finalPred, projections, equalityChecks[0], leftSelectionPredicateString, rightSelectionPredicateString);
+		sortMergeJoin.run();
+	}
 	// cout << "target " << outputSpec->getName() << ": JOIN COMPLETE" << endl;
 
 	bufferMgr->killTable(left->getTable());
@@ -60,9 +60,11 @@ LogicalOpPtr SFWQuery ::join(map<string, MyDB_TablePtr> &allTables, map<string,
 			}
 		}
 
+		// the output can't just be named after the alias, since the alias is often the name of
+		// the table being scanned, and the buffer manager would then think they were the same table
 		auto res = make_shared<LogicalTableScan>(
 				allTableReaderWriters[tableInfo.first],
-				make_shared<MyDB_Table>(tableInfo.second, tableInfo.second + storageSuffix, outputScheme),
+				make_shared<MyDB_Table>(tableInfo.second + "_scan", tableInfo.second + "_scan" + storageSuffix, outputScheme),
 				make_shared<MyDB_Stats>(targetTable, tableInfo.second),
 				CNF, exprsToCompute);
 
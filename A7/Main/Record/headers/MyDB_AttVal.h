@@ -5,80 +5,92 @@
 #include <memory>
 #include <string>
 #include <string.h>
+#include "MyDB_Value.h"
 
 // create a smart pointer for the catalog
 using namespace std;
 class MyDB_AttVal;
 typedef shared_ptr <MyDB_AttVal> MyDB_AttValPtr;
 
+// an attribute value that can be passed around by pointer... this is a thin wrapper around a
+// MyDB_Value, which is either its own or one kept somewhere else (an attribute of a record, or
+// the result of a computation over a record), and everything that it does is done by that value.
+// Code that works a tuple at a time should use MyDB_Value directly (see MyDB_Record.getValue ()
+// and MyDB_Record.compileValueComputation ())
 class MyDB_AttVal {
 
-private:
-
-	// this is a pointer into a buffer
-	void *myData;
+public:
 
-	// this tells us whether we are using the buffer
-	bool usingBuffer;
+	int toInt () {
+		return myVal->toInt ();
+	}
 
-public:
+	void fromInt (int fromMe) {
+		myVal->fromInt (fromMe);
+	}
 
-	virtual int toInt () = 0;
-	virtual void fromInt (int fromMe) = 0;
-	virtual double toDouble () = 0;
-	virtual string toString () = 0;
-	virtual bool toBool () = 0;
-	virtual void set (MyDB_AttValPtr toMe) = 0;
-	virtual size_t hash () = 0;
-	virtual MyDB_AttValPtr getCopy () = 0;
-	virtual void fromString (string &fromMe) = 0;
-	virtual void serialize (char *&buffer, size_t &allocatedSize, size_t &totSize) = 0;
-	virtual ~MyDB_AttVal ();
+	double toDouble () {
+		return myVal->toDouble ();
+	}
 
-	// this gets a pointer to our data... useful because we can avoid deserializing the record
-	inline void *getDataPointer () {
-		return myData;
+	string toString () {
+		return myVal->toString ();
 	}
 
-	inline void extendBuffer (char *&buffer, size_t &allocatedSize, size_t &totSize, int extraSpaceNeeded) {
-		if (totSize + extraSpaceNeeded > allocatedSize) {
-			size_t newSize = (totSize + extraSpaceNeeded) * 2;
-			char *newBuff = new char[newSize];
-			memcpy (newBuff, buffer, allocatedSize);
-			delete [] buffer;
-			buffer = newBuff;
-			allocatedSize = newSize;
-		}
+	bool toBool () {
+		return myVal->toBool ();
 	}
 
-	inline void setBuffered (char *where) {
-		myData = where;
-		usingBuffer = true;
+	// sets the value from toMe, converting it to the type of this value
+	void set (MyDB_AttValPtr toMe) {
+		myVal->set (*toMe->myVal);
 	}
 
-	inline void setNotBuffered () {
-		myData = nullptr;
-		usingBuffer = false;
+	size_t hash () {
+		return myVal->hash ();
 	}
 
-	MyDB_AttVal () {
-		setNotBuffered ();	
+	void fromString (string &fromMe) {
+		myVal->fromString (fromMe);
 	}
 
-	inline char *fromBinary (char *fromHere) {
+	void serialize (char *&buffer, size_t &allocatedSize, size_t &totSize) {
+		myVal->serialize (buffer, allocatedSize, totSize);
+	}
 
-		// this is the length
-		int myLen = *((short *) fromHere);
+	// gets a new attribute value, with its own copy of this one
+	MyDB_AttValPtr getCopy ();
 
-		// remember our data
-		setBuffered (fromHere + sizeof (short));
+	// the value that this is looking at
+	MyDB_Value &getValue () {
+		return *myVal;
+	}
 
-		// and return a pointer to the next guy
-		return fromHere + myLen; 
+	// makes this look at a different value
+	void setValue (MyDB_Value *toMe) {
+		myVal = toMe;
 	}
 
+	// a value of its own, of the given type
+	MyDB_AttVal (MyDB_ValueType type);
+
+	// a value that is kept somewhere else
+	MyDB_AttVal (MyDB_Value *toMe);
+
+	// there is no copying, as a copy would look at the original's value
+	MyDB_AttVal (const MyDB_AttVal &) = delete;
+	MyDB_AttVal &operator = (const MyDB_AttVal &) = delete;
+
+	virtual ~MyDB_AttVal ();
+
+private:
+
+	MyDB_Value ownVal;
+	MyDB_Value *myVal;
 };
 
+// these are attribute values of their own of each type, which can be set directly
+
 class MyDB_IntAttVal;
 typedef shared_ptr <MyDB_IntAttVal> MyDB_IntAttValPtr;
 
@@ -86,23 +98,10 @@ class MyDB_IntAttVal : public MyDB_AttVal {
 
 public:
 
-	int toInt () override;
-	double toDouble () override;
-	string toString () override;
-	void fromInt (int fromMe) override;
-	bool toBool () override;
-	void fromString (string &fromMe) override;
-	void set (MyDB_AttValPtr toMe) override;
-	size_t hash () override;
-	MyDB_AttValPtr getCopy () override;
-	void serialize (char *&buffer, size_t &allocatedSize, size_t &totSize) override;
+	using MyDB_AttVal :: set;
 	void set (int val);
 	MyDB_IntAttVal ();
 	~MyDB_IntAttVal ();
-
-private:
-
-	int value;
 };
 
 class MyDB_DoubleAttVal;
@@ -112,23 +111,10 @@ class MyDB_DoubleAttVal : public MyDB_AttVal {
 
 public:
 
-	int toInt () override;
-	double toDouble () override;
-	string toString () override;
-	bool toBool () override;
-	void fromInt (int fromMe) override;
-	MyDB_AttValPtr getCopy () override;
-	size_t hash () override;
-	void set (MyDB_AttValPtr toMe) override;
-	void fromString (string &fromMe) override;
-	void serialize (char *&buffer, size_t &allocatedSize, size_t &totSize) override;
+	using MyDB_AttVal :: set;
 	void set (double val);
 	MyDB_DoubleAttVal ();
 	~MyDB_DoubleAttVal ();
-
-private:
-
-	double value;
 };
 
 class MyDB_StringAttVal;
@@ -138,23 +124,10 @@ class MyDB_StringAttVal : public MyDB_AttVal {
 
 public:
 
-	int toInt () override;
-	double toDouble () override;
-	string toString () override;
-	bool toBool () override;
-	void fromString (string &fromMe) override;
-	MyDB_AttValPtr getCopy () override;
-	size_t hash () override;
-	void set (MyDB_AttValPtr toMe) override;
-	void serialize (char *&buffer, size_t &allocatedSize, size_t &totSize) override;
-	void fromInt (int fromMe) override;
+	using MyDB_AttVal :: set;
 	void set (string val);
 	MyDB_StringAttVal ();
 	~MyDB_StringAttVal ();
-
-private:
-
-	string value;
 };
 
 class MyDB_BoolAttVal;
@@ -164,25 +137,10 @@ class MyDB_BoolAttVal : public MyDB_AttVal {
 
 public:
 
-	int toInt () override;
-	double toDouble () override;
-	string toString () override;
-	bool toBool () override;
-	void fromString (string &fromMe) override;
-	void set (MyDB_AttValPtr toMe) override;
-	MyDB_AttValPtr getCopy () override;
-	size_t hash () override;
-	void fromInt (int fromMe) override;
-	void serialize (char *&buffer, size_t &allocatedSize, size_t &totSize) override;
+	using MyDB_AttVal :: set;
 	void set (bool val);
 	MyDB_BoolAttVal ();
 	~MyDB_BoolAttVal ();
-
-private:
-
-	bool value;
 };
 
-
-
 #endif
@@ -16,6 +16,7 @@ public:
 	MyDB_INRecord (MyDB_AttValPtr myAtt) : MyDB_Record (nullptr) {
 		values.push_back (myAtt);
 		values.push_back (make_shared <MyDB_IntAttVal> ());	
+		refreshValuePointers ();
 		bufferOld = true;
 	}
 
@@ -30,6 +31,7 @@ public:
 
 	void setKey (MyDB_AttValPtr toMe) {
 		values[0] = toMe;
+		refreshValuePointers ();
 		bufferOld = true;
 	}
 
@@ -2,6 +2,7 @@
 #ifndef RECORD_H
 #define RECORD_H
 
+#include <deque>
 #include <functional>
 #include "MyDB_AttVal.h"
 #include "MyDB_Schema.h"
@@ -18,6 +19,9 @@ typedef shared_ptr <MyDB_Record> MyDB_RecordPtr;
 // a lambda function over the record... computes an attribute value
 typedef function <MyDB_AttValPtr ()> func;
 
+// the same, but the value is handed back directly; it is only good until the next call
+typedef function <MyDB_Value &()> valFunc;
+
 class MyDB_Record {
 
 public:
@@ -62,6 +66,24 @@ public:
 	// 	
 	void *fromBinary (void *startPos);
 
+	// like fromBinary, but nothing is copied; the attribute values are read right off of
+	// the bytes at startPos.  So the record (and anything computed over it that has not
+	// been copied elsewhere) is only good as long as those bytes are... for a record on
+	// a page, that is while the page is pinned, or if it is not pinned, until the next
+	// time that the buffer manager is asked for a page that could push this one out
+	void *viewBinary (void *startPos);
+
+	// loads just the attributes in whichAtts, whose serialized values (a length and then
+	// the data, as in a record) are at the corresponding locations; this is for reading
+	// records that are stored a column at a time.  If copy is false, the attributes are
+	// read right off of those locations, as with viewBinary.  The other attributes are
+	// left as they were, so the record should only be written out if all were loaded
+	void fromColumns (vector <int> &whichAtts, vector <char *> &locations, bool copy);
+
+	// the attributes that are named (as [attName]) in any of the given computations... as
+	// this just looks for the names, a string literal that looks like one is counted too
+	vector <int> getReferencedAtts (vector <string> &computations);
+
 	// parse the contents of this record from the given string
 	void fromString (string fromMe);
 
@@ -100,6 +122,10 @@ public:
 	//
 	func compileComputation (string fromMe);
 
+	// like the above, except that the result is a MyDB_Value.  This is much cheaper to run than
+	// the above, which is kept for code that works with attribute values (MyDB_AttValPtr)
+	valFunc compileValueComputation (string fromMe);
+
 	// gets the type of a string to compile
 	MyDB_AttTypePtr getType (string compileMe);
 
@@ -118,6 +144,9 @@ public:
 	// access a particular attribute
 	MyDB_AttValPtr &getAtt (int whichAtt);
 
+	// access the value of a particular attribute directly
+	MyDB_Value &getValue (int whichAtt);
+
 private:
 
 	// for fast reading from a page; the contents of the record are simply copied into this buffer
@@ -129,30 +158,49 @@ private:
 	// the amount of data in the record buffer
 	size_t recSize;
 
+	// if the record was last loaded via viewBinary, these are the bytes that it is looking at
+	char *view;
+
+	// attribute values copied in by fromColumns go here, and this is its size
+	char *colBuffer;
+	size_t colAllocated;
+
+	// column buffers that fromColumns has outgrown, which attributes may still be looking at;
+	// these are freed once every attribute has been loaded again
+	vector <char *> oldColBuffers;
+	void freeOldColBuffers ();
+
 	// helper function for the compilation
-	pair <func, MyDB_AttTypePtr> compileHelper (char * &vals);
+	pair <valFunc, MyDB_AttTypePtr> compileHelper (char * &vals);
 
 	// helper function for the compilation
 	char *findsymbol (char val, char *input);
 	
 	// these functions are all used to build up computations over the record
-	pair <func, MyDB_AttTypePtr> fromData (string attName);
-	pair <func, MyDB_AttTypePtr> plus (pair <func, MyDB_AttTypePtr> lhs, pair <func, MyDB_AttTypePtr> rhs);
-	pair <func, MyDB_AttTypePtr> minus (pair <func, MyDB_AttTypePtr> lhs, pair <func, MyDB_AttTypePtr> rhs);
-	pair <func, MyDB_AttTypePtr> times (pair <func, MyDB_AttTypePtr> lhs, pair <func, MyDB_AttTypePtr> rhs);
-	pair <func, MyDB_AttTypePtr> divide (pair <func, MyDB_AttTypePtr> lhs, pair <func, MyDB_AttTypePtr> rhs);
-	pair <func, MyDB_AttTypePtr> gt (pair <func, MyDB_AttTypePtr> lhs, pair <func, MyDB_AttTypePtr> rhs);
-	pair <func, MyDB_AttTypePtr> lt (pair <func, MyDB_AttTypePtr> lhs, pair <func, MyDB_AttTypePtr> rhs);
-	pair <func, MyDB_AttTypePtr> eq (pair <func, MyDB_AttTypePtr> lhs, pair <func, MyDB_AttTypePtr> rhs);
-	pair <func, MyDB_AttTypePtr> neq (pair <func, MyDB_AttTypePtr> lhs, pair <func, MyDB_AttTypePtr> rhs);
-	pair <func, MyDB_AttTypePtr> andd (pair <func, MyDB_AttTypePtr> lhs, pair <func, MyDB_AttTypePtr> rhs);
-	pair <func, MyDB_AttTypePtr> orr (pair <func, MyDB_AttTypePtr> lhs, pair <func, MyDB_AttTypePtr> rhs);
-	pair <func, MyDB_AttTypePtr> unaryMinus (pair <func, MyDB_AttTypePtr> lhs);
-	pair <func, MyDB_AttTypePtr> nott (pair <func, MyDB_AttTypePtr> lhs);
+	pair <valFunc, MyDB_AttTypePtr> fromData (string attName);
+	pair <valFunc, MyDB_AttTypePtr> plus (pair <valFunc, MyDB_AttTypePtr> lhs, pair <valFunc, MyDB_AttTypePtr> rhs);
+	pair <valFunc, MyDB_AttTypePtr> minus (pair <valFunc, MyDB_AttTypePtr> lhs, pair <valFunc, MyDB_AttTypePtr> rhs);
+	pair <valFunc, MyDB_AttTypePtr> times (pair <valFunc, MyDB_AttTypePtr> lhs, pair <valFunc, MyDB_AttTypePtr> rhs);
+	pair <valFunc, MyDB_AttTypePtr> divide (pair <valFunc, MyDB_AttTypePtr> lhs, pair <valFunc, MyDB_AttTypePtr> rhs);
+	pair <valFunc, MyDB_AttTypePtr> gt (pair <valFunc, MyDB_AttTypePtr> lhs, pair <valFunc, MyDB_AttTypePtr> rhs);
+	pair <valFunc, MyDB_AttTypePtr> lt (pair <valFunc, MyDB_AttTypePtr> lhs, pair <valFunc, MyDB_AttTypePtr> rhs);
+	pair <valFunc, MyDB_AttTypePtr> eq (pair <valFunc, MyDB_AttTypePtr> lhs, pair <valFunc, MyDB_AttTypePtr> rhs);
+	pair <valFunc, MyDB_AttTypePtr> neq (pair <valFunc, MyDB_AttTypePtr> lhs, pair <valFunc, MyDB_AttTypePtr> rhs);
+	pair <valFunc, MyDB_AttTypePtr> andd (pair <valFunc, MyDB_AttTypePtr> lhs, pair <valFunc, MyDB_AttTypePtr> rhs);
+	pair <valFunc, MyDB_AttTypePtr> orr (pair <valFunc, MyDB_AttTypePtr> lhs, pair <valFunc, MyDB_AttTypePtr> rhs);
+	pair <valFunc, MyDB_AttTypePtr> unaryMinus (pair <valFunc, MyDB_AttTypePtr> lhs);
+	pair <valFunc, MyDB_AttTypePtr> nott (pair <valFunc, MyDB_AttTypePtr> lhs);
 
 	// write the current attribute values into the buffer
 	void writeAttsToBuffer ();
 
+	// points the attributes at their data in the serialized record at fromHere
+	void attsFromBinary (char *fromHere);
+
+	// where the attributes' data is in a serialized record; this comes from the schema, and
+	// it is null for a record with no schema of its own
+	MyDB_RecordLayoutPtr layout;
+
 	// true when the set of attributes don't match the attribute buffer
 	bool bufferOld;
 
@@ -160,8 +208,27 @@ private:
 	friend class MyDB_INRecord;
 
 	MyDB_SchemaPtr mySchema;
+
+	// the values of this record's attributes, one after another
+	vector <MyDB_Value> vals;
+
+	// the value of each attribute... usually these are in vals, but a record made with
+	// buildFrom looks at the values of the two records that it was made from, which are
+	// kept in parts
+	vector <MyDB_Value *> valPtrs;
+	vector <MyDB_RecordPtr> parts;
+
+	// each attribute as a MyDB_AttVal (see getAtt); these look at the values in valPtrs
 	vector <MyDB_AttValPtr> values;	
-	vector <MyDB_AttValPtr> scratch;
+
+	// the values computed by compiled computations, and the constants used by them
+	deque <MyDB_Value> scratch;
+
+	// gets a new value of the given type, that is kept in scratch
+	MyDB_Value *getScratchValue (MyDB_ValueType type);
+
+	// sets up valPtrs to match values
+	void refreshValuePointers ();
 
 };
 
@@ -0,0 +1,165 @@
+
+#ifndef VALUE_H
+#define VALUE_H
+
+#include <string>
+#include <string.h>
+
+using namespace std;
+
+// the types of value that an attribute can have
+enum MyDB_ValueType {MyDB_IntValue, MyDB_DoubleValue, MyDB_StringValue, MyDB_BoolValue};
+
+// strings this long or shorter (not counting the null at the end) are stored inside of the value
+#define SMALL_STRING_LEN 23
+
+// a single attribute value: a tag saying what type it is, plus the value.  Values are held by
+// value (records keep theirs in one array), so working with them does not mean a virtual call
+// or a trip to the heap.  A string value either points at a serialized string that lives
+// somewhere else (see setBuffered) or owns its characters, which are kept in the value itself
+// if they fit, and otherwise in memory that is reused as the value changes
+class MyDB_Value {
+
+public:
+
+	// an int value of zero
+	MyDB_Value ();
+
+	// a zero, empty or false value of the given type
+	MyDB_Value (MyDB_ValueType type);
+
+	// copies always own their characters, even if the original pointed at serialized data
+	MyDB_Value (const MyDB_Value &fromMe);
+	MyDB_Value &operator = (const MyDB_Value &fromMe);
+
+	~MyDB_Value ();
+
+	MyDB_ValueType getType () const {
+		return type;
+	}
+
+	// get the value, converted to the asked-for type... a conversion that does not make
+	// sense (such as a string to an int) is a fatal error
+	inline int toInt () const {
+		if (type == MyDB_IntValue)
+			return intVal;
+		if (type == MyDB_DoubleValue)
+			return (int) doubleVal;
+		badConversion ("int");
+		return 0;
+	}
+
+	inline double toDouble () const {
+		if (type == MyDB_DoubleValue)
+			return doubleVal;
+		if (type == MyDB_IntValue)
+			return (double) intVal;
+		badConversion ("double");
+		return 0;
+	}
+
+	inline bool toBool () const {
+		if (type == MyDB_BoolValue)
+			return boolVal;
+		badConversion ("bool");
+		return false;
+	}
+
+	string toString () const;
+
+	// the characters of a string value, with a null at the end... these are not copied, so
+	// they are only good until the value changes (or, if the value points at serialized
+	// data, until that data goes away)
+	inline const char *getChars () const {
+		return chars;
+	}
+
+	inline size_t getLength () const {
+		return len;
+	}
+
+	size_t hash () const;
+
+	// compares the two values as strings (returning a number < 0, 0, or > 0, as strcmp
+	// does); this does not build the strings if both of the values are already strings
+	int compareAsString (const MyDB_Value &withMe) const;
+
+	// these set the value, which must be of the matching type
+	inline void setInt (int val) {
+		intVal = val;
+	}
+
+	inline void setDouble (double val) {
+		doubleVal = val;
+	}
+
+	inline void setBool (bool val) {
+		boolVal = val;
+	}
+
+	void setString (const char *val, size_t length);
+	void setString (const string &val);
+
+	// sets this value to fromMe, converting it to the type of this value
+	void set (const MyDB_Value &fromMe);
+
+	// sets this value from an int or from text, converting to the type of this value
+	void fromInt (int fromMe);
+	void fromString (const string &fromMe);
+
+	// makes this value the one serialized at where, which is the spot just after the length
+	// (a short) that comes before every serialized value.  Strings are not copied
+	inline void setBuffered (char *where) {
+		switch (type) {
+		case MyDB_IntValue:
+			memcpy (&intVal, where, sizeof (int));
+			break;
+		case MyDB_DoubleValue:
+			memcpy (&doubleVal, where, sizeof (double));
+			break;
+		case MyDB_BoolValue:
+			boolVal = (*where == 1);
+			break;
+		case MyDB_StringValue:
+			chars = where;
+			len = *((short *) (where - sizeof (short))) - sizeof (short) - 1;
+			break;
+		}
+	}
+
+	// makes this value the one serialized at fromHere (a length, then the data), and
+	// returns a pointer to whatever comes after it
+	inline char *fromBinary (char *fromHere) {
+		setBuffered (fromHere + sizeof (short));
+		return fromHere + *((short *) fromHere);
+	}
+
+	// appends the serialized version of this value to the given buffer (which is made
+	// larger if need be), where totSize is how much of the buffer is used
+	void serialize (char *&buffer, size_t &allocatedSize, size_t &totSize) const;
+
+private:
+
+	// for conversions that cannot be done
+	void badConversion (const char *toWhat) const;
+
+	MyDB_ValueType type;
+
+	union {
+		int intVal;
+		double doubleVal;
+		bool boolVal;
+	};
+
+	// for a string: its characters, wherever they are, and how many there are
+	const char *chars;
+	size_t len;
+
+	// the characters of a string that this value owns go here if they fit, and in heap
+	// otherwise (whose size is heapSize)
+	char small[SMALL_STRING_LEN + 1];
+	char *heap;
+	size_t heapSize;
+};
+
+#endif
@@ -19,18 +19,34 @@ char *MyDB_Record ::findsymbol(char val, char *input)
 }
 
 func MyDB_Record ::compileComputation(string compileMe)
+{
+	valFunc f = compileValueComputation(compileMe);
+
+	// the result is handed back by an attribute value that looks at whatever the computation returns
+	MyDB_AttValPtr result = make_shared<MyDB_AttVal>((MyDB_Value *)nullptr);
+	return [f, result]
+	{ result->setValue(&f()); return result; };
+}
+
+valFunc MyDB_Record ::compileValueComputation(string compileMe)
 {
 	char *str = (char *)compileMe.c_str();
 	return compileHelper(str).first;
 }
 
+MyDB_Value *MyDB_Record ::getScratchValue(MyDB_ValueType type)
+{
+	scratch.emplace_back(type);
+	return &scratch.back();
+}
+
 MyDB_AttTypePtr MyDB_Record ::getType(string compileMe)
 {
 	char *str = (char *)compileMe.c_str();
 	return compileHelper(str).second;
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::compileHelper(char *&vals)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::compileHelper(char *&vals)
 {
 	// cout << "Compiling helper " << vals << "\n";
 
@@ -364,13 +380,12 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::compileHelper(char *&vals)
 			vals = findsymbol(']', vals);
 
 			// remember this value
-			MyDB_IntAttValPtr temp = make_shared<MyDB_IntAttVal>();
-			scratch.push_back(temp);
-			temp->set(val);
+			MyDB_Value *temp = getScratchValue(MyDB_IntValue);
+			temp->setInt(val);
 
 			// returns a lambda that computes the result
-			return make_pair([temp]
-											 { return temp; },
+			return make_pair([temp]() -> MyDB_Value &
+											 { return *temp; },
 											 make_shared<MyDB_IntAttType>());
 		}
 		else if (strncmp(vals, "double", 6) == 0)
@@ -381,13 +396,12 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::compileHelper(char *&vals)
 			vals = findsymbol(']', vals);
 
 			// remember this value
-			MyDB_DoubleAttValPtr temp = make_shared<MyDB_DoubleAttVal>();
-			scratch.push_back(temp);
-			temp->set(val);
+			MyDB_Value *temp = getScratchValue(MyDB_DoubleValue);
+			temp->setDouble(val);
 
 			// returns a lambda that computes the result
-			return make_pair([temp]
-											 { return temp; },
+			return make_pair([temp]() -> MyDB_Value &
+											 { return *temp; },
 											 make_shared<MyDB_DoubleAttType>());
 		}
 		else if (strncmp(vals, "bool", 4) == 0)
@@ -402,13 +416,12 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::compileHelper(char *&vals)
 			vals = findsymbol(']', vals);
 
 			// remember this value
-			MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-			scratch.push_back(temp);
-			temp->set(val);
+			MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
+			temp->setBool(val);
 
 			// returns a lambda that computes the result
-			return make_pair([temp]
-											 { return temp; },
+			return make_pair([temp]() -> MyDB_Value &
+											 { return *temp; },
 											 make_shared<MyDB_BoolAttType>());
 		}
 		else if (strncmp(vals, "string", 6) == 0)
@@ -433,13 +446,12 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::compileHelper(char *&vals)
 			vals = findsymbol(']', vals);
 
 			// remember this value
-			MyDB_StringAttValPtr temp = make_shared<MyDB_StringAttVal>();
-			scratch.push_back(temp);
-			temp->set(name);
+			MyDB_Value *temp = getScratchValue(MyDB_StringValue);
+			temp->setString(name);
 
 			// returns a lambda that computes the result
-			return make_pair([temp]
-											 { return temp; },
+			return make_pair([temp]() -> MyDB_Value &
+											 { return *temp; },
 											 make_shared<MyDB_StringAttType>());
 		}
 		else
@@ -449,52 +461,49 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::compileHelper(char *&vals)
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::fromData(string attName)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::fromData(string attName)
 {
 
 	// just return a particular attribute
 	auto whichAtt = mySchema->getAttByName(attName);
-	return make_pair([this, whichAtt]
-									 { return values[whichAtt.first]; },
+	return make_pair([this, whichAtt]() -> MyDB_Value &
+									 { return *valPtrs[whichAtt.first]; },
 									 whichAtt.second);
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::plus(pair<func, MyDB_AttTypePtr> lhs, pair<func, MyDB_AttTypePtr> rhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::plus(pair<valFunc, MyDB_AttTypePtr> lhs, pair<valFunc, MyDB_AttTypePtr> rhs)
 {
 
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->promotableToInt() && rhs.second->promotableToInt())
 	{
-		MyDB_IntAttValPtr temp = make_shared<MyDB_IntAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_IntValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toInt () + rhs.first ()->toInt ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setInt (lhs.first ().toInt () + rhs.first ().toInt ()); return *temp; },
 										 make_shared<MyDB_IntAttType>());
 
 		// otherwise, if both sides can be cast upwards to be doubles, then do so
 	}
 	else if (lhs.second->promotableToDouble() && rhs.second->promotableToDouble())
 	{
-		MyDB_DoubleAttValPtr temp = make_shared<MyDB_DoubleAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_DoubleValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toDouble () + rhs.first ()->toDouble ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setDouble (lhs.first ().toDouble () + rhs.first ().toDouble ()); return *temp; },
 										 make_shared<MyDB_DoubleAttType>());
 
 		// otherwise, if both sides can be cast upwards to be strings, then do so
 	}
 	else if (lhs.second->promotableToString() && rhs.second->promotableToString())
 	{
-		MyDB_StringAttValPtr temp = make_shared<MyDB_StringAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_StringValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toString () + rhs.first ()->toString ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setString (lhs.first ().toString () + rhs.first ().toString ()); return *temp; },
 										 make_shared<MyDB_StringAttType>());
 	}
 	else
@@ -504,30 +513,28 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::plus(pair<func, MyDB_AttTypePtr> lhs,
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::minus(pair<func, MyDB_AttTypePtr> lhs, pair<func, MyDB_AttTypePtr> rhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::minus(pair<valFunc, MyDB_AttTypePtr> lhs, pair<valFunc, MyDB_AttTypePtr> rhs)
 {
 
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->promotableToInt() && rhs.second->promotableToInt())
 	{
-		MyDB_IntAttValPtr temp = make_shared<MyDB_IntAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_IntValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toInt () - rhs.first ()->toInt ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setInt (lhs.first ().toInt () - rhs.first ().toInt ()); return *temp; },
 										 make_shared<MyDB_IntAttType>());
 
 		// otherwise, if both sides can be cast upwards to be doubles, then do so
 	}
 	else if (lhs.second->promotableToDouble() && rhs.second->promotableToDouble())
 	{
-		MyDB_DoubleAttValPtr temp = make_shared<MyDB_DoubleAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_DoubleValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toDouble () - rhs.first ()->toDouble ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setDouble (lhs.first ().toDouble () - rhs.first ().toDouble ()); return *temp; },
 										 make_shared<MyDB_DoubleAttType>());
 	}
 	else
@@ -537,30 +544,28 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::minus(pair<func, MyDB_AttTypePtr> lhs,
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::unaryMinus(pair<func, MyDB_AttTypePtr> lhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::unaryMinus(pair<valFunc, MyDB_AttTypePtr> lhs)
 {
 
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->promotableToInt())
 	{
-		MyDB_IntAttValPtr temp = make_shared<MyDB_IntAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_IntValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs]
-										 {temp->set (-lhs.first ()->toInt ()); return temp; },
+		return make_pair([temp, lhs]() -> MyDB_Value &
+										 {temp->setInt (-lhs.first ().toInt ()); return *temp; },
 										 make_shared<MyDB_IntAttType>());
 
 		// otherwise, if both sides can be cast upwards to be doubles, then do so
 	}
 	else if (lhs.second->promotableToDouble())
 	{
-		MyDB_DoubleAttValPtr temp = make_shared<MyDB_DoubleAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_DoubleValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs]
-										 {temp->set (-lhs.first ()->toDouble ()); return temp; },
+		return make_pair([temp, lhs]() -> MyDB_Value &
+										 {temp->setDouble (-lhs.first ().toDouble ()); return *temp; },
 										 make_shared<MyDB_DoubleAttType>());
 	}
 	else
@@ -570,30 +575,28 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::unaryMinus(pair<func, MyDB_AttTypePtr>
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::times(pair<func, MyDB_AttTypePtr> lhs, pair<func, MyDB_AttTypePtr> rhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::times(pair<valFunc, MyDB_AttTypePtr> lhs, pair<valFunc, MyDB_AttTypePtr> rhs)
 {
 
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->promotableToInt() && rhs.second->promotableToInt())
 	{
-		MyDB_IntAttValPtr temp = make_shared<MyDB_IntAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_IntValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toInt () * rhs.first ()->toInt ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setInt (lhs.first ().toInt () * rhs.first ().toInt ()); return *temp; },
 										 make_shared<MyDB_IntAttType>());
 
 		// otherwise, if both sides can be cast upwards to be doubles, then do so
 	}
 	else if (lhs.second->promotableToDouble() && rhs.second->promotableToDouble())
 	{
-		MyDB_DoubleAttValPtr temp = make_shared<MyDB_DoubleAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_DoubleValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toDouble () * rhs.first ()->toDouble ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setDouble (lhs.first ().toDouble () * rhs.first ().toDouble ()); return *temp; },
 										 make_shared<MyDB_DoubleAttType>());
 	}
 	else
@@ -603,30 +606,28 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::times(pair<func, MyDB_AttTypePtr> lhs,
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::divide(pair<func, MyDB_AttTypePtr> lhs, pair<func, MyDB_AttTypePtr> rhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::divide(pair<valFunc, MyDB_AttTypePtr> lhs, pair<valFunc, MyDB_AttTypePtr> rhs)
 {
 	// cout
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->promotableToInt() && rhs.second->promotableToInt())
 	{
-		MyDB_IntAttValPtr temp = make_shared<MyDB_IntAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_IntValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toInt () / rhs.first ()->toInt ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setInt (lhs.first ().toInt () / rhs.first ().toInt ()); return *temp; },
 										 make_shared<MyDB_IntAttType>());
 
 		// otherwise, if both sides can be cast upwards to be doubles, then do so
 	}
 	else if (lhs.second->promotableToDouble() && rhs.second->promotableToDouble())
 	{
-		MyDB_DoubleAttValPtr temp = make_shared<MyDB_DoubleAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_DoubleValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toDouble () / rhs.first ()->toDouble ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setDouble (lhs.first ().toDouble () / rhs.first ().toDouble ()); return *temp; },
 										 make_shared<MyDB_DoubleAttType>());
 	}
 	else
@@ -636,42 +637,39 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::divide(pair<func, MyDB_AttTypePtr> lhs
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::gt(pair<func, MyDB_AttTypePtr> lhs, pair<func, MyDB_AttTypePtr> rhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::gt(pair<valFunc, MyDB_AttTypePtr> lhs, pair<valFunc, MyDB_AttTypePtr> rhs)
 {
 
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->promotableToInt() && rhs.second->promotableToInt())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toInt () > rhs.first ()->toInt ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toInt () > rhs.first ().toInt ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 
 		// otherwise, if both sides can be cast upwards to be doubles, then do so
 	}
 	else if (lhs.second->promotableToDouble() && rhs.second->promotableToDouble())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toDouble () > rhs.first ()->toDouble ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toDouble () > rhs.first ().toDouble ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 
 		// otherwise, if both sides can be cast upwards to be strings, then do so
 	}
 	else if (lhs.second->promotableToString() && rhs.second->promotableToString())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toString () > rhs.first ()->toString ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().compareAsString (rhs.first ()) > 0); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 	}
 	else
@@ -681,42 +679,39 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::gt(pair<func, MyDB_AttTypePtr> lhs, pa
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::lt(pair<func, MyDB_AttTypePtr> lhs, pair<func, MyDB_AttTypePtr> rhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::lt(pair<valFunc, MyDB_AttTypePtr> lhs, pair<valFunc, MyDB_AttTypePtr> rhs)
 {
 
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->promotableToInt() && rhs.second->promotableToInt())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toInt () < rhs.first ()->toInt ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toInt () < rhs.first ().toInt ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 
 		// otherwise, if both sides can be cast upwards to be doubles, then do so
 	}
 	else if (lhs.second->promotableToDouble() && rhs.second->promotableToDouble())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toDouble () < rhs.first ()->toDouble ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toDouble () < rhs.first ().toDouble ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 
 		// otherwise, if both sides can be cast upwards to be strings, then do so
 	}
 	else if (lhs.second->promotableToString() && rhs.second->promotableToString())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toString () < rhs.first ()->toString ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().compareAsString (rhs.first ()) < 0); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 	}
 	else
@@ -726,52 +721,48 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::lt(pair<func, MyDB_AttTypePtr> lhs, pa
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::eq(pair<func, MyDB_AttTypePtr> lhs, pair<func, MyDB_AttTypePtr> rhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::eq(pair<valFunc, MyDB_AttTypePtr> lhs, pair<valFunc, MyDB_AttTypePtr> rhs)
 {
 
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->promotableToInt() && rhs.second->promotableToInt())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toInt () == rhs.first ()->toInt ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toInt () == rhs.first ().toInt ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 
 		// otherwise, if both sides can be cast upwards to be doubles, then do so
 	}
 	else if (lhs.second->promotableToDouble() && rhs.second->promotableToDouble())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toDouble () == rhs.first ()->toDouble ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toDouble () == rhs.first ().toDouble ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 	}
 	else if (lhs.second->isBool() && rhs.second->isBool())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toBool () == rhs.first ()->toBool ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toBool () == rhs.first ().toBool ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 
 		// otherwise, if both sides can be cast upwards to be strings, then do so
 	}
 	else if (lhs.second->promotableToString() && rhs.second->promotableToString())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toString () == rhs.first ()->toString ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().compareAsString (rhs.first ()) == 0); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 	}
 	else
@@ -781,52 +772,48 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::eq(pair<func, MyDB_AttTypePtr> lhs, pa
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::neq(pair<func, MyDB_AttTypePtr> lhs, pair<func, MyDB_AttTypePtr> rhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::neq(pair<valFunc, MyDB_AttTypePtr> lhs, pair<valFunc, MyDB_AttTypePtr> rhs)
 {
 
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->promotableToInt() && rhs.second->promotableToInt())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toInt () != rhs.first ()->toInt ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toInt () != rhs.first ().toInt ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 	}
 	else if (lhs.second->isBool() && rhs.second->isBool())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toBool () != rhs.first ()->toBool ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toBool () != rhs.first ().toBool ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 
 		// otherwise, if both sides can be cast upwards to be doubles, then do so
 	}
 	else if (lhs.second->promotableToDouble() && rhs.second->promotableToDouble())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toDouble () != rhs.first ()->toDouble ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toDouble () != rhs.first ().toDouble ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 
 		// otherwise, if both sides can be cast upwards to be strings, then do so
 	}
 	else if (lhs.second->promotableToString() && rhs.second->promotableToString())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toString () != rhs.first ()->toString ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().compareAsString (rhs.first ()) != 0); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 	}
 	else
@@ -836,18 +823,17 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::neq(pair<func, MyDB_AttTypePtr> lhs, p
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::orr(pair<func, MyDB_AttTypePtr> lhs, pair<func, MyDB_AttTypePtr> rhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::orr(pair<valFunc, MyDB_AttTypePtr> lhs, pair<valFunc, MyDB_AttTypePtr> rhs)
 {
 
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->isBool() && rhs.second->isBool())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toBool () || rhs.first ()->toBool ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toBool () || rhs.first ().toBool ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 	}
 	else
@@ -857,18 +843,17 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::orr(pair<func, MyDB_AttTypePtr> lhs, p
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::andd(pair<func, MyDB_AttTypePtr> lhs, pair<func, MyDB_AttTypePtr> rhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::andd(pair<valFunc, MyDB_AttTypePtr> lhs, pair<valFunc, MyDB_AttTypePtr> rhs)
 {
 
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->isBool() && rhs.second->isBool())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs, rhs]
-										 {temp->set (lhs.first ()->toBool () && rhs.first ()->toBool ()); return temp; },
+		return make_pair([temp, lhs, rhs]() -> MyDB_Value &
+										 {temp->setBool (lhs.first ().toBool () && rhs.first ().toBool ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 	}
 	else
@@ -878,18 +863,17 @@ pair<func, MyDB_AttTypePtr> MyDB_Record ::andd(pair<func, MyDB_AttTypePtr> lhs,
 	}
 }
 
-pair<func, MyDB_AttTypePtr> MyDB_Record ::nott(pair<func, MyDB_AttTypePtr> lhs)
+pair<valFunc, MyDB_AttTypePtr> MyDB_Record ::nott(pair<valFunc, MyDB_AttTypePtr> lhs)
 {
 
 	// if both sides can be cast upwards to be ints, then do so
 	if (lhs.second->isBool())
 	{
-		MyDB_BoolAttValPtr temp = make_shared<MyDB_BoolAttVal>();
-		scratch.push_back(temp);
+		MyDB_Value *temp = getScratchValue(MyDB_BoolValue);
 
 		// returns a lambda that computes the result
-		return make_pair([temp, lhs]
-										 {temp->set (!lhs.first ()->toBool ()); return temp; },
+		return make_pair([temp, lhs]() -> MyDB_Value &
+										 {temp->setBool (!lhs.first ().toBool ()); return *temp; },
 										 make_shared<MyDB_BoolAttType>());
 	}
 	else
@@ -917,12 +901,13 @@ void MyDB_Record ::recordContentHasChanged()
 void MyDB_Record ::writeAttsToBuffer()
 {
 	recSize = sizeof(short);
-	for (MyDB_AttValPtr temp : values)
+	for (MyDB_Value *temp : valPtrs)
 	{
 		temp->serialize(buffer, allocatedSize, recSize);
 	}
 	*((short *)buffer) = (short)recSize;
 	bufferOld = false;
+	view = nullptr;
 }
 
 void *MyDB_Record ::toBinary(void *toHere)
@@ -933,7 +918,7 @@ void *MyDB_Record ::toBinary(void *toHere)
 	{
 		writeAttsToBuffer();
 	}
-	memcpy(toHere, buffer, recSize);
+	memcpy(toHere, view != nullptr ? view : buffer, recSize);
 	return ((char *)toHere) + recSize;
 }
 
@@ -955,31 +940,145 @@ void *MyDB_Record ::fromBinary(void *fromHere)
 	memcpy(buffer, fromHere, recSize);
 
 	// and set up the attributes
-	char *recLoc = buffer + sizeof(short);
-	for (MyDB_AttValPtr temp : values)
+	attsFromBinary(buffer);
+
+	bufferOld = false;
+	view = nullptr;
+
+	return ((char *)fromHere) + recSize;
+}
+
+void MyDB_Record ::attsFromBinary(char *fromHere)
+{
+
+	// the attributes whose offsets are known are set up directly
+	size_t i = 0;
+	if (layout != nullptr)
+	{
+		vector<size_t> &fixedOffsets = layout->fixedOffsets;
+		for (; i < fixedOffsets.size(); i++)
+		{
+			valPtrs[i]->setBuffered(fromHere + fixedOffsets[i]);
+		}
+	}
+
+	// the rest have to be found by walking, starting after the last one that we know about
+	char *recLoc = fromHere + sizeof(short);
+	if (i > 0 && i < valPtrs.size())
+	{
+		recLoc = fromHere + layout->fixedOffsets[i - 1] - sizeof(short);
+		recLoc += *((short *)recLoc);
+	}
+	for (; i < valPtrs.size(); i++)
 	{
-		recLoc = temp->fromBinary(recLoc);
+		recLoc = valPtrs[i]->fromBinary(recLoc);
 	}
 
+	// every attribute has been loaded, so none are looking at old column values
+	freeOldColBuffers();
+}
+
+void *MyDB_Record ::viewBinary(void *fromHere)
+{
+
+	recSize = *((short *)fromHere);
+
+	// the attributes point right at the bytes that were given to us
+	attsFromBinary((char *)fromHere);
+
 	bufferOld = false;
+	view = (char *)fromHere;
 
 	return ((char *)fromHere) + recSize;
 }
 
+void MyDB_Record ::fromColumns(vector<int> &whichAtts, vector<char *> &locations, bool copy)
+{
+
+	if (copy)
+	{
+
+		// if our column buffer is not large enough, reallocate
+		size_t totSize = 0;
+		for (char *loc : locations)
+		{
+			totSize += *((short *)loc);
+		}
+		if (totSize > colAllocated)
+		{
+			// attributes loaded by an earlier call may still be looking at the old buffer, so it
+			// is kept until they have all been loaded again
+			if (colBuffer != nullptr)
+				oldColBuffers.push_back(colBuffer);
+			colBuffer = new char[totSize * 2];
+			colAllocated = totSize * 2;
+		}
+
+		// copy the values over, one after another
+		char *colLoc = colBuffer;
+		for (size_t i = 0; i < whichAtts.size(); i++)
+		{
+			short len = *((short *)locations[i]);
+			memcpy(colLoc, locations[i], len);
+			colLoc = valPtrs[whichAtts[i]]->fromBinary(colLoc);
+		}
+	}
+	else
+	{
+		for (size_t i = 0; i < whichAtts.size(); i++)
+		{
+			valPtrs[whichAtts[i]]->fromBinary(locations[i]);
+		}
+	}
+
+	if (whichAtts.size() == valPtrs.size())
+		freeOldColBuffers();
+
+	// the record is no longer stored in one piece anywhere, so it has to be serialized again
+	bufferOld = true;
+	view = nullptr;
+}
+
+void MyDB_Record ::freeOldColBuffers()
+{
+	for (char *old : oldColBuffers)
+		delete[] old;
+	oldColBuffers.clear();
+}
+
+vector<int> MyDB_Record ::getReferencedAtts(vector<string> &computations)
+{
+	vector<int> returnVal;
+	vector<pair<string, MyDB_AttTypePtr>> &atts = mySchema->getAtts();
+	for (int i = 0; i < (int)atts.size(); i++)
+	{
+		string name = "[" + atts[i].first + "]";
+		for (string &s : computations)
+		{
+			if (s.find(name) != string::npos)
+			{
+				returnVal.push_back(i);
+				break;
+			}
+		}
+	}
+	return returnVal;
+}
+
 void MyDB_Record ::fromString(string res)
 {
 	int i = 0;
 	for (int pos = 0; pos < (int)res.size(); pos = (int)res.find("|", pos + 1) + 1)
 	{
 		string temp = res.substr(pos, res.find("|", pos + 1) - pos);
-		values[i++]->fromString(temp);
+		valPtrs[i++]->fromString(temp);
 	}
 	bufferOld = true;
 }
 
 std::ostream &operator<<(std::ostream &os, const MyDB_Record printMe)
 {
-	for (MyDB_AttValPtr temp : printMe.values)
+	for (MyDB_Value *temp : printMe.valPtrs)
 	{
 		os << temp->toString() << "|";
 	}
@@ -990,7 +1089,7 @@ std::ostream &operator<<(std::ostream &os, const MyDB_RecordPtr printMe)
 {
 	if (printMe == nullptr)
 		return os;
-	for (MyDB_AttValPtr temp : printMe->values)
+	for (MyDB_Value *temp : printMe->valPtrs)
 	{
 		os << temp->toString() << "|";
 	}
@@ -1002,16 +1101,16 @@ function<bool()> buildRecordComparator(MyDB_RecordPtr lhs, MyDB_RecordPtr rhs, s
 
 	// compile a computation over the LHS and over the RHS
 	char *str = (char *)computation.c_str();
-	pair<func, MyDB_AttTypePtr> lhsFunc = lhs->compileHelper(str);
+	pair<valFunc, MyDB_AttTypePtr> lhsFunc = lhs->compileHelper(str);
 
 	str = (char *)computation.c_str();
-	pair<func, MyDB_AttTypePtr> rhsFunc = rhs->compileHelper(str);
+	pair<valFunc, MyDB_AttTypePtr> rhsFunc = rhs->compileHelper(str);
 
 	// and then build a lambda that performs the computatation
 	auto res = lhs->lt(lhsFunc, rhsFunc);
-	func temp = res.first;
+	valFunc temp = res.first;
 	return [=]
-	{ return temp()->toBool(); };
+	{ return temp().toBool(); };
 }
 
 MyDB_Record ::MyDB_Record(MyDB_SchemaPtr mySchemaIn)
@@ -1022,13 +1121,34 @@ MyDB_Record ::MyDB_Record(MyDB_SchemaPtr mySchemaIn)
 	allocatedSize = 256;
 	recSize = 0;
 	bufferOld = true;
+	view = nullptr;
+	colBuffer = nullptr;
+	colAllocated = 0;
 
 	if (mySchemaIn == nullptr)
 		return;
 
+	// where each attribute's data is in a serialized record is worked out once, by the schema
+	layout = mySchema->getLayout();
 	for (auto &val : mySchema->getAtts())
 	{
-		values.push_back(val.second->createAtt());
+		vals.push_back(val.second->createAtt()->getValue());
+	}
+
+	// vals is not changed from here on, so the attributes can look right at it
+	for (MyDB_Value &val : vals)
+	{
+		values.push_back(make_shared<MyDB_AttVal>(&val));
+	}
+	refreshValuePointers();
+}
+
+void MyDB_Record ::refreshValuePointers()
+{
+	valPtrs.clear();
+	for (MyDB_AttValPtr &val : values)
+	{
+		valPtrs.push_back(&val->getValue());
 	}
 }
 
@@ -1042,6 +1162,11 @@ MyDB_AttValPtr &MyDB_Record ::getAtt(int whichAtt)
 	return values[whichAtt];
 }
 
+MyDB_Value &MyDB_Record ::getValue(int whichAtt)
+{
+	return *valPtrs[whichAtt];
+}
+
 void MyDB_Record ::buildFrom(MyDB_RecordPtr left, MyDB_RecordPtr right)
 {
 	vector<MyDB_AttValPtr> newValues;
@@ -1054,11 +1179,21 @@ void MyDB_Record ::buildFrom(MyDB_RecordPtr left, MyDB_RecordPtr right)
 		newValues.push_back(v);
 	}
 	values = newValues;
+	refreshValuePointers();
+	layout = nullptr;
+
+	// the attributes now look at the values of the two records, so they have to be kept around
+	parts.clear();
+	parts.push_back(left);
+	parts.push_back(right);
 }
 
 MyDB_Record ::~MyDB_Record()
 {
 	delete[] buffer;
+	if (colBuffer != nullptr)
+		delete[] colBuffer;
+	freeOldColBuffers();
 }
 
 #endif
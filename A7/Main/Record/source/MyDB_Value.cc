@@ -0,0 +1,221 @@
+
+#ifndef VALUE_C
+#define VALUE_C
+
+#include <iostream>
+#include <stdlib.h>
+#include "MyDB_Value.h"
+
+using namespace std;
+
+MyDB_Value :: MyDB_Value () : MyDB_Value (MyDB_IntValue) {}
+
+MyDB_Value :: MyDB_Value (MyDB_ValueType typeIn) {
+	type = typeIn;
+	doubleVal = 0;
+	if (type == MyDB_IntValue)
+		intVal = 0;
+	else if (type == MyDB_BoolValue)
+		boolVal = false;
+	small[0] = 0;
+	chars = small;
+	len = 0;
+	heap = nullptr;
+	heapSize = 0;
+}
+
+MyDB_Value :: MyDB_Value (const MyDB_Value &fromMe) : MyDB_Value (fromMe.type) {
+	*this = fromMe;
+}
+
+MyDB_Value &MyDB_Value :: operator = (const MyDB_Value &fromMe) {
+	if (this == &fromMe)
+		return *this;
+	type = fromMe.type;
+	switch (type) {
+	case MyDB_IntValue:
+		intVal = fromMe.intVal;
+		break;
+	case MyDB_DoubleValue:
+		doubleVal = fromMe.doubleVal;
+		break;
+	case MyDB_BoolValue:
+		boolVal = fromMe.boolVal;
+		break;
+	case MyDB_StringValue:
+		setString (fromMe.chars, fromMe.len);
+		break;
+	}
+	return *this;
+}
+
+MyDB_Value :: ~MyDB_Value () {
+	if (heap != nullptr)
+		delete [] heap;
+}
+
+void MyDB_Value :: badConversion (const char *toWhat) const {
+	static const char *names[] = {"int", "double", "string", "bool"};
+	cout << "Oops!  Can't convert " << names[type] << " to " << toWhat;
+	exit (1);
+}
+
+string MyDB_Value :: toString () const {
+	switch (type) {
+	case MyDB_IntValue:
+		return to_string (intVal);
+	case MyDB_DoubleValue:
+		return to_string (doubleVal);
+	case MyDB_BoolValue:
+		return boolVal ? "true" : "false";
+	default:
+		return string (chars, len);
+	}
+}
+
+size_t MyDB_Value :: hash () const {
+	switch (type) {
+	case MyDB_IntValue:
+		return std :: hash <int> () (intVal);
+	case MyDB_DoubleValue:
+		return std :: hash <int> () (doubleVal);
+	case MyDB_BoolValue:
+		return std :: hash <int> () (boolVal);
+	default:
+		return std :: hash <string> () (string (chars, len));
+	}
+}
+
+int MyDB_Value :: compareAsString (const MyDB_Value &withMe) const {
+	if (type == MyDB_StringValue && withMe.type == MyDB_StringValue)
+		return strcmp (chars, withMe.chars);
+	return toString ().compare (withMe.toString ());
+}
+
+void MyDB_Value :: setString (const char *val, size_t length) {
+
+	// find a spot for the characters
+	char *where = small;
+	if (length > SMALL_STRING_LEN) {
+		if (length + 1 > heapSize) {
+			if (heap != nullptr)
+				delete [] heap;
+			heapSize = (length + 1) * 2;
+			heap = new char[heapSize];
+		}
+		where = heap;
+	}
+
+	// memmove, because val might be our own characters
+	memmove (where, val, length);
+	where[length] = 0;
+	chars = where;
+	len = length;
+}
+
+void MyDB_Value :: setString (const string &val) {
+	setString (val.c_str (), val.size ());
+}
+
+void MyDB_Value :: set (const MyDB_Value &fromMe) {
+	switch (type) {
+	case MyDB_IntValue:
+		intVal = fromMe.toInt ();
+		break;
+	case MyDB_DoubleValue:
+		doubleVal = fromMe.toDouble ();
+		break;
+	case MyDB_BoolValue:
+		boolVal = fromMe.toBool ();
+		break;
+	case MyDB_StringValue:
+		if (fromMe.type == MyDB_StringValue)
+			setString (fromMe.chars, fromMe.len);
+		else
+			setString (fromMe.toString ());
+		break;
+	}
+}
+
+void MyDB_Value :: fromInt (int fromMe) {
+	switch (type) {
+	case MyDB_IntValue:
+		intVal = fromMe;
+		break;
+	case MyDB_DoubleValue:
+		doubleVal = (double) fromMe;
+		break;
+	case MyDB_BoolValue:
+		boolVal = (fromMe == 1);
+		break;
+	case MyDB_StringValue:
+		setString (to_string (fromMe));
+		break;
+	}
+}
+
+void MyDB_Value :: fromString (const string &fromMe) {
+	switch (type) {
+	case MyDB_IntValue:
+		intVal = stoi (fromMe);
+		break;
+	case MyDB_DoubleValue:
+		doubleVal = stod (fromMe);
+		break;
+	case MyDB_BoolValue:
+		if (fromMe == "false") {
+			boolVal = false;
+		} else if (fromMe == "true") {
+			boolVal = true;
+		} else {
+			cout << "Oops!  Bad string for boolean\n";
+			exit (1);
+		}
+		break;
+	case MyDB_StringValue:
+		setString (fromMe);
+		break;
+	}
+}
+
+void MyDB_Value :: serialize (char *&buffer, size_t &allocatedSize, size_t &totSize) const {
+
+	size_t dataSize;
+	if (type == MyDB_IntValue)
+		dataSize = sizeof (int);
+	else if (type == MyDB_DoubleValue)
+		dataSize = sizeof (double);
+	else if (type == MyDB_BoolValue)
+		dataSize = sizeof (char);
+	else
+		dataSize = len + 1;
+
+	// make room... the old buffer is let go of only after everything is written, since a
+	// string value might be pointing into it
+	char *oldBuffer = nullptr;
+	if (totSize + sizeof (short) + dataSize > allocatedSize) {
+		size_t newSize = (totSize + sizeof (short) + dataSize) * 2;
+		char *newBuff = new char[newSize];
+		memcpy (newBuff, buffer, totSize);
+		oldBuffer = buffer;
+		buffer = newBuff;
+		allocatedSize = newSize;
+	}
+
+	*((short *) (buffer + totSize)) = (short) (sizeof (short) + dataSize);
+	totSize += sizeof (short);
+	if (type == MyDB_IntValue)
+		memcpy (buffer + totSize, &intVal, sizeof (int));
+	else if (type == MyDB_DoubleValue)
+		memcpy (buffer + totSize, &doubleVal, sizeof (double));
+	else if (type == MyDB_BoolValue)
+		buffer[totSize] = boolVal ? 1 : 0;
+	else
+		memcpy (buffer + totSize, chars, dataSize);
+	totSize += dataSize;
+
+	if (oldBuffer != nullptr)
+		delete [] oldBuffer;
+}
+
+#endif
@@ -417,6 +417,272 @@ int main(int argc, char *argv[]) {
 		QUNIT_IS_EQUAL(counter, 10000);
 	}
 	FALLTHROUGH_INTENDED;
+	case 10:
+	{
+		// sort a slotted page and a page without slots in place, and look records up by position
+		cout << "TEST 10..." << flush;
+		initialize();
+		bool result = true;
+		{
+			cout << "create manager..." << flush;
+			MyDB_CatalogPtr myCatalog = make_shared <MyDB_Catalog>("catFile");
+			map <string, MyDB_TablePtr> allTables = MyDB_Table::getAllTables(myCatalog);
+			MyDB_BufferManagerPtr myMgr = make_shared <MyDB_BufferManager>(1024, 16, "tempFile");
+
+			cout << "create TableReaderWriter..." << flush;
+			MyDB_TableReaderWriter supplierTable(allTables["supplier"], myMgr);
+			MyDB_RecordPtr temp = supplierTable.getEmptyRecord();
+			MyDB_RecordPtr other = supplierTable.getEmptyRecord();
+			function <bool ()> myComp = buildRecordComparator (temp, other, "[acctbal]");
+
+			cout << "copy page 55 to a page without slots..." << flush;
+			result = result && supplierTable[55].getFormat() == SlottedFormat;
+			supplierTable[56].clear(StreamFormat);
+			MyDB_RecordIteratorPtr myIter = supplierTable[55].getIterator(temp);
+			while (myIter->hasNext()) {
+				myIter->getNext();
+				supplierTable[56].append(temp);
+			}
+
+			for (int page = 55; page <= 56; page++) {
+				cout << "sort page " << page << "..." << flush;
+				supplierTable[page].sortInPlace(myComp, temp, other);
+
+				// the iterator and the random lookups should both see the records in order
+				size_t numRecs = supplierTable[page].getNumRecords(temp);
+				myIter = supplierTable[page].getIterator(temp);
+				for (size_t i = 0; i < numRecs; i++) {
+					result = result && myIter->hasNext();
+					myIter->getNext();
+					supplierTable[page].getRecord(i, other);
+					result = result && temp->getAtt(0)->toInt() == other->getAtt(0)->toInt();
+					if (i > 0) {
+						supplierTable[page].getRecord(i - 1, other);
+						result = result && !myComp();
+					}
+				}
+				result = result && !myIter->hasNext() && numRecs > 1;
+
+				// and the first record with at least the median balance should be the median
+				supplierTable[page].getRecord(numRecs / 2, other);
+				size_t which = supplierTable[page].findFirst([&] () {return !myComp();}, temp);
+				supplierTable[page].getRecord(which, temp);
+				result = result && which <= numRecs / 2 && !myComp() && !buildRecordComparator (other, temp, "[acctbal]")();
+			}
+
+			cout << "shutdown manager..." << flush;
+		}
+		if (result) cout << "CORRECT" << endl << flush;
+		else cout << "***FAIL***" << endl << flush;
+		QUNIT_IS_TRUE(result);
+	}
+	FALLTHROUGH_INTENDED;
+	case 11:
+	{
+		// records viewed in place on a page should match copied ones, and copy out correctly
+		cout << "TEST 11..." << flush;
+		initialize();
+		int counter = 0;
+		{
+			cout << "create manager..." << flush;
+			MyDB_CatalogPtr myCatalog = make_shared <MyDB_Catalog>("catFile");
+			map <string, MyDB_TablePtr> allTables = MyDB_Table::getAllTables(myCatalog);
+			MyDB_BufferManagerPtr myMgr = make_shared <MyDB_BufferManager>(1024, 16, "tempFile");
+
+			cout << "create TableReaderWriter..." << flush;
+			MyDB_TableReaderWriter supplierTable(allTables["supplier"], myMgr);
+			MyDB_RecordPtr viewed = supplierTable.getEmptyRecord();
+			MyDB_RecordPtr copied = supplierTable.getEmptyRecord();
+			MyDB_RecordIteratorAltPtr viewIter = supplierTable.getIteratorAlt();
+			MyDB_RecordIteratorAltPtr copyIter = supplierTable.getIteratorAlt();
+
+			cout << "compare records..." << flush;
+			char space[1024];
+			while (viewIter->advance() && copyIter->advance()) {
+				viewIter->getCurrentView(viewed);
+				copyIter->getCurrent(copied);
+				stringstream ss1, ss2;
+				ss1 << viewed;
+				viewed->toBinary(space);
+				copied->fromBinary(space);
+				ss2 << copied;
+				if (ss1.str() == ss2.str() && viewed->getAtt(0)->toInt() == counter + 1)
+					counter++;
+			}
+
+			cout << "shutdown manager..." << flush;
+		}
+		if (counter == 10000) cout << "CORRECT" << endl << flush;
+		else cout << "***FAIL***" << endl << flush;
+		QUNIT_IS_EQUAL(counter, 10000);
+	}
+	FALLTHROUGH_INTENDED;
+	case 12:
+	{
+		// a schema that mixes fixed-size attributes with a string should be read back right, copied
+		// or viewed... the attribute after the string is found by walking on from the end of it
+		cout << "TEST 12..." << flush;
+		int counter = 0;
+		{
+			cout << "make schema..." << flush;
+			MyDB_SchemaPtr mixedSchema = make_shared <MyDB_Schema>();
+			mixedSchema->appendAtt(make_pair("first", make_shared <MyDB_IntAttType>()));
+			mixedSchema->appendAtt(make_pair("flag", make_shared <MyDB_BoolAttType>()));
+			mixedSchema->appendAtt(make_pair("amount", make_shared <MyDB_DoubleAttType>()));
+			mixedSchema->appendAtt(make_pair("name", make_shared <MyDB_StringAttType>()));
+			mixedSchema->appendAtt(make_pair("last", make_shared <MyDB_IntAttType>()));
+			MyDB_RecordPtr writeMe = make_shared <MyDB_Record>(mixedSchema);
+			MyDB_RecordPtr copied = make_shared <MyDB_Record>(mixedSchema);
+			MyDB_RecordPtr viewed = make_shared <MyDB_Record>(mixedSchema);
+
+			cout << "write records..." << flush;
+			vector <char> space (1 << 15);
+			char *loc = space.data();
+			for (int i = 0; i < 200; i++) {
+				string name (1 + i % 50, 'a' + i % 26);
+				writeMe->fromString(to_string(i) + "|" + (i % 2 == 1 ? "true" : "false") + "|" +
+					to_string(i * 0.5) + "|" + name + "|" + to_string(i * 3) + "|");
+				loc = (char *) writeMe->toBinary(loc);
+			}
+
+			cout << "read them back..." << flush;
+			char *copyLoc = space.data();
+			char *viewLoc = space.data();
+			for (int i = 0; i < 200; i++) {
+				copyLoc = (char *) copied->fromBinary(copyLoc);
+				viewLoc = (char *) viewed->viewBinary(viewLoc);
+				string name (1 + i % 50, 'a' + i % 26);
+				for (MyDB_RecordPtr rec : {copied, viewed}) {
+					if (rec->getAtt(0)->toInt() == i && rec->getAtt(1)->toBool() == (i % 2 == 1) &&
+						rec->getAtt(2)->toDouble() == i * 0.5 && rec->getAtt(3)->toString() == name &&
+						rec->getAtt(4)->toInt() == i * 3)
+						counter++;
+				}
+			}
+			if (copyLoc != loc || viewLoc != loc)
+				counter = 0;
+		}
+		if (counter == 400) cout << "CORRECT" << endl << flush;
+		else cout << "***FAIL***" << endl << flush;
+		QUNIT_IS_EQUAL(counter, 400);
+	}
+	FALLTHROUGH_INTENDED;
+	case 13:
+	{
+		// a table stored as PAX should give back the same records, all of them or just some columns
+		cout << "TEST 13..." << flush;
+		initialize();
+		int counter = 0;
+		{
+			cout << "create manager..." << flush;
+			MyDB_CatalogPtr myCatalog = make_shared <MyDB_Catalog>("catFile");
+			map <string, MyDB_TablePtr> allTables = MyDB_Table::getAllTables(myCatalog);
+			MyDB_BufferManagerPtr myMgr = make_shared <MyDB_BufferManager>(1024, 16, "tempFile");
+
+			cout << "load PAX table..." << flush;
+			MyDB_TableReaderWriter supplierTable(allTables["supplier"], myMgr);
+			MyDB_TablePtr paxTable = make_shared <MyDB_Table>("supplierPax", "supplierPax.bin",
+				allTables["supplier"]->getSchema(), "heap-pax", "none");
+			MyDB_TableReaderWriter paxTableRW(paxTable, myMgr);
+			paxTableRW.loadFromTextFile("supplier.tbl");
+
+			cout << "compare records..." << flush;
+			MyDB_RecordPtr rowRec = supplierTable.getEmptyRecord();
+			MyDB_RecordPtr paxRec = paxTableRW.getEmptyRecord();
+			MyDB_RecordIteratorPtr rowIter = supplierTable.getIterator(rowRec);
+			MyDB_RecordIteratorPtr paxIter = paxTableRW.getIterator(paxRec);
+			while (rowIter->hasNext() && paxIter->hasNext()) {
+				rowIter->getNext();
+				paxIter->getNext();
+				stringstream ss1, ss2;
+				ss1 << rowRec;
+				ss2 << paxRec;
+				if (ss1.str() == ss2.str())
+					counter++;
+			}
+
+			cout << "read two columns..." << flush;
+			vector <int> whichAtts {0, 5};
+			MyDB_RecordIteratorAltPtr colIter = paxTableRW.getIteratorAlt(whichAtts);
+			rowIter = supplierTable.getIterator(rowRec);
+			while (colIter->advance() && rowIter->hasNext()) {
+				colIter->getCurrent(paxRec);
+				rowIter->getNext();
+				if (paxRec->getAtt(0)->toInt() != rowRec->getAtt(0)->toInt() ||
+					paxRec->getAtt(5)->toDouble() != rowRec->getAtt(5)->toDouble())
+					counter--;
+			}
+
+			cout << "sort a PAX page..." << flush;
+			MyDB_RecordPtr other = paxTableRW.getEmptyRecord();
+			function <bool ()> myComp = buildRecordComparator (rowRec, other, "[acctbal]");
+			if (paxTableRW[0].getType() != MyDB_PageType::PaxPage)
+				counter--;
+			MyDB_PageReaderWriterPtr sorted = paxTableRW[0].sort(myComp, rowRec, other);
+			size_t numRecs = sorted->getNumRecords(rowRec);
+			if (numRecs != paxTableRW[0].getNumRecords(rowRec) || numRecs < 2)
+				counter--;
+			for (size_t i = 1; i < numRecs; i++) {
+				sorted->getRecord(i - 1, other);
+				sorted->getRecord(i, rowRec);
+				if (myComp())
+					counter--;
+			}
+
+			cout << "shutdown manager..." << flush;
+		}
+		if (counter == 10000) cout << "CORRECT" << endl << flush;
+		else cout << "***FAIL***" << endl << flush;
+		QUNIT_IS_EQUAL(counter, 10000);
+	}
+	FALLTHROUGH_INTENDED;
+	case 14:
+	{
+		// computations over values should match the attribute values, and copies of values should
+		// keep their strings after the record moves on
+		cout << "TEST 14..." << flush;
+		initialize();
+		int counter = 0;
+		{
+			cout << "create manager..." << flush;
+			MyDB_CatalogPtr myCatalog = make_shared <MyDB_Catalog>("catFile");
+			map <string, MyDB_TablePtr> allTables = MyDB_Table::getAllTables(myCatalog);
+			MyDB_BufferManagerPtr myMgr = make_shared <MyDB_BufferManager>(1024, 16, "tempFile");
+
+			cout << "compile computations..." << flush;
+			MyDB_TableReaderWriter supplierTable(allTables["supplier"], myMgr);
+			MyDB_RecordPtr temp = supplierTable.getEmptyRecord();
+			valFunc concat = temp->compileValueComputation("+ ([name], [address])");
+			valFunc twice = temp->compileValueComputation("* ([acctbal], int[2])");
+			valFunc pred = temp->compileValueComputation("&& (> ([acctbal], double[0.0]), == ([nationkey], [nationkey]))");
+			func concatAtt = temp->compileComputation("+ ([name], [address])");
+
+			cout << "run them..." << flush;
+			MyDB_Value lastConcat (MyDB_StringValue);
+			string lastExpected;
+			MyDB_RecordIteratorAltPtr myIter = supplierTable.getIteratorAlt();
+			while (myIter->advance()) {
+				myIter->getCurrentView(temp);
+				string expected = temp->getAtt(1)->toString() + temp->getAtt(2)->toString();
+				bool ok = concat().toString() == expected && concatAtt()->toString() == expected &&
+					concat().getLength() == expected.size() &&
+					twice().toDouble() == temp->getAtt(5)->toDouble() * 2 &&
+					pred().toBool() == (temp->getAtt(5)->toDouble() > 0) &&
+					temp->getValue(0).toInt() == counter + 1 &&
+					lastConcat.toString() == lastExpected;
+				if (ok)
+					counter++;
+				lastConcat = concat();
+				lastExpected = expected;
+			}
+
+			cout << "shutdown manager..." << flush;
+		}
+		if (counter == 10000) cout << "CORRECT" << endl << flush;
+		else cout << "***FAIL***" << endl << flush;
+		QUNIT_IS_EQUAL(counter, 10000);
+	}
+	FALLTHROUGH_INTENDED;
 	case 0:
 	{
 		// table hasNext with all pages cleared
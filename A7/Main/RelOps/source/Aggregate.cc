@@ -59,8 +59,20 @@ void Aggregate ::run()
 	MyDB_RecordPtr combinedRec = make_shared<MyDB_Record>(combinedSchema);
 	combinedRec->buildFrom(inputRec, aggRec);
 
-	// this is the current page where we are writing aggregate records
-	MyDB_PageReaderWriter lastPage(true, *(input->getBufferMgr()));
+	// every page of aggregates stays pinned until the end, so each one should be covered by a
+	// frame that has been set aside for us
+	MyDB_MemoryGrantPtr grant = input->getBufferMgr()->reserveFrames(1);
+	bool overBudget = false;
+
+	// this is the current page where we are writing aggregate records... the hash index points
+	// right at the records, so a page of aggregates can never be written out, and if there is no
+	// RAM for one, we have to give up
+	MyDB_PageReaderWriter lastPage(*(input->getBufferMgr()), grant);
+	if (!lastPage.hasRAM())
+	{
+		cout << "The aggregate can't get any RAM for its groups, so it was stopped.\n";
+		return;
+	}
 
 	// this is the list all of the pages used to store aggregate records
 	vector<MyDB_PageReaderWriter> allPages;
@@ -70,14 +82,14 @@ void Aggregate ::run()
 	unordered_map<size_t, vector<void *>> myHash;
 
 	// this will compute each of the groupings
-	vector<func> groupingComps;
+	vector<valFunc> groupingComps;
 	for (auto &s : groupings)
 	{
-		groupingComps.push_back(inputRec->compileComputation(s));
+		groupingComps.push_back(inputRec->compileValueComputation(s));
 	}
 
 	// and this will verify that each of the groupings match up
-	func checkGroups;
+	valFunc checkGroups;
 	string groupCheck;
 	i = 0;
 
@@ -97,51 +109,51 @@ void Aggregate ::run()
 		}
 		i++;
 	}
-	checkGroups = combinedRec->compileComputation(groupCheck);
+	checkGroups = combinedRec->compileValueComputation(groupCheck);
 
 	// this will compute each of the aggregates for updating the aggregate record
-	vector<func> aggComps;
+	vector<valFunc> aggComps;
 
 	// this will compute the final aggregate value for each output record
-	vector<func> finalAggComps;
+	vector<valFunc> finalAggComps;
 
 	i = 0;
 	for (auto &s : aggsToCompute)
 	{
 		if (s.first == MyDB_AggType ::sum || s.first == MyDB_AggType ::avg)
 		{
-			aggComps.push_back(combinedRec->compileComputation("+ (" + s.second +
+			aggComps.push_back(combinedRec->compileValueComputation("+ (" + s.second +
 																												 ", [MyDB_AggAtt" + to_string(i) + "])"));
 		}
 		else if (s.first == MyDB_AggType ::cnt)
 		{
-			aggComps.push_back(combinedRec->compileComputation("+ ( int[1], [MyDB_AggAtt" + to_string(i) + "])"));
+			aggComps.push_back(combinedRec->compileValueComputation("+ ( int[1], [MyDB_AggAtt" + to_string(i) + "])"));
 		}
 
 		if (s.first == MyDB_AggType ::avg)
 		{
-			finalAggComps.push_back(combinedRec->compileComputation("/ ([MyDB_AggAtt" + to_string(i++) + "], [MyDB_CntAtt])"));
+			finalAggComps.push_back(combinedRec->compileValueComputation("/ ([MyDB_AggAtt" + to_string(i++) + "], [MyDB_CntAtt])"));
 		}
 		else
 		{
-			finalAggComps.push_back(combinedRec->compileComputation("[MyDB_AggAtt" + to_string(i++) + "]"));
+			finalAggComps.push_back(combinedRec->compileValueComputation("[MyDB_AggAtt" + to_string(i++) + "]"));
 		}
 	}
-	aggComps.push_back(combinedRec->compileComputation("+ ( int[1], [MyDB_CntAtt])"));
+	aggComps.push_back(combinedRec->compileValueComputation("+ ( int[1], [MyDB_CntAtt])"));
 
 	// and this runs the selection on the input records
-	func inputPred = inputRec->compileComputation(selectionPredicate);
+	valFunc inputPred = inputRec->compileValueComputation(selectionPredicate);
 
 	// at this point, we are ready to go!!
 	MyDB_RecordIteratorPtr myIter = input->getIterator(inputRec);
-	MyDB_AttValPtr zero = make_shared<MyDB_IntAttVal>();
+	MyDB_Value zero(MyDB_IntValue);
 	while (myIter->hasNext())
 	{
 
 		myIter->getNext();
 
 		// see if it is accepted by the preicate
-		if (!inputPred()->toBool())
+		if (!inputPred().toBool())
 		{
 			continue;
 		}
@@ -150,7 +162,7 @@ void Aggregate ::run()
 		size_t hashVal = 0;
 		for (auto &f : groupingComps)
 		{
-			hashVal ^= f()->hash();
+			hashVal ^= f().hash();
 		}
 
 		// if there is a match, then get the list of matches
@@ -161,10 +173,10 @@ void Aggregate ::run()
 		for (auto &v : potentialMatches)
 		{
 
-			aggRec->fromBinary(v);
+			aggRec->viewBinary(v);
 
 			// check to see if it matches
-			if (!checkGroups()->toBool())
+			if (!checkGroups().toBool())
 			{
 				continue;
 			}
@@ -181,11 +193,11 @@ void Aggregate ::run()
 			i = 0;
 			for (auto &f : groupingComps)
 			{
-				aggRec->getAtt(i++)->set(f());
+				aggRec->getValue(i++).set(f());
 			}
 			for (int j = 0; j < aggComps.size(); j++)
 			{
-				aggRec->getAtt(i++)->set(zero);
+				aggRec->getValue(i++).set(zero);
 			}
 		}
 
@@ -195,7 +207,7 @@ void Aggregate ::run()
 		i = 0;
 		for (auto &f : aggComps)
 		{
-			aggRec->getAtt(numGroups + i++)->set(f());
+			aggRec->getValue(numGroups + i++).set(f());
 
 			// cout << "agg value" << f()->toString() << endl;
 		}
@@ -209,13 +221,25 @@ void Aggregate ::run()
 			// if we could not write, then the page was full
 			if (loc == nullptr)
 			{
-				MyDB_PageReaderWriter nextPage(true, *(input->getBufferMgr()));
+				// if no more frames can be reserved, the page has to come from the ones that nobody
+				// has reserved, if there are any
+				if (grant->grow(1) == 0 && !overBudget)
+				{
+					cout << "Warning: the aggregate is using more RAM than could be reserved for it.\n";
+					overBudget = true;
+				}
+				MyDB_PageReaderWriter nextPage(*(input->getBufferMgr()), grant);
+				if (!nextPage.hasRAM())
+				{
+					cout << "The aggregate ran out of RAM for its groups, so it was stopped.\n";
+					return;
+				}
 				lastPage = nextPage;
 				allPages.push_back(lastPage);
 				loc = lastPage.appendAndReturnLocation(aggRec);
 			}
 
-			aggRec->fromBinary(loc);
+			aggRec->viewBinary(loc);
 			myHash[hashVal].push_back(loc);
 
 			// otherwise, re-write to the old location
@@ -234,18 +258,18 @@ void Aggregate ::run()
 	while (myIterAgain->advance())
 	{
 
-		myIterAgain->getCurrent(aggRec);
+		myIterAgain->getCurrentView(aggRec);
 
 		// set the grouping atts
 		for (i = 0; i < numGroups; i++)
 		{
-			outRec->getAtt(i)->set(aggRec->getAtt(i));
+			outRec->getValue(i).set(aggRec->getValue(i));
 		}
 
 		// set the aggregate atts
 		for (auto &a : finalAggComps)
 		{
-			outRec->getAtt(i++)->set(a());
+			outRec->getValue(i++).set(a());
 		}
 		outRec->recordContentHasChanged();
 		output->append(outRec);
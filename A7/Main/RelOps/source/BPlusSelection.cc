@@ -22,27 +22,28 @@ void BPlusSelection :: run () {
 	MyDB_RecordPtr outputRec = output->getEmptyRecord ();
 	
 	// compile all of the coputations that we need here
-	vector <func> finalComputations;
+	vector <valFunc> finalComputations;
 	for (string s : projections) {
-		finalComputations.push_back (inputRec->compileComputation (s));
+		finalComputations.push_back (inputRec->compileValueComputation (s));
 	}
-	func pred = inputRec->compileComputation (selectionPredicate);
+	valFunc pred = inputRec->compileValueComputation (selectionPredicate);
 
 	// now, iterate through the B+-tree query results
 	MyDB_RecordIteratorAltPtr myIter = input->getRangeIteratorAlt (low, high);
 	while (myIter->advance ()) {
 
-		myIter->getCurrent (inputRec);
+		// the record is only looked at until the output is written, so it can stay on its page
+		myIter->getCurrentView (inputRec);
 
 		// see if it is accepted by the predicate
-		if (!pred()->toBool ()) {
+		if (!pred().toBool ()) {
 			continue;
 		}
 
 		// run all of the computations
 		int i = 0;
 		for (auto &f : finalComputations) {
-			outputRec->getAtt (i++)->set (f());
+			outputRec->getValue (i++).set (f());
 		}
 
 		outputRec->recordContentHasChanged ();
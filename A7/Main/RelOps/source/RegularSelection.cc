@@ -21,22 +21,28 @@ void RegularSelection ::run()
 	MyDB_RecordPtr outputRec = output->getEmptyRecord();
 
 	// compile all of the coputations that we need here
-	vector<func> finalComputations;
+	vector<valFunc> finalComputations;
 	for (string s : projections)
 	{
-		finalComputations.push_back(inputRec->compileComputation(s));
+		finalComputations.push_back(inputRec->compileValueComputation(s));
 	}
-	func pred = inputRec->compileComputation(selectionPredicate);
+	valFunc pred = inputRec->compileValueComputation(selectionPredicate);
+
+	// only the attributes that are used need to be read in (this matters if the table is stored as PAX)
+	vector<string> allComputations = projections;
+	allComputations.push_back(selectionPredicate);
+	vector<int> whichAtts = inputRec->getReferencedAtts(allComputations);
 
 	// now, iterate through the B+-tree query results
-	MyDB_RecordIteratorAltPtr myIter = input->getIteratorAlt();
+	MyDB_RecordIteratorAltPtr myIter = input->getIteratorAlt(whichAtts);
 	while (myIter->advance())
 	{
 
-		myIter->getCurrent(inputRec);
+		// the record is only looked at until the output is written, so it can stay on its page
+		myIter->getCurrentView(inputRec);
 
 		// see if it is accepted by the predicate
-		if (!pred()->toBool())
+		if (!pred().toBool())
 		{
 			continue;
 		}
@@ -46,7 +52,7 @@ void RegularSelection ::run()
 		for (auto &f : finalComputations)
 		{
 			// cout << "computing " << projections[i] << " result " << f()->toString() << "\n";
-			outputRec->getAtt(i++)->set(f());
+			outputRec->getValue(i++).set(f());
 		}
 
 		outputRec->recordContentHasChanged();
@@ -61,26 +61,65 @@ void ScanJoin ::run()
 	// of the records with that hsah value are located
 	unordered_map<size_t, vector<void *>> myHash;
 
-	// get all of the pages
-	vector<MyDB_PageReaderWriter> allData;
+	// all of the pages of the smaller table get pinned, so set aside frames for them, and one
+	// more for putting the records of a PAX page back together... the executor should only
+	// pick a scan join if that many frames can be spared
+	size_t numNeeded = leftTable->getNumPages() + 1;
+	MyDB_MemoryGrantPtr grant = leftTable->getBufferMgr()->reserveFrames(numNeeded);
+	if (grant->getNumFrames() < numNeeded)
+	{
+		cout << "Warning: the scan join could only reserve " << grant->getNumFrames() << " of the "
+				 << numNeeded << " frames that it needs.\n";
+	}
+
+	// get all of the pages, reading them all at once
+	vector<long> positions;
 	for (int i = 0; i < leftTable->getNumPages(); i++)
 	{
-		MyDB_PageReaderWriter temp = leftTable->getPinned(i);
+		positions.push_back(i);
+	}
+	vector<MyDB_PageReaderWriter> allData;
+	for (MyDB_PageReaderWriter &temp : leftTable->getPinnedPages(positions, grant))
+	{
+		// the hash table points right at the records, so there is nothing to fall back on
+		if (!temp.hasRAM())
+		{
+			cout << "The scan join can't get enough RAM to pin the smaller table, so it was stopped.\n";
+			return;
+		}
+
 		if (temp.getType() == MyDB_PageType ::RegularPage)
-			allData.push_back(leftTable->getPinned(i));
+		{
+			allData.push_back(temp);
+		}
+
+		// the records on a PAX page have to be put back together on a page of their own, using
+		// the extra frame, and then the PAX page is let go of, which gives its frame to the next
+		else if (temp.getType() == MyDB_PageType ::PaxPage)
+		{
+			MyDB_PageReaderWriter rows(*leftTable->getBufferMgr(), grant);
+			if (!rows.hasRAM())
+			{
+				cout << "The scan join can't get enough RAM to pin the smaller table, so it was stopped.\n";
+				return;
+			}
+			temp.copyTo(rows, leftTable->getEmptyRecord());
+			allData.push_back(rows);
+			temp = MyDB_PageReaderWriter();
+		}
 	}
 
 	// get the left input record
 	MyDB_RecordPtr leftInputRec = leftTable->getEmptyRecord();
 
 	// and get the various functions whose output we'll hash
-	vector<func> leftEqualities;
+	vector<valFunc> leftEqualities;
 	for (auto &p : equalityChecks)
 	{
-		leftEqualities.push_back(leftInputRec->compileComputation(p.first));
+		leftEqualities.push_back(leftInputRec->compileValueComputation(p.first));
 	}
 	// now get the predicate
-	func leftPred = leftInputRec->compileComputation(leftSelectionPredicate);
+	valFunc leftPred = leftInputRec->compileValueComputation(leftSelectionPredicate);
 
 	// add all of the records to the hash table
 	MyDB_RecordIteratorAltPtr myIter = getIteratorAlt(allData);
@@ -89,10 +128,10 @@ void ScanJoin ::run()
 	{
 
 		// hash the current record
-		myIter->getCurrent(leftInputRec);
+		myIter->getCurrentView(leftInputRec);
 
 		// see if it is accepted by the preicate
-		if (!leftPred()->toBool())
+		if (!leftPred().toBool())
 		{
 			continue;
 		}
@@ -101,7 +140,7 @@ void ScanJoin ::run()
 		size_t hashVal = 0;
 		for (auto &f : leftEqualities)
 		{
-			hashVal ^= f()->hash();
+			hashVal ^= f().hash();
 		}
 
 		// see if it is in the hash table
@@ -112,14 +151,14 @@ void ScanJoin ::run()
 
 	// get the right input record, and get the various functions over it
 	MyDB_RecordPtr rightInputRec = rightTable->getEmptyRecord();
-	vector<func> rightEqualities;
+	vector<valFunc> rightEqualities;
 	for (auto &p : equalityChecks)
 	{
-		rightEqualities.push_back(rightInputRec->compileComputation(p.second));
+		rightEqualities.push_back(rightInputRec->compileValueComputation(p.second));
 	}
 
 	// now get the predicate
-	func rightPred = rightInputRec->compileComputation(rightSelectionPredicate);
+	valFunc rightPred = rightInputRec->compileValueComputation(rightSelectionPredicate);
 
 	// and get the schema that results from combining the left and right records
 	MyDB_SchemaPtr mySchemaOut = make_shared<MyDB_Schema>();
@@ -133,13 +172,13 @@ void ScanJoin ::run()
 	combinedRec->buildFrom(leftInputRec, rightInputRec);
 
 	// now, get the final predicate over it
-	func finalPredicate = combinedRec->compileComputation(finalSelectionPredicate);
+	valFunc finalPredicate = combinedRec->compileValueComputation(finalSelectionPredicate);
 
 	// and get the final set of computatoins that will be used to buld the output record
-	vector<func> finalComputations;
+	vector<valFunc> finalComputations;
 	for (string s : projections)
 	{
-		finalComputations.push_back(combinedRec->compileComputation(s));
+		finalComputations.push_back(combinedRec->compileValueComputation(s));
 	}
 
 	// this is the output record
@@ -153,7 +192,7 @@ void ScanJoin ::run()
 		myIterAgain->getNext();
 
 		// see if it is accepted by the preicate
-		if (!rightPred()->toBool())
+		if (!rightPred().toBool())
 		{
 			continue;
 		}
@@ -162,7 +201,7 @@ void ScanJoin ::run()
 		size_t hashVal = 0;
 		for (auto &f : rightEqualities)
 		{
-			hashVal ^= f()->hash();
+			hashVal ^= f().hash();
 		}
 
 		// get the list of potential matches... first verify that there IS
@@ -179,18 +218,19 @@ void ScanJoin ::run()
 		for (auto &v : potentialMatches)
 		{
 
-			// build the combined record
-			leftInputRec->fromBinary(v);
+			// build the combined record... the left pages are all pinned, so there is no
+			// need to copy the record off of its page
+			leftInputRec->viewBinary(v);
 
 			// check to see if it is accepted by the join predicate
-			if (finalPredicate()->toBool())
+			if (finalPredicate().toBool())
 			{
 
 				// run all of the computations
 				int i = 0;
 				for (auto &f : finalComputations)
 				{
-					outputRec->getAtt(i++)->set(f());
+					outputRec->getValue(i++).set(f());
 				}
 
 				// the record's content has changed because it
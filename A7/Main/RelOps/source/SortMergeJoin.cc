@@ -29,6 +29,12 @@ SortMergeJoin :: SortMergeJoin (MyDB_TableReaderWriterPtr leftInputIn, MyDB_Tabl
 
 void SortMergeJoin :: run () {
 
+	// each run is sorted in RAM, so we ask for a frame for each page of a run... if there are
+	// not that many to spare, we make do with shorter runs
+	MyDB_MemoryGrantPtr grant = leftTable->getBufferMgr ()->reserveFrames (runSize);
+	if (grant->getNumFrames () < (size_t) runSize)
+		runSize = grant->getNumFrames () > 1 ? grant->getNumFrames () : 1;
+
 	// get two left input records
 	MyDB_RecordPtr leftInputRec = leftTable->getEmptyRecord ();
 	MyDB_RecordPtr leftInputRecOther = leftTable->getEmptyRecord ();
@@ -42,11 +48,20 @@ void SortMergeJoin :: run () {
 	function <bool ()> leftCompRev = buildRecordComparator (leftInputRecOther, leftInputRec, equalityCheck.first);
 	function <bool ()> rightComp = buildRecordComparator (rightInputRec, rightInputRecOther, equalityCheck.second);
 
+	// the merge of the sorted runs loads records into the ones it compares with, so the sorts get
+	// records of their own... otherwise, a merge of more than one run clobbers the records we join
+	MyDB_RecordPtr leftSortRec = leftTable->getEmptyRecord ();
+	MyDB_RecordPtr leftSortRecOther = leftTable->getEmptyRecord ();
+	MyDB_RecordPtr rightSortRec = rightTable->getEmptyRecord ();
+	MyDB_RecordPtr rightSortRecOther = rightTable->getEmptyRecord ();
+
 	// now, sort the left and the right
-	MyDB_RecordIteratorAltPtr right = buildItertorOverSortedRuns (runSize, *rightTable, rightComp, rightInputRec, 
-		rightInputRecOther, rightSelectionPredicate);
-	MyDB_RecordIteratorAltPtr left = buildItertorOverSortedRuns (runSize, *leftTable, leftComp, leftInputRec, 
-		leftInputRecOther, leftSelectionPredicate);
+	MyDB_RecordIteratorAltPtr right = buildItertorOverSortedRuns (runSize, *rightTable, 
+		buildRecordComparator (rightSortRec, rightSortRecOther, equalityCheck.second), rightSortRec, 
+		rightSortRecOther, rightSelectionPredicate);
+	MyDB_RecordIteratorAltPtr left = buildItertorOverSortedRuns (runSize, *leftTable, 
+		buildRecordComparator (leftSortRec, leftSortRecOther, equalityCheck.first), leftSortRec, 
+		leftSortRecOther, leftSelectionPredicate);
 
 	// and get the schema that results from combining the left and right records
 	MyDB_SchemaPtr mySchemaOut = make_shared <MyDB_Schema> ();
@@ -60,25 +75,34 @@ void SortMergeJoin :: run () {
 	combinedRec->buildFrom (leftInputRec, rightInputRec);
 
 	// now, get the final predicate over it
-	func finalPredicate = combinedRec->compileComputation (finalSelectionPredicate);
+	valFunc finalPredicate = combinedRec->compileValueComputation (finalSelectionPredicate);
 
 	// and get the final set of computatoins that will be used to buld the output record
-	vector <func> finalComputations;
+	vector <valFunc> finalComputations;
 	for (string s : projections) {
-		finalComputations.push_back (combinedRec->compileComputation (s));
+		finalComputations.push_back (combinedRec->compileValueComputation (s));
 	}
 	
 	// compares the two input recs
-	func leftSmaller = combinedRec->compileComputation (" < (" + equalityCheck.first + ", " + equalityCheck.second + ")");
-	func rightSmaller = combinedRec->compileComputation (" > (" + equalityCheck.first + ", " + equalityCheck.second + ")");
-	func areEqual = combinedRec->compileComputation (" == (" + equalityCheck.first + ", " + equalityCheck.second + ")");
+	valFunc leftSmaller = combinedRec->compileValueComputation (" < (" + equalityCheck.first + ", " + equalityCheck.second + ")");
+	valFunc rightSmaller = combinedRec->compileValueComputation (" > (" + equalityCheck.first + ", " + equalityCheck.second + ")");
+	valFunc areEqual = combinedRec->compileValueComputation (" == (" + equalityCheck.first + ", " + equalityCheck.second + ")");
 	
 	// this is the output record
 	MyDB_RecordPtr outputRec = output->getEmptyRecord ();
 
-	// it is time to run the merge!!
-	MyDB_PageReaderWriter lastPage (true, *(leftTable->getBufferMgr ()));
+	// it is time to run the merge!!  The LHS records with the same key are put onto pages that
+	// are pinned through the grant, so that they can be looked at where they are; if a group
+	// needs more of them than we can get, the rest of it goes onto pages that can be written
+	// out, and its records are copied out when they are looked at
+	MyDB_PageReaderWriter firstPage (*(leftTable->getBufferMgr ()), grant);
+	if (!firstPage.hasRAM ()) {
+		cout << "The sort-merge join can't get any RAM for its groups, so it was stopped.\n";
+		return;
+	}
+	MyDB_PageReaderWriter lastPage;
 	vector <MyDB_PageReaderWriter> allPages;
+	bool groupSpilled = false;
 
 	// if we have no results...
 	if (!left->advance () || !right->advance ())
@@ -91,26 +115,28 @@ void SortMergeJoin :: run () {
 		left->getCurrent (leftInputRec);
 		right->getCurrent (rightInputRec);
 
-		if (leftSmaller ()->toBool ()) {
+		if (leftSmaller ().toBool ()) {
 
 			// try to move the left forward
 			if (!left->advance ()) {
 				allDone = true;
 			}
 
-		} else if (rightSmaller ()->toBool ()) {
+		} else if (rightSmaller ().toBool ()) {
 
 			// try to move the right forward
 			if (!right->advance ()) {
 				allDone = true;
 			}
 
-		} else if (areEqual ()->toBool ()) {
+		} else if (areEqual ().toBool ()) {
 
+			lastPage = firstPage;
 			lastPage.clear ();
 			allPages.clear ();
 			allPages.push_back (lastPage);
 			lastPage.append (leftInputRec);
+			groupSpilled = false;
 			
 			// get all of the LHS records that have the same key
 			int counter = 1;
@@ -127,7 +153,17 @@ void SortMergeJoin :: run () {
 				// it is the same!!
 				if (!leftComp () && !leftCompRev ()) {
 					if (!lastPage.append (leftInputRecOther)) {
-						MyDB_PageReaderWriter nextPage (true, *(leftTable->getBufferMgr ()));
+						MyDB_PageReaderWriter nextPage;
+						if (!groupSpilled && (grant->getNumUsed () < grant->getNumFrames () || grant->grow (1) > 0))
+							nextPage = MyDB_PageReaderWriter (*(leftTable->getBufferMgr ()), grant);
+						if (!nextPage.hasRAM ()) {
+							nextPage = MyDB_PageReaderWriter (*(leftTable->getBufferMgr ()));
+							groupSpilled = true;
+						}
+						if (!nextPage.hasRAM ()) {
+							cout << "The sort-merge join ran out of RAM, so it was stopped.\n";
+							return;
+						}
 						lastPage = nextPage;
 						allPages.push_back (lastPage);
 						lastPage.append (leftInputRecOther);
@@ -146,7 +182,7 @@ void SortMergeJoin :: run () {
 			while (true) {
 			
 				// the records are the same!!
-				if (areEqual ()->toBool ()) {
+				if (areEqual ().toBool ()) {
 
 					//cout << rightInputRec << "\n";
 					counter++;
@@ -159,14 +195,18 @@ void SortMergeJoin :: run () {
 						myIterAgain = getIteratorAlt (allPages);
 					}
 
-					// check for a match
+					// check for a match... if the LHS group is all on pinned pages, the records
+					// can be looked at where they are
 					while (myIterAgain->advance ()) {
-						myIterAgain->getCurrent (leftInputRec);		
-						if (finalPredicate ()->toBool ()) {
+						if (groupSpilled)
+							myIterAgain->getCurrent (leftInputRec);
+						else
+							myIterAgain->getCurrentView (leftInputRec);		
+						if (finalPredicate ().toBool ()) {
 							// got one!!
 							int i = 0;
 							for (auto &f : finalComputations) {
-								outputRec->getAtt (i++)->set (f());
+								outputRec->getValue (i++).set (f());
 							}
 							outputRec->recordContentHasChanged ();
 							output->append (outputRec);	
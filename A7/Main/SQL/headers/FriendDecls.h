@@ -6,6 +6,7 @@ friend struct SQLStatement *makeSelectQuery (struct SFWQuery *fromMe);
 friend struct SQLStatement *makeCreateTable (struct CreateTable *fromMe);
 friend struct CreateTable *makeTableRegular (char *tableName, struct AttList *fromMe);
 friend struct CreateTable *makeTableBPlusTree (char *tableName, struct AttList *fromMe, char *attName);
+friend struct CreateTable *makeTableOfType (char *tableName, struct AttList *fromMe, char *typeName);
 friend struct AttList *makeAttList (char *attName, int whichType);
 friend struct FromList *makeFromList (char *tableName, char *aliasName);
 friend struct FromList *appendFromList (struct FromList *appendToMe, char *tableName, char *aliasName);
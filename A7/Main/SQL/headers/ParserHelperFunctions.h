@@ -62,6 +62,10 @@ struct CreateTable *makeTableRegular (char *tableName, struct AttList *fromMe);
 // makes a B+-Tree table
 struct CreateTable *makeTableBPlusTree (char *tableName, struct AttList *fromMe, char *attName);
 
+// makes a database table of the named kind; right now, the only one is PAX (a heap file
+// whose full pages are stored a column at a time)
+struct CreateTable *makeTableOfType (char *tableName, struct AttList *fromMe, char *typeName);
+
 // makes an attribute list out of a single attribute
 struct AttList *makeAttList (char *attName, int whichType);
 
@@ -104,6 +104,10 @@ private:
 	// the attribute to organize the B+-Tree on
 	string sortAtt;
 
+	// if we do not create a B+-Tree, the kind of heap file to create ("heap" or "heap-pax"); this
+	// is empty if the CREATE TABLE asked for a kind of table that does not exist
+	string fileType;
+
 public:
 	string addToCatalog (string storageDir, MyDB_CatalogPtr addToMe) {
 
@@ -118,8 +122,12 @@ public:
 
 		// just a regular file
 		if (!isBPlusTree) {
+			if (fileType == "") {
+				cout << "Table not created; the only kind of table that can be asked for by name is PAX.\n";
+				return "nothing";
+			}
 			myTable =  make_shared <MyDB_Table> (tableName, 
-				storageDir + "/" + tableName + ".bin", mySchema);	
+				storageDir + "/" + tableName + ".bin", mySchema, fileType, "none");	
 
 		// creating a B+-Tree
 		} else {
@@ -145,6 +153,7 @@ public:
 		tableName = tableNameIn;
 		attsToCreate = atts;
 		isBPlusTree = false;
+		fileType = "heap";
 	}
 
 	CreateTable (string tableNameIn, vector <pair <string, MyDB_AttTypePtr>> atts, string sortAttIn) {
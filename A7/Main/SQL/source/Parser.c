@@ -1,14 +1,14 @@
-/* A Bison parser, made by GNU Bison 2.3.  */
+/* A Bison parser, made by GNU Bison 3.8.2.  */
 
-/* Skeleton implementation for Bison's Yacc-like parsers in C
+/* Bison implementation for Yacc-like parsers in C
 
-   Copyright (C) 1984, 1989, 1990, 2000, 2001, 2002, 2003, 2004, 2005, 2006
-   Free Software Foundation, Inc.
+   Copyright (C) 1984, 1989-1990, 2000-2015, 2018-2021 Free Software Foundation,
+   Inc.
 
-   This program is free software; you can redistribute it and/or modify
+   This program is free software: you can redistribute it and/or modify
    it under the terms of the GNU General Public License as published by
-   the Free Software Foundation; either version 2, or (at your option)
-   any later version.
+   the Free Software Foundation, either version 3 of the License, or
+   (at your option) any later version.
 
    This program is distributed in the hope that it will be useful,
    but WITHOUT ANY WARRANTY; without even the implied warranty of
@@ -16,9 +16,7 @@
    GNU General Public License for more details.
 
    You should have received a copy of the GNU General Public License
-   along with this program; if not, write to the Free Software
-   Foundation, Inc., 51 Franklin Street, Fifth Floor,
-   Boston, MA 02110-1301, USA.  */
+   along with this program.  If not, see <https://www.gnu.org/licenses/>.  */
 
 /* As a special exception, you may create a larger work that contains
    part or all of the Bison parser skeleton and distribute that work
@@ -36,6 +34,10 @@
 /* C LALR(1) parser skeleton written by Richard Stallman, by
    simplifying the original so-called "semantic" parser.  */
 
+/* DO NOT RELY ON FEATURES THAT ARE NOT DOCUMENTED in the manual,
+   especially those whose name start with YY_ or yy_.  They are
+   private implementation details that can be changed or removed.  */
+
 /* All symbols defined below should begin with yy or YY, to avoid
    infringing on user name space.  This should be done even for local
    variables, as they might otherwise be expanded by user macros.
@@ -43,11 +45,11 @@
    define necessary library symbols; they are noted "INFRINGES ON
    USER NAME SPACE" below.  */
 
-/* Identify Bison output.  */
-#define YYBISON 1
+/* Identify Bison output, and Bison version.  */
+#define YYBISON 30802
 
-/* Bison version.  */
-#define YYBISON_VERSION "2.3"
+/* Bison version string.  */
+#define YYBISON_VERSION "3.8.2"
 
 /* Skeleton name.  */
 #define YYSKELETON_NAME "yacc.c"
@@ -55,72 +57,17 @@
 /* Pure parsers.  */
 #define YYPURE 1
 
-/* Using locations.  */
-#define YYLSP_NEEDED 0
-
-
-
-/* Tokens.  */
-#ifndef YYTOKENTYPE
-# define YYTOKENTYPE
-   /* Put the tokens into the symbol table, so that GDB and other debuggers
-      know about them.  */
-   enum yytokentype {
-     INTEGER = 258,
-     IDENTIFIER = 259,
-     DBL = 260,
-     STR = 261,
-     SELECT = 262,
-     FROM = 263,
-     WHERE = 264,
-     AS = 265,
-     BY = 266,
-     AND = 267,
-     OR = 268,
-     NOT = 269,
-     SUM = 270,
-     AVG = 271,
-     GROUP = 272,
-     INT = 273,
-     BOOL = 274,
-     BPLUSTREE = 275,
-     CREATE = 276,
-     DOUBLE = 277,
-     STRING = 278,
-     ON = 279,
-     TABLE = 280
-   };
-#endif
-/* Tokens.  */
-#define INTEGER 258
-#define IDENTIFIER 259
-#define DBL 260
-#define STR 261
-#define SELECT 262
-#define FROM 263
-#define WHERE 264
-#define AS 265
-#define BY 266
-#define AND 267
-#define OR 268
-#define NOT 269
-#define SUM 270
-#define AVG 271
-#define GROUP 272
-#define INT 273
-#define BOOL 274
-#define BPLUSTREE 275
-#define CREATE 276
-#define DOUBLE 277
-#define STRING 278
-#define ON 279
-#define TABLE 280
-
-
-
-
-/* Copy the first part of user declarations.  */
-#line 2 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
+/* Push parsers.  */
+#define YYPUSH 0
+
+/* Pull parsers.  */
+#define YYPULL 1
+
+
+
+
+/* First part of user prologue.  */
+#line 2 "Parser.y"
 
 	#include "Lexer.h"
 	#include "ParserHelperFunctions.h" 
@@ -130,86 +77,176 @@
 	#include <string.h>
 
 
+#line 81 "Parser.c"
 
-/* Enabling traces.  */
-#ifndef YYDEBUG
-# define YYDEBUG 0
-#endif
-
-/* Enabling verbose error messages.  */
-#ifdef YYERROR_VERBOSE
-# undef YYERROR_VERBOSE
-# define YYERROR_VERBOSE 1
-#else
-# define YYERROR_VERBOSE 0
-#endif
-
-/* Enabling the token table.  */
-#ifndef YYTOKEN_TABLE
-# define YYTOKEN_TABLE 0
-#endif
+# ifndef YY_CAST
+#  ifdef __cplusplus
+#   define YY_CAST(Type, Val) static_cast<Type> (Val)
+#   define YY_REINTERPRET_CAST(Type, Val) reinterpret_cast<Type> (Val)
+#  else
+#   define YY_CAST(Type, Val) ((Type) (Val))
+#   define YY_REINTERPRET_CAST(Type, Val) ((Type) (Val))
+#  endif
+# endif
+# ifndef YY_NULLPTR
+#  if defined __cplusplus
+#   if 201103L <= __cplusplus
+#    define YY_NULLPTR nullptr
+#   else
+#    define YY_NULLPTR 0
+#   endif
+#  else
+#   define YY_NULLPTR ((void*)0)
+#  endif
+# endif
 
-#if ! defined YYSTYPE && ! defined YYSTYPE_IS_DECLARED
-typedef union YYSTYPE
-#line 13 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
+#include "Parser.h"
+/* Symbol kind.  */
+enum yysymbol_kind_t
 {
-	struct SQLStatement *myStatement;
-	struct SFWQuery *mySelectQuery;
-	struct CreateTable *myCreateTable;
-	struct FromList *myFromList;
-	struct AttList *myAttList;
-	struct Value *myValue;
-	struct ValueList *allValues;
-	struct CNF *myCNF;	
-	int myInt;
-	char *myChar;
-	double myDouble;
-}
-/* Line 193 of yacc.c.  */
-#line 170 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.c"
-	YYSTYPE;
-# define yystype YYSTYPE /* obsolescent; will be withdrawn */
-# define YYSTYPE_IS_DECLARED 1
-# define YYSTYPE_IS_TRIVIAL 1
-#endif
-
-
+  YYSYMBOL_YYEMPTY = -2,
+  YYSYMBOL_YYEOF = 0,                      /* "end of file"  */
+  YYSYMBOL_YYerror = 1,                    /* error  */
+  YYSYMBOL_YYUNDEF = 2,                    /* "invalid token"  */
+  YYSYMBOL_INTEGER = 3,                    /* INTEGER  */
+  YYSYMBOL_IDENTIFIER = 4,                 /* IDENTIFIER  */
+  YYSYMBOL_DBL = 5,                        /* DBL  */
+  YYSYMBOL_STR = 6,                        /* STR  */
+  YYSYMBOL_SELECT = 7,                     /* SELECT  */
+  YYSYMBOL_FROM = 8,                       /* FROM  */
+  YYSYMBOL_WHERE = 9,                      /* WHERE  */
+  YYSYMBOL_AS = 10,                        /* AS  */
+  YYSYMBOL_BY = 11,                        /* BY  */
+  YYSYMBOL_AND = 12,                       /* AND  */
+  YYSYMBOL_OR = 13,                        /* OR  */
+  YYSYMBOL_NOT = 14,                       /* NOT  */
+  YYSYMBOL_SUM = 15,                       /* SUM  */
+  YYSYMBOL_AVG = 16,                       /* AVG  */
+  YYSYMBOL_GROUP = 17,                     /* GROUP  */
+  YYSYMBOL_INT = 18,                       /* INT  */
+  YYSYMBOL_BOOL = 19,                      /* BOOL  */
+  YYSYMBOL_BPLUSTREE = 20,                 /* BPLUSTREE  */
+  YYSYMBOL_CREATE = 21,                    /* CREATE  */
+  YYSYMBOL_DOUBLE = 22,                    /* DOUBLE  */
+  YYSYMBOL_STRING = 23,                    /* STRING  */
+  YYSYMBOL_ON = 24,                        /* ON  */
+  YYSYMBOL_TABLE = 25,                     /* TABLE  */
+  YYSYMBOL_26_ = 26,                       /* '('  */
+  YYSYMBOL_27_ = 27,                       /* ')'  */
+  YYSYMBOL_28_ = 28,                       /* ','  */
+  YYSYMBOL_29_ = 29,                       /* '>'  */
+  YYSYMBOL_30_ = 30,                       /* '<'  */
+  YYSYMBOL_31_ = 31,                       /* '='  */
+  YYSYMBOL_32_ = 32,                       /* '+'  */
+  YYSYMBOL_33_ = 33,                       /* '-'  */
+  YYSYMBOL_34_ = 34,                       /* '*'  */
+  YYSYMBOL_35_ = 35,                       /* '/'  */
+  YYSYMBOL_36_ = 36,                       /* '.'  */
+  YYSYMBOL_YYACCEPT = 37,                  /* $accept  */
+  YYSYMBOL_SQLStatement = 38,              /* SQLStatement  */
+  YYSYMBOL_CreateTable = 39,               /* CreateTable  */
+  YYSYMBOL_AttList = 40,                   /* AttList  */
+  YYSYMBOL_Att = 41,                       /* Att  */
+  YYSYMBOL_SelectQuery = 42,               /* SelectQuery  */
+  YYSYMBOL_FromList = 43,                  /* FromList  */
+  YYSYMBOL_CNF = 44,                       /* CNF  */
+  YYSYMBOL_Disjunction = 45,               /* Disjunction  */
+  YYSYMBOL_Comparison = 46,                /* Comparison  */
+  YYSYMBOL_ValueList = 47,                 /* ValueList  */
+  YYSYMBOL_Value = 48,                     /* Value  */
+  YYSYMBOL_MultExp = 49,                   /* MultExp  */
+  YYSYMBOL_Literal = 50                    /* Literal  */
+};
+typedef enum yysymbol_kind_t yysymbol_kind_t;
 
-/* Copy the second part of user declarations.  */
 
 
-/* Line 216 of yacc.c.  */
-#line 183 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.c"
 
 #ifdef short
 # undef short
 #endif
 
-#ifdef YYTYPE_UINT8
-typedef YYTYPE_UINT8 yytype_uint8;
-#else
-typedef unsigned char yytype_uint8;
+/* On compilers that do not define __PTRDIFF_MAX__ etc., make sure
+   <limits.h> and (if available) <stdint.h> are included
+   so that the code can choose integer types of a good width.  */
+
+#ifndef __PTRDIFF_MAX__
+# include <limits.h> /* INFRINGES ON USER NAME SPACE */
+# if defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
+#  include <stdint.h> /* INFRINGES ON USER NAME SPACE */
+#  define YY_STDINT_H
+# endif
 #endif
 
-#ifdef YYTYPE_INT8
-typedef YYTYPE_INT8 yytype_int8;
-#elif (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+/* Narrow types that promote to a signed type and that can represent a
+   signed or unsigned integer of at least N bits.  In tables they can
+   save space and decrease cache pressure.  Promoting to a signed type
+   helps avoid bugs in integer arithmetic.  */
+
+#ifdef __INT_LEAST8_MAX__
+typedef __INT_LEAST8_TYPE__ yytype_int8;
+#elif defined YY_STDINT_H
+typedef int_least8_t yytype_int8;
+#else
 typedef signed char yytype_int8;
+#endif
+
+#ifdef __INT_LEAST16_MAX__
+typedef __INT_LEAST16_TYPE__ yytype_int16;
+#elif defined YY_STDINT_H
+typedef int_least16_t yytype_int16;
 #else
-typedef short int yytype_int8;
+typedef short yytype_int16;
+#endif
+
+/* Work around bug in HP-UX 11.23, which defines these macros
+   incorrectly for preprocessor constants.  This workaround can likely
+   be removed in 2023, as HPE has promised support for HP-UX 11.23
+   (aka HP-UX 11i v2) only through the end of 2022; see Table 2 of
+   <https://h20195.www2.hpe.com/V2/getpdf.aspx/4AA4-7673ENW.pdf>.  */
+#ifdef __hpux
+# undef UINT_LEAST8_MAX
+# undef UINT_LEAST16_MAX
+# define UINT_LEAST8_MAX 255
+# define UINT_LEAST16_MAX 65535
 #endif
 
-#ifdef YYTYPE_UINT16
-typedef YYTYPE_UINT16 yytype_uint16;
+#if defined __UINT_LEAST8_MAX__ && __UINT_LEAST8_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST8_TYPE__ yytype_uint8;
+#elif (!defined __UINT_LEAST8_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST8_MAX <= INT_MAX)
+typedef uint_least8_t yytype_uint8;
+#elif !defined __UINT_LEAST8_MAX__ && UCHAR_MAX <= INT_MAX
+typedef unsigned char yytype_uint8;
 #else
-typedef unsigned short int yytype_uint16;
+typedef short yytype_uint8;
 #endif
 
-#ifdef YYTYPE_INT16
-typedef YYTYPE_INT16 yytype_int16;
+#if defined __UINT_LEAST16_MAX__ && __UINT_LEAST16_MAX__ <= __INT_MAX__
+typedef __UINT_LEAST16_TYPE__ yytype_uint16;
+#elif (!defined __UINT_LEAST16_MAX__ && defined YY_STDINT_H \
+       && UINT_LEAST16_MAX <= INT_MAX)
+typedef uint_least16_t yytype_uint16;
+#elif !defined __UINT_LEAST16_MAX__ && USHRT_MAX <= INT_MAX
+typedef unsigned short yytype_uint16;
 #else
-typedef short int yytype_int16;
+typedef int yytype_uint16;
+#endif
+
+#ifndef YYPTRDIFF_T
+# if defined __PTRDIFF_TYPE__ && defined __PTRDIFF_MAX__
+#  define YYPTRDIFF_T __PTRDIFF_TYPE__
+#  define YYPTRDIFF_MAXIMUM __PTRDIFF_MAX__
+# elif defined PTRDIFF_MAX
+#  ifndef ptrdiff_t
+#   include <stddef.h> /* INFRINGES ON USER NAME SPACE */
+#  endif
+#  define YYPTRDIFF_T ptrdiff_t
+#  define YYPTRDIFF_MAXIMUM PTRDIFF_MAX
+# else
+#  define YYPTRDIFF_T long
+#  define YYPTRDIFF_MAXIMUM LONG_MAX
+# endif
 #endif
 
 #ifndef YYSIZE_T
@@ -217,55 +254,106 @@ typedef short int yytype_int16;
 #  define YYSIZE_T __SIZE_TYPE__
 # elif defined size_t
 #  define YYSIZE_T size_t
-# elif ! defined YYSIZE_T && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+# elif defined __STDC_VERSION__ && 199901 <= __STDC_VERSION__
 #  include <stddef.h> /* INFRINGES ON USER NAME SPACE */
 #  define YYSIZE_T size_t
 # else
-#  define YYSIZE_T unsigned int
+#  define YYSIZE_T unsigned
 # endif
 #endif
 
-#define YYSIZE_MAXIMUM ((YYSIZE_T) -1)
+#define YYSIZE_MAXIMUM                                  \
+  YY_CAST (YYPTRDIFF_T,                                 \
+           (YYPTRDIFF_MAXIMUM < YY_CAST (YYSIZE_T, -1)  \
+            ? YYPTRDIFF_MAXIMUM                         \
+            : YY_CAST (YYSIZE_T, -1)))
+
+#define YYSIZEOF(X) YY_CAST (YYPTRDIFF_T, sizeof (X))
+
+
+/* Stored state numbers (used for stacks). */
+typedef yytype_int8 yy_state_t;
+
+/* State numbers in computations.  */
+typedef int yy_state_fast_t;
 
 #ifndef YY_
 # if defined YYENABLE_NLS && YYENABLE_NLS
 #  if ENABLE_NLS
 #   include <libintl.h> /* INFRINGES ON USER NAME SPACE */
-#   define YY_(msgid) dgettext ("bison-runtime", msgid)
+#   define YY_(Msgid) dgettext ("bison-runtime", Msgid)
 #  endif
 # endif
 # ifndef YY_
-#  define YY_(msgid) msgid
+#  define YY_(Msgid) Msgid
+# endif
+#endif
+
+
+#ifndef YY_ATTRIBUTE_PURE
+# if defined __GNUC__ && 2 < __GNUC__ + (96 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_PURE __attribute__ ((__pure__))
+# else
+#  define YY_ATTRIBUTE_PURE
+# endif
+#endif
+
+#ifndef YY_ATTRIBUTE_UNUSED
+# if defined __GNUC__ && 2 < __GNUC__ + (7 <= __GNUC_MINOR__)
+#  define YY_ATTRIBUTE_UNUSED __attribute__ ((__unused__))
+# else
+#  define YY_ATTRIBUTE_UNUSED
 # endif
 #endif
 
 /* Suppress unused-variable warnings by "using" E.  */
 #if ! defined lint || defined __GNUC__
-# define YYUSE(e) ((void) (e))
+# define YY_USE(E) ((void) (E))
 #else
-# define YYUSE(e) /* empty */
+# define YY_USE(E) /* empty */
 #endif
 
-/* Identity function, used to suppress warnings about constant conditions.  */
-#ifndef lint
-# define YYID(n) (n)
-#else
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static int
-YYID (int i)
+/* Suppress an incorrect diagnostic about yylval being uninitialized.  */
+#if defined __GNUC__ && ! defined __ICC && 406 <= __GNUC__ * 100 + __GNUC_MINOR__
+# if __GNUC__ * 100 + __GNUC_MINOR__ < 407
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")
+# else
+#  define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN                           \
+    _Pragma ("GCC diagnostic push")                                     \
+    _Pragma ("GCC diagnostic ignored \"-Wuninitialized\"")              \
+    _Pragma ("GCC diagnostic ignored \"-Wmaybe-uninitialized\"")
+# endif
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END      \
+    _Pragma ("GCC diagnostic pop")
 #else
-static int
-YYID (i)
-    int i;
+# define YY_INITIAL_VALUE(Value) Value
 #endif
-{
-  return i;
-}
+#ifndef YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+# define YY_IGNORE_MAYBE_UNINITIALIZED_END
+#endif
+#ifndef YY_INITIAL_VALUE
+# define YY_INITIAL_VALUE(Value) /* Nothing. */
+#endif
+
+#if defined __cplusplus && defined __GNUC__ && ! defined __ICC && 6 <= __GNUC__
+# define YY_IGNORE_USELESS_CAST_BEGIN                          \
+    _Pragma ("GCC diagnostic push")                            \
+    _Pragma ("GCC diagnostic ignored \"-Wuseless-cast\"")
+# define YY_IGNORE_USELESS_CAST_END            \
+    _Pragma ("GCC diagnostic pop")
+#endif
+#ifndef YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_BEGIN
+# define YY_IGNORE_USELESS_CAST_END
 #endif
 
-#if ! defined yyoverflow || YYERROR_VERBOSE
+
+#define YY_ASSERT(E) ((void) (0 && (E)))
+
+#if !defined yyoverflow
 
 /* The parser invokes alloca or malloc; define the necessary symbols.  */
 
@@ -282,11 +370,11 @@ YYID (i)
 #    define alloca _alloca
 #   else
 #    define YYSTACK_ALLOC alloca
-#    if ! defined _ALLOCA_H && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#    if ! defined _ALLOCA_H && ! defined EXIT_SUCCESS
 #     include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#     ifndef _STDLIB_H
-#      define _STDLIB_H 1
+      /* Use EXIT_SUCCESS as a witness for stdlib.h.  */
+#     ifndef EXIT_SUCCESS
+#      define EXIT_SUCCESS 0
 #     endif
 #    endif
 #   endif
@@ -294,8 +382,8 @@ YYID (i)
 # endif
 
 # ifdef YYSTACK_ALLOC
-   /* Pacify GCC's `empty if-body' warning.  */
-#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (YYID (0))
+   /* Pacify GCC's 'empty if-body' warning.  */
+#  define YYSTACK_FREE(Ptr) do { /* empty */; } while (0)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
     /* The OS might guarantee only one guard page at the bottom of the stack,
        and a page size can be as small as 4096 bytes.  So we cannot safely
@@ -309,111 +397,117 @@ YYID (i)
 #  ifndef YYSTACK_ALLOC_MAXIMUM
 #   define YYSTACK_ALLOC_MAXIMUM YYSIZE_MAXIMUM
 #  endif
-#  if (defined __cplusplus && ! defined _STDLIB_H \
+#  if (defined __cplusplus && ! defined EXIT_SUCCESS \
        && ! ((defined YYMALLOC || defined malloc) \
-	     && (defined YYFREE || defined free)))
+             && (defined YYFREE || defined free)))
 #   include <stdlib.h> /* INFRINGES ON USER NAME SPACE */
-#   ifndef _STDLIB_H
-#    define _STDLIB_H 1
+#   ifndef EXIT_SUCCESS
+#    define EXIT_SUCCESS 0
 #   endif
 #  endif
 #  ifndef YYMALLOC
 #   define YYMALLOC malloc
-#   if ! defined malloc && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined malloc && ! defined EXIT_SUCCESS
 void *malloc (YYSIZE_T); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 #  ifndef YYFREE
 #   define YYFREE free
-#   if ! defined free && ! defined _STDLIB_H && (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
+#   if ! defined free && ! defined EXIT_SUCCESS
 void free (void *); /* INFRINGES ON USER NAME SPACE */
 #   endif
 #  endif
 # endif
-#endif /* ! defined yyoverflow || YYERROR_VERBOSE */
-
+#endif /* !defined yyoverflow */
 
 #if (! defined yyoverflow \
      && (! defined __cplusplus \
-	 || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
+         || (defined YYSTYPE_IS_TRIVIAL && YYSTYPE_IS_TRIVIAL)))
 
 /* A type that is properly aligned for any stack member.  */
 union yyalloc
 {
-  yytype_int16 yyss;
-  YYSTYPE yyvs;
-  };
+  yy_state_t yyss_alloc;
+  YYSTYPE yyvs_alloc;
+};
 
 /* The size of the maximum gap between one aligned stack and the next.  */
-# define YYSTACK_GAP_MAXIMUM (sizeof (union yyalloc) - 1)
+# define YYSTACK_GAP_MAXIMUM (YYSIZEOF (union yyalloc) - 1)
 
 /* The size of an array large to enough to hold all stacks, each with
    N elements.  */
 # define YYSTACK_BYTES(N) \
-     ((N) * (sizeof (yytype_int16) + sizeof (YYSTYPE)) \
+     ((N) * (YYSIZEOF (yy_state_t) + YYSIZEOF (YYSTYPE)) \
       + YYSTACK_GAP_MAXIMUM)
 
-/* Copy COUNT objects from FROM to TO.  The source and destination do
-   not overlap.  */
-# ifndef YYCOPY
-#  if defined __GNUC__ && 1 < __GNUC__
-#   define YYCOPY(To, From, Count) \
-      __builtin_memcpy (To, From, (Count) * sizeof (*(From)))
-#  else
-#   define YYCOPY(To, From, Count)		\
-      do					\
-	{					\
-	  YYSIZE_T yyi;				\
-	  for (yyi = 0; yyi < (Count); yyi++)	\
-	    (To)[yyi] = (From)[yyi];		\
-	}					\
-      while (YYID (0))
-#  endif
-# endif
+# define YYCOPY_NEEDED 1
 
 /* Relocate STACK from its old location to the new one.  The
    local variables YYSIZE and YYSTACKSIZE give the old and new number of
    elements in the stack, and YYPTR gives the new location of the
    stack.  Advance YYPTR to a properly aligned location for the next
    stack.  */
-# define YYSTACK_RELOCATE(Stack)					\
-    do									\
-      {									\
-	YYSIZE_T yynewbytes;						\
-	YYCOPY (&yyptr->Stack, Stack, yysize);				\
-	Stack = &yyptr->Stack;						\
-	yynewbytes = yystacksize * sizeof (*Stack) + YYSTACK_GAP_MAXIMUM; \
-	yyptr += yynewbytes / sizeof (*yyptr);				\
-      }									\
-    while (YYID (0))
+# define YYSTACK_RELOCATE(Stack_alloc, Stack)                           \
+    do                                                                  \
+      {                                                                 \
+        YYPTRDIFF_T yynewbytes;                                         \
+        YYCOPY (&yyptr->Stack_alloc, Stack, yysize);                    \
+        Stack = &yyptr->Stack_alloc;                                    \
+        yynewbytes = yystacksize * YYSIZEOF (*Stack) + YYSTACK_GAP_MAXIMUM; \
+        yyptr += yynewbytes / YYSIZEOF (*yyptr);                        \
+      }                                                                 \
+    while (0)
 
 #endif
 
+#if defined YYCOPY_NEEDED && YYCOPY_NEEDED
+/* Copy COUNT objects from SRC to DST.  The source and destination do
+   not overlap.  */
+# ifndef YYCOPY
+#  if defined __GNUC__ && 1 < __GNUC__
+#   define YYCOPY(Dst, Src, Count) \
+      __builtin_memcpy (Dst, Src, YY_CAST (YYSIZE_T, (Count)) * sizeof (*(Src)))
+#  else
+#   define YYCOPY(Dst, Src, Count)              \
+      do                                        \
+        {                                       \
+          YYPTRDIFF_T yyi;                      \
+          for (yyi = 0; yyi < (Count); yyi++)   \
+            (Dst)[yyi] = (Src)[yyi];            \
+        }                                       \
+      while (0)
+#  endif
+# endif
+#endif /* !YYCOPY_NEEDED */
+
 /* YYFINAL -- State number of the termination state.  */
 #define YYFINAL  18
 /* YYLAST -- Last index in YYTABLE.  */
-#define YYLAST   118
+#define YYLAST   120
 
 /* YYNTOKENS -- Number of terminals.  */
 #define YYNTOKENS  37
 /* YYNNTS -- Number of nonterminals.  */
 #define YYNNTS  14
 /* YYNRULES -- Number of rules.  */
-#define YYNRULES  42
-/* YYNRULES -- Number of states.  */
-#define YYNSTATES  91
+#define YYNRULES  43
+/* YYNSTATES -- Number of states.  */
+#define YYNSTATES  92
 
-/* YYTRANSLATE(YYLEX) -- Bison symbol number corresponding to YYLEX.  */
-#define YYUNDEFTOK  2
+/* YYMAXUTOK -- Last valid token kind.  */
 #define YYMAXUTOK   280
 
-#define YYTRANSLATE(YYX)						\
-  ((unsigned int) (YYX) <= YYMAXUTOK ? yytranslate[YYX] : YYUNDEFTOK)
 
-/* YYTRANSLATE[YYLEX] -- Bison symbol number corresponding to YYLEX.  */
-static const yytype_uint8 yytranslate[] =
+/* YYTRANSLATE(TOKEN-NUM) -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex, with out-of-bounds checking.  */
+#define YYTRANSLATE(YYX)                                \
+  (0 <= (YYX) && (YYX) <= YYMAXUTOK                     \
+   ? YY_CAST (yysymbol_kind_t, yytranslate[YYX])        \
+   : YYSYMBOL_YYUNDEF)
+
+/* YYTRANSLATE[TOKEN-NUM] -- Symbol number corresponding to TOKEN-NUM
+   as returned by yylex.  */
+static const yytype_int8 yytranslate[] =
 {
        0,     2,     2,     2,     2,     2,     2,     2,     2,     2,
        2,     2,     2,     2,     2,     2,     2,     2,     2,     2,
@@ -447,185 +541,142 @@ static const yytype_uint8 yytranslate[] =
 };
 
 #if YYDEBUG
-/* YYPRHS[YYN] -- Index of the first RHS symbol of rule number YYN in
-   YYRHS.  */
-static const yytype_uint8 yyprhs[] =
+/* YYRLINE[YYN] -- Source line where rule number YYN was defined.  */
+static const yytype_int16 yyrline[] =
 {
-       0,     0,     3,     5,     7,    14,    25,    29,    31,    34,
-      37,    40,    43,    53,    60,    65,    71,    75,    79,    85,
-      87,    91,    95,    97,   101,   105,   110,   114,   117,   121,
-     123,   127,   131,   133,   138,   143,   147,   151,   153,   157,
-     159,   161,   163
+       0,    81,    81,    87,    95,   101,   107,   113,   118,   124,
+     129,   134,   139,   146,   154,   161,   168,   173,   179,   184,
+     189,   194,   200,   205,   211,   216,   221,   226,   231,   237,
+     242,   248,   253,   258,   263,   268,   274,   279,   284,   289,
+     294,   299,   304,   309
 };
+#endif
 
-/* YYRHS -- A `-1'-separated list of the rules' RHS.  */
-static const yytype_int8 yyrhs[] =
-{
-      38,     0,    -1,    42,    -1,    39,    -1,    21,    25,     4,
-      26,    40,    27,    -1,    21,    25,     4,    26,    40,    27,
-      10,    20,    24,     4,    -1,    40,    28,    41,    -1,    41,
-      -1,     4,    18,    -1,     4,    22,    -1,     4,    23,    -1,
-       4,    19,    -1,     7,    47,     8,    43,     9,    44,    17,
-      11,    47,    -1,     7,    47,     8,    43,     9,    44,    -1,
-       7,    47,     8,    43,    -1,     4,    10,     4,    28,    43,
-      -1,     4,    10,     4,    -1,    44,    12,    45,    -1,    44,
-      12,    26,    45,    27,    -1,    45,    -1,    26,    45,    27,
-      -1,    45,    13,    46,    -1,    46,    -1,    48,    29,    48,
-      -1,    48,    30,    48,    -1,    48,    30,    29,    48,    -1,
-      48,    31,    48,    -1,    14,    46,    -1,    47,    28,    48,
-      -1,    48,    -1,    49,    32,    48,    -1,    49,    33,    48,
-      -1,    49,    -1,    15,    26,    48,    27,    -1,    16,    26,
-      48,    27,    -1,    50,    34,    49,    -1,    50,    35,    49,
-      -1,    50,    -1,     4,    36,     4,    -1,     5,    -1,     6,
-      -1,     3,    -1,    26,    48,    27,    -1
-};
+/** Accessing symbol of state STATE.  */
+#define YY_ACCESSING_SYMBOL(State) YY_CAST (yysymbol_kind_t, yystos[State])
 
-/* YYRLINE[YYN] -- source line where rule number YYN was defined.  */
-static const yytype_uint16 yyrline[] =
-{
-       0,    81,    81,    87,    95,   101,   107,   112,   118,   123,
-     128,   133,   140,   148,   155,   162,   167,   173,   178,   183,
-     188,   194,   199,   205,   210,   215,   220,   225,   231,   236,
-     242,   247,   252,   257,   262,   268,   273,   278,   283,   288,
-     293,   298,   303
-};
-#endif
+#if YYDEBUG || 0
+/* The user-facing name of the symbol whose (internal) number is
+   YYSYMBOL.  No bounds checking.  */
+static const char *yysymbol_name (yysymbol_kind_t yysymbol) YY_ATTRIBUTE_UNUSED;
 
-#if YYDEBUG || YYERROR_VERBOSE || YYTOKEN_TABLE
 /* YYTNAME[SYMBOL-NUM] -- String name of the symbol SYMBOL-NUM.
    First, the terminals, then, starting at YYNTOKENS, nonterminals.  */
 static const char *const yytname[] =
 {
-  "$end", "error", "$undefined", "INTEGER", "IDENTIFIER", "DBL", "STR",
-  "SELECT", "FROM", "WHERE", "AS", "BY", "AND", "OR", "NOT", "SUM", "AVG",
-  "GROUP", "INT", "BOOL", "BPLUSTREE", "CREATE", "DOUBLE", "STRING", "ON",
-  "TABLE", "'('", "')'", "','", "'>'", "'<'", "'='", "'+'", "'-'", "'*'",
-  "'/'", "'.'", "$accept", "SQLStatement", "CreateTable", "AttList", "Att",
-  "SelectQuery", "FromList", "CNF", "Disjunction", "Comparison",
-  "ValueList", "Value", "MultExp", "Literal", 0
+  "\"end of file\"", "error", "\"invalid token\"", "INTEGER",
+  "IDENTIFIER", "DBL", "STR", "SELECT", "FROM", "WHERE", "AS", "BY", "AND",
+  "OR", "NOT", "SUM", "AVG", "GROUP", "INT", "BOOL", "BPLUSTREE", "CREATE",
+  "DOUBLE", "STRING", "ON", "TABLE", "'('", "')'", "','", "'>'", "'<'",
+  "'='", "'+'", "'-'", "'*'", "'/'", "'.'", "$accept", "SQLStatement",
+  "CreateTable", "AttList", "Att", "SelectQuery", "FromList", "CNF",
+  "Disjunction", "Comparison", "ValueList", "Value", "MultExp", "Literal", YY_NULLPTR
 };
-#endif
 
-# ifdef YYPRINT
-/* YYTOKNUM[YYLEX-NUM] -- Internal token number corresponding to
-   token YYLEX-NUM.  */
-static const yytype_uint16 yytoknum[] =
+static const char *
+yysymbol_name (yysymbol_kind_t yysymbol)
 {
-       0,   256,   257,   258,   259,   260,   261,   262,   263,   264,
-     265,   266,   267,   268,   269,   270,   271,   272,   273,   274,
-     275,   276,   277,   278,   279,   280,    40,    41,    44,    62,
-      60,    61,    43,    45,    42,    47,    46
-};
-# endif
+  return yytname[yysymbol];
+}
+#endif
 
-/* YYR1[YYN] -- Symbol number of symbol that rule YYN derives.  */
-static const yytype_uint8 yyr1[] =
-{
-       0,    37,    38,    38,    39,    39,    40,    40,    41,    41,
-      41,    41,    42,    42,    42,    43,    43,    44,    44,    44,
-      44,    45,    45,    46,    46,    46,    46,    46,    47,    47,
-      48,    48,    48,    48,    48,    49,    49,    49,    50,    50,
-      50,    50,    50
-};
+#define YYPACT_NINF (-50)
 
-/* YYR2[YYN] -- Number of symbols composing right hand side of rule YYN.  */
-static const yytype_uint8 yyr2[] =
-{
-       0,     2,     1,     1,     6,    10,     3,     1,     2,     2,
-       2,     2,     9,     6,     4,     5,     3,     3,     5,     1,
-       3,     3,     1,     3,     3,     4,     3,     2,     3,     1,
-       3,     3,     1,     4,     4,     3,     3,     1,     3,     1,
-       1,     1,     3
-};
+#define yypact_value_is_default(Yyn) \
+  ((Yyn) == YYPACT_NINF)
 
-/* YYDEFACT[STATE-NAME] -- Default rule to reduce with in state
-   STATE-NUM when YYTABLE doesn't specify something else to do.  Zero
-   means the default is an error.  */
-static const yytype_uint8 yydefact[] =
-{
-       0,     0,     0,     0,     3,     2,    41,     0,    39,    40,
-       0,     0,     0,     0,    29,    32,    37,     0,     1,     0,
-       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
-      38,     0,     0,    42,     0,    14,    28,    30,    31,    35,
-      36,     0,    33,    34,     0,     0,     0,     0,     7,    16,
-       0,     0,    13,    19,    22,     0,     8,    11,     9,    10,
-       4,     0,     0,    27,     0,     0,     0,     0,     0,     0,
-       0,     0,     0,     6,    15,    20,     0,    17,     0,    21,
-      23,     0,    24,    26,     0,     0,    12,    25,     0,    18,
-       5
-};
+#define YYTABLE_NINF (-1)
 
-/* YYDEFGOTO[NTERM-NUM].  */
-static const yytype_int8 yydefgoto[] =
-{
-      -1,     3,     4,    47,    48,     5,    35,    52,    53,    54,
-      13,    55,    15,    16
-};
+#define yytable_value_is_error(Yyn) \
+  0
 
 /* YYPACT[STATE-NUM] -- Index in YYTABLE of the portion describing
    STATE-NUM.  */
-#define YYPACT_NINF -50
 static const yytype_int8 yypact[] =
 {
-       1,    81,   -16,    18,   -50,   -50,   -50,     8,   -50,   -50,
-      30,    48,    81,    -7,   -50,   -19,     5,    60,   -50,    72,
-      81,    81,    51,    75,    81,    81,    81,    85,    85,    55,
-     -50,    68,    76,   -50,    89,    73,   -50,   -50,   -50,   -50,
-     -50,   100,   -50,   -50,   101,    27,    36,    21,   -50,    78,
-      31,    31,    -5,    95,   -50,    63,   -50,   -50,   -50,   -50,
-      99,   100,    75,   -50,    25,    71,    57,   102,    31,    81,
-       0,    81,    90,   -50,   -50,   -50,    31,    95,    81,   -50,
-     -50,    81,   -50,   -50,    88,    38,    86,   -50,   111,   -50,
-     -50
+      33,    81,   -18,    14,   -50,   -50,   -50,     3,   -50,   -50,
+      -8,    22,    81,    -7,   -50,    23,    24,    60,   -50,    70,
+      81,    81,    40,    72,    81,    81,    81,    85,    85,    69,
+     -50,    76,    77,   -50,    89,    96,   -50,   -50,   -50,   -50,
+     -50,   102,   -50,   -50,   104,    27,   -10,    51,   -50,    82,
+      31,    31,    32,    99,   -50,    63,   -50,   -50,   -50,   -50,
+     103,   102,    72,   -50,    38,    71,    57,    98,    31,    81,
+       0,    81,    18,   -50,   -50,   -50,    31,    99,    81,   -50,
+     -50,    81,   -50,   -50,   -50,    90,    39,    87,   -50,   112,
+     -50,   -50
+};
+
+/* YYDEFACT[STATE-NUM] -- Default reduction number in state STATE-NUM.
+   Performed when YYTABLE does not specify something else to do.  Zero
+   means the default is an error.  */
+static const yytype_int8 yydefact[] =
+{
+       0,     0,     0,     0,     3,     2,    42,     0,    40,    41,
+       0,     0,     0,     0,    30,    33,    38,     0,     1,     0,
+       0,     0,     0,     0,     0,     0,     0,     0,     0,     0,
+      39,     0,     0,    43,     0,    15,    29,    31,    32,    36,
+      37,     0,    34,    35,     0,     0,     0,     0,     8,    17,
+       0,     0,    14,    20,    23,     0,     9,    12,    10,    11,
+       4,     0,     0,    28,     0,     0,     0,     0,     0,     0,
+       0,     0,     0,     7,    16,    21,     0,    18,     0,    22,
+      24,     0,    25,    27,     6,     0,     0,    13,    26,     0,
+      19,     5
 };
 
 /* YYPGOTO[NTERM-NUM].  */
 static const yytype_int8 yypgoto[] =
 {
-     -50,   -50,   -50,   -50,    56,   -50,    54,   -50,   -49,   -40,
-      40,    -1,    39,   -50
+     -50,   -50,   -50,   -50,    56,   -50,    58,   -50,   -49,   -40,
+      41,    -1,    54,   -50
+};
+
+/* YYDEFGOTO[NTERM-NUM].  */
+static const yytype_int8 yydefgoto[] =
+{
+       0,     3,     4,    47,    48,     5,    35,    52,    53,    54,
+      13,    55,    15,    16
 };
 
-/* YYTABLE[YYPACT[STATE-NUM]].  What to do in state STATE-NUM.  If
-   positive, shift that token.  If negative, reduce the rule which
-   number is the opposite.  If zero, do what YYDEFACT says.
-   If YYTABLE_NINF, syntax error.  */
-#define YYTABLE_NINF -1
-static const yytype_uint8 yytable[] =
+/* YYTABLE[YYPACT[STATE-NUM]] -- What to do in state STATE-NUM.  If
+   positive, shift that token.  If negative, reduce the rule whose
+   number is the opposite.  If YYTABLE_NINF, syntax error.  */
+static const yytype_int8 yytable[] =
 {
-      14,    23,    64,     6,     7,     8,     9,    66,     1,    17,
-      63,    22,    67,    25,    26,    10,    11,    77,    18,    31,
-      32,    24,     2,    36,    37,    38,    12,    85,    79,    81,
-       6,     7,     8,     9,     6,     7,     8,     9,    68,    27,
-      28,    50,    10,    11,    19,    50,    10,    11,    60,    61,
-      65,    68,    75,    51,    56,    57,    20,    12,    58,    59,
-       6,     7,     8,     9,    29,    89,    39,    40,    80,    82,
-      83,    50,    10,    11,    21,    65,    30,    14,    33,    34,
-      87,    41,    45,    76,     6,     7,     8,     9,     6,     7,
-       8,     9,    69,    70,    71,    42,    10,    11,    33,    44,
-      69,    70,    71,    43,    46,    49,    62,    12,    68,    72,
-      84,    12,    88,    78,    24,    90,    74,    73,    86
+      14,    23,    64,     6,     7,     8,     9,    17,    56,    57,
+      63,    22,    58,    59,    18,    10,    11,    77,    20,    31,
+      32,    24,    84,    36,    37,    38,    12,    86,    79,    81,
+       6,     7,     8,     9,     6,     7,     8,     9,    85,    19,
+       1,    50,    10,    11,    66,    50,    10,    11,    21,    67,
+      65,    68,    68,    51,     2,    25,    26,    12,    27,    28,
+       6,     7,     8,     9,    29,    75,    90,    33,    80,    82,
+      83,    50,    10,    11,    30,    65,    34,    14,    60,    61,
+      88,    39,    40,    76,     6,     7,     8,     9,     6,     7,
+       8,     9,    69,    70,    71,    41,    10,    11,    33,    44,
+      69,    70,    71,    42,    43,    45,    46,    12,    49,    78,
+      62,    12,    68,    72,    89,    24,    91,    73,     0,    87,
+      74
 };
 
-static const yytype_uint8 yycheck[] =
+static const yytype_int8 yycheck[] =
 {
-       1,     8,    51,     3,     4,     5,     6,    12,     7,    25,
-      50,    12,    17,    32,    33,    15,    16,    66,     0,    20,
-      21,    28,    21,    24,    25,    26,    26,    76,    68,    29,
-       3,     4,     5,     6,     3,     4,     5,     6,    13,    34,
-      35,    14,    15,    16,    36,    14,    15,    16,    27,    28,
-      51,    13,    27,    26,    18,    19,    26,    26,    22,    23,
-       3,     4,     5,     6,     4,    27,    27,    28,    69,    70,
-      71,    14,    15,    16,    26,    76,     4,    78,    27,     4,
-      81,    26,     9,    26,     3,     4,     5,     6,     3,     4,
-       5,     6,    29,    30,    31,    27,    15,    16,    27,    10,
-      29,    30,    31,    27,     4,     4,    28,    26,    13,    10,
-      20,    26,    24,    11,    28,     4,    62,    61,    78
+       1,     8,    51,     3,     4,     5,     6,    25,    18,    19,
+      50,    12,    22,    23,     0,    15,    16,    66,    26,    20,
+      21,    28,     4,    24,    25,    26,    26,    76,    68,    29,
+       3,     4,     5,     6,     3,     4,     5,     6,    20,    36,
+       7,    14,    15,    16,    12,    14,    15,    16,    26,    17,
+      51,    13,    13,    26,    21,    32,    33,    26,    34,    35,
+       3,     4,     5,     6,     4,    27,    27,    27,    69,    70,
+      71,    14,    15,    16,     4,    76,     4,    78,    27,    28,
+      81,    27,    28,    26,     3,     4,     5,     6,     3,     4,
+       5,     6,    29,    30,    31,    26,    15,    16,    27,    10,
+      29,    30,    31,    27,    27,     9,     4,    26,     4,    11,
+      28,    26,    13,    10,    24,    28,     4,    61,    -1,    78,
+      62
 };
 
-/* YYSTOS[STATE-NUM] -- The (internal number of the) accessing
-   symbol of state STATE-NUM.  */
-static const yytype_uint8 yystos[] =
+/* YYSTOS[STATE-NUM] -- The symbol kind of the accessing symbol of
+   state STATE-NUM.  */
+static const yytype_int8 yystos[] =
 {
        0,     7,    21,    38,    39,    42,     3,     4,     5,     6,
       15,    16,    26,    47,    48,    49,    50,    25,     0,    36,
@@ -635,99 +686,65 @@ static const yytype_uint8 yystos[] =
       14,    26,    44,    45,    46,    48,    18,    19,    22,    23,
       27,    28,    28,    46,    45,    48,    12,    17,    13,    29,
       30,    31,    10,    41,    43,    27,    26,    45,    11,    46,
-      48,    29,    48,    48,    20,    45,    47,    48,    24,    27,
-       4
+      48,    29,    48,    48,     4,    20,    45,    47,    48,    24,
+      27,     4
 };
 
-#define yyerrok		(yyerrstatus = 0)
-#define yyclearin	(yychar = YYEMPTY)
-#define YYEMPTY		(-2)
-#define YYEOF		0
-
-#define YYACCEPT	goto yyacceptlab
-#define YYABORT		goto yyabortlab
-#define YYERROR		goto yyerrorlab
-
+/* YYR1[RULE-NUM] -- Symbol kind of the left-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr1[] =
+{
+       0,    37,    38,    38,    39,    39,    39,    40,    40,    41,
+      41,    41,    41,    42,    42,    42,    43,    43,    44,    44,
+      44,    44,    45,    45,    46,    46,    46,    46,    46,    47,
+      47,    48,    48,    48,    48,    48,    49,    49,    49,    50,
+      50,    50,    50,    50
+};
 
-/* Like YYERROR except do call yyerror.  This remains here temporarily
-   to ease the transition to the new meaning of YYERROR, for GCC.
-   Once GCC version 2 has supplanted version 1, this can go.  */
+/* YYR2[RULE-NUM] -- Number of symbols on the right-hand side of rule RULE-NUM.  */
+static const yytype_int8 yyr2[] =
+{
+       0,     2,     1,     1,     6,    10,     8,     3,     1,     2,
+       2,     2,     2,     9,     6,     4,     5,     3,     3,     5,
+       1,     3,     3,     1,     3,     3,     4,     3,     2,     3,
+       1,     3,     3,     1,     4,     4,     3,     3,     1,     3,
+       1,     1,     1,     3
+};
 
-#define YYFAIL		goto yyerrlab
 
-#define YYRECOVERING()  (!!yyerrstatus)
+enum { YYENOMEM = -2 };
 
-#define YYBACKUP(Token, Value)					\
-do								\
-  if (yychar == YYEMPTY && yylen == 1)				\
-    {								\
-      yychar = (Token);						\
-      yylval = (Value);						\
-      yytoken = YYTRANSLATE (yychar);				\
-      YYPOPSTACK (1);						\
-      goto yybackup;						\
-    }								\
-  else								\
-    {								\
-      yyerror (scanner, myStatement, YY_("syntax error: cannot back up")); \
-      YYERROR;							\
-    }								\
-while (YYID (0))
-
-
-#define YYTERROR	1
-#define YYERRCODE	256
-
-
-/* YYLLOC_DEFAULT -- Set CURRENT to span from RHS[1] to RHS[N].
-   If N is 0, then set CURRENT to the empty location which ends
-   the previous symbol: RHS[0] (always defined).  */
-
-#define YYRHSLOC(Rhs, K) ((Rhs)[K])
-#ifndef YYLLOC_DEFAULT
-# define YYLLOC_DEFAULT(Current, Rhs, N)				\
-    do									\
-      if (YYID (N))                                                    \
-	{								\
-	  (Current).first_line   = YYRHSLOC (Rhs, 1).first_line;	\
-	  (Current).first_column = YYRHSLOC (Rhs, 1).first_column;	\
-	  (Current).last_line    = YYRHSLOC (Rhs, N).last_line;		\
-	  (Current).last_column  = YYRHSLOC (Rhs, N).last_column;	\
-	}								\
-      else								\
-	{								\
-	  (Current).first_line   = (Current).last_line   =		\
-	    YYRHSLOC (Rhs, 0).last_line;				\
-	  (Current).first_column = (Current).last_column =		\
-	    YYRHSLOC (Rhs, 0).last_column;				\
-	}								\
-    while (YYID (0))
-#endif
+#define yyerrok         (yyerrstatus = 0)
+#define yyclearin       (yychar = YYEMPTY)
 
+#define YYACCEPT        goto yyacceptlab
+#define YYABORT         goto yyabortlab
+#define YYERROR         goto yyerrorlab
+#define YYNOMEM         goto yyexhaustedlab
 
-/* YY_LOCATION_PRINT -- Print the location on the stream.
-   This macro was not mandated originally: define only if we know
-   we won't break user code: when these are the locations we know.  */
-
-#ifndef YY_LOCATION_PRINT
-# if defined YYLTYPE_IS_TRIVIAL && YYLTYPE_IS_TRIVIAL
-#  define YY_LOCATION_PRINT(File, Loc)			\
-     fprintf (File, "%d.%d-%d.%d",			\
-	      (Loc).first_line, (Loc).first_column,	\
-	      (Loc).last_line,  (Loc).last_column)
-# else
-#  define YY_LOCATION_PRINT(File, Loc) ((void) 0)
-# endif
-#endif
 
+#define YYRECOVERING()  (!!yyerrstatus)
 
-/* YYLEX -- calling `yylex' with the right arguments.  */
+#define YYBACKUP(Token, Value)                                    \
+  do                                                              \
+    if (yychar == YYEMPTY)                                        \
+      {                                                           \
+        yychar = (Token);                                         \
+        yylval = (Value);                                         \
+        YYPOPSTACK (yylen);                                       \
+        yystate = *yyssp;                                         \
+        goto yybackup;                                            \
+      }                                                           \
+    else                                                          \
+      {                                                           \
+        yyerror (scanner, myStatement, YY_("syntax error: cannot back up")); \
+        YYERROR;                                                  \
+      }                                                           \
+  while (0)
+
+/* Backward compatibility with an undocumented macro.
+   Use YYerror or YYUNDEF. */
+#define YYERRCODE YYUNDEF
 
-#ifdef YYLEX_PARAM
-# define YYLEX yylex (&yylval, YYLEX_PARAM)
-#else
-# define YYLEX yylex (&yylval, scanner)
-#endif
 
 /* Enable debugging if requested.  */
 #if YYDEBUG
@@ -737,86 +754,60 @@ while (YYID (0))
 #  define YYFPRINTF fprintf
 # endif
 
-# define YYDPRINTF(Args)			\
-do {						\
-  if (yydebug)					\
-    YYFPRINTF Args;				\
-} while (YYID (0))
-
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)			  \
-do {									  \
-  if (yydebug)								  \
-    {									  \
-      YYFPRINTF (stderr, "%s ", Title);					  \
-      yy_symbol_print (stderr,						  \
-		  Type, Value, scanner, myStatement); \
-      YYFPRINTF (stderr, "\n");						  \
-    }									  \
-} while (YYID (0))
-
-
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
-
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_value_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, void *scanner, struct SQLStatement **myStatement)
-#else
+# define YYDPRINTF(Args)                        \
+do {                                            \
+  if (yydebug)                                  \
+    YYFPRINTF Args;                             \
+} while (0)
+
+
+
+
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)                    \
+do {                                                                      \
+  if (yydebug)                                                            \
+    {                                                                     \
+      YYFPRINTF (stderr, "%s ", Title);                                   \
+      yy_symbol_print (stderr,                                            \
+                  Kind, Value, scanner, myStatement); \
+      YYFPRINTF (stderr, "\n");                                           \
+    }                                                                     \
+} while (0)
+
+
+/*-----------------------------------.
+| Print this symbol's value on YYO.  |
+`-----------------------------------*/
+
 static void
-yy_symbol_value_print (yyoutput, yytype, yyvaluep, scanner, myStatement)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    void *scanner;
-    struct SQLStatement **myStatement;
-#endif
+yy_symbol_value_print (FILE *yyo,
+                       yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, void *scanner, struct SQLStatement **myStatement)
 {
+  FILE *yyoutput = yyo;
+  YY_USE (yyoutput);
+  YY_USE (scanner);
+  YY_USE (myStatement);
   if (!yyvaluep)
     return;
-  YYUSE (scanner);
-  YYUSE (myStatement);
-# ifdef YYPRINT
-  if (yytype < YYNTOKENS)
-    YYPRINT (yyoutput, yytoknum[yytype], *yyvaluep);
-# else
-  YYUSE (yyoutput);
-# endif
-  switch (yytype)
-    {
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
 
 
-/*--------------------------------.
-| Print this symbol on YYOUTPUT.  |
-`--------------------------------*/
+/*---------------------------.
+| Print this symbol on YYO.  |
+`---------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static void
-yy_symbol_print (FILE *yyoutput, int yytype, YYSTYPE const * const yyvaluep, void *scanner, struct SQLStatement **myStatement)
-#else
 static void
-yy_symbol_print (yyoutput, yytype, yyvaluep, scanner, myStatement)
-    FILE *yyoutput;
-    int yytype;
-    YYSTYPE const * const yyvaluep;
-    void *scanner;
-    struct SQLStatement **myStatement;
-#endif
+yy_symbol_print (FILE *yyo,
+                 yysymbol_kind_t yykind, YYSTYPE const * const yyvaluep, void *scanner, struct SQLStatement **myStatement)
 {
-  if (yytype < YYNTOKENS)
-    YYFPRINTF (yyoutput, "token %s (", yytname[yytype]);
-  else
-    YYFPRINTF (yyoutput, "nterm %s (", yytname[yytype]);
+  YYFPRINTF (yyo, "%s %s (",
+             yykind < YYNTOKENS ? "token" : "nterm", yysymbol_name (yykind));
 
-  yy_symbol_value_print (yyoutput, yytype, yyvaluep, scanner, myStatement);
-  YYFPRINTF (yyoutput, ")");
+  yy_symbol_value_print (yyo, yykind, yyvaluep, scanner, myStatement);
+  YYFPRINTF (yyo, ")");
 }
 
 /*------------------------------------------------------------------.
@@ -824,82 +815,68 @@ yy_symbol_print (yyoutput, yytype, yyvaluep, scanner, myStatement)
 | TOP (included).                                                   |
 `------------------------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_stack_print (yytype_int16 *bottom, yytype_int16 *top)
-#else
-static void
-yy_stack_print (bottom, top)
-    yytype_int16 *bottom;
-    yytype_int16 *top;
-#endif
+yy_stack_print (yy_state_t *yybottom, yy_state_t *yytop)
 {
   YYFPRINTF (stderr, "Stack now");
-  for (; bottom <= top; ++bottom)
-    YYFPRINTF (stderr, " %d", *bottom);
+  for (; yybottom <= yytop; yybottom++)
+    {
+      int yybot = *yybottom;
+      YYFPRINTF (stderr, " %d", yybot);
+    }
   YYFPRINTF (stderr, "\n");
 }
 
-# define YY_STACK_PRINT(Bottom, Top)				\
-do {								\
-  if (yydebug)							\
-    yy_stack_print ((Bottom), (Top));				\
-} while (YYID (0))
+# define YY_STACK_PRINT(Bottom, Top)                            \
+do {                                                            \
+  if (yydebug)                                                  \
+    yy_stack_print ((Bottom), (Top));                           \
+} while (0)
 
 
 /*------------------------------------------------.
 | Report that the YYRULE is going to be reduced.  |
 `------------------------------------------------*/
 
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yy_reduce_print (YYSTYPE *yyvsp, int yyrule, void *scanner, struct SQLStatement **myStatement)
-#else
-static void
-yy_reduce_print (yyvsp, yyrule, scanner, myStatement)
-    YYSTYPE *yyvsp;
-    int yyrule;
-    void *scanner;
-    struct SQLStatement **myStatement;
-#endif
+yy_reduce_print (yy_state_t *yyssp, YYSTYPE *yyvsp,
+                 int yyrule, void *scanner, struct SQLStatement **myStatement)
 {
+  int yylno = yyrline[yyrule];
   int yynrhs = yyr2[yyrule];
   int yyi;
-  unsigned long int yylno = yyrline[yyrule];
-  YYFPRINTF (stderr, "Reducing stack by rule %d (line %lu):\n",
-	     yyrule - 1, yylno);
+  YYFPRINTF (stderr, "Reducing stack by rule %d (line %d):\n",
+             yyrule - 1, yylno);
   /* The symbols being reduced.  */
   for (yyi = 0; yyi < yynrhs; yyi++)
     {
-      fprintf (stderr, "   $%d = ", yyi + 1);
-      yy_symbol_print (stderr, yyrhs[yyprhs[yyrule] + yyi],
-		       &(yyvsp[(yyi + 1) - (yynrhs)])
-		       		       , scanner, myStatement);
-      fprintf (stderr, "\n");
+      YYFPRINTF (stderr, "   $%d = ", yyi + 1);
+      yy_symbol_print (stderr,
+                       YY_ACCESSING_SYMBOL (+yyssp[yyi + 1 - yynrhs]),
+                       &yyvsp[(yyi + 1) - (yynrhs)], scanner, myStatement);
+      YYFPRINTF (stderr, "\n");
     }
 }
 
-# define YY_REDUCE_PRINT(Rule)		\
-do {					\
-  if (yydebug)				\
-    yy_reduce_print (yyvsp, Rule, scanner, myStatement); \
-} while (YYID (0))
+# define YY_REDUCE_PRINT(Rule)          \
+do {                                    \
+  if (yydebug)                          \
+    yy_reduce_print (yyssp, yyvsp, Rule, scanner, myStatement); \
+} while (0)
 
 /* Nonzero means print parse trace.  It is left uninitialized so that
    multiple parsers can coexist.  */
 int yydebug;
 #else /* !YYDEBUG */
-# define YYDPRINTF(Args)
-# define YY_SYMBOL_PRINT(Title, Type, Value, Location)
+# define YYDPRINTF(Args) ((void) 0)
+# define YY_SYMBOL_PRINT(Title, Kind, Value, Location)
 # define YY_STACK_PRINT(Bottom, Top)
 # define YY_REDUCE_PRINT(Rule)
 #endif /* !YYDEBUG */
 
 
 /* YYINITDEPTH -- initial size of the parser's stacks.  */
-#ifndef	YYINITDEPTH
+#ifndef YYINITDEPTH
 # define YYINITDEPTH 200
 #endif
 
@@ -914,270 +891,30 @@ int yydebug;
 # define YYMAXDEPTH 10000
 #endif
 
-
-
-#if YYERROR_VERBOSE
-
-# ifndef yystrlen
-#  if defined __GLIBC__ && defined _STRING_H
-#   define yystrlen strlen
-#  else
-/* Return the length of YYSTR.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static YYSIZE_T
-yystrlen (const char *yystr)
-#else
-static YYSIZE_T
-yystrlen (yystr)
-    const char *yystr;
-#endif
-{
-  YYSIZE_T yylen;
-  for (yylen = 0; yystr[yylen]; yylen++)
-    continue;
-  return yylen;
-}
-#  endif
-# endif
-
-# ifndef yystpcpy
-#  if defined __GLIBC__ && defined _STRING_H && defined _GNU_SOURCE
-#   define yystpcpy stpcpy
-#  else
-/* Copy YYSRC to YYDEST, returning the address of the terminating '\0' in
-   YYDEST.  */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-static char *
-yystpcpy (char *yydest, const char *yysrc)
-#else
-static char *
-yystpcpy (yydest, yysrc)
-    char *yydest;
-    const char *yysrc;
-#endif
-{
-  char *yyd = yydest;
-  const char *yys = yysrc;
-
-  while ((*yyd++ = *yys++) != '\0')
-    continue;
-
-  return yyd - 1;
-}
-#  endif
-# endif
-
-# ifndef yytnamerr
-/* Copy to YYRES the contents of YYSTR after stripping away unnecessary
-   quotes and backslashes, so that it's suitable for yyerror.  The
-   heuristic is that double-quoting is unnecessary unless the string
-   contains an apostrophe, a comma, or backslash (other than
-   backslash-backslash).  YYSTR is taken from yytname.  If YYRES is
-   null, do not copy; instead, return the length of what the result
-   would have been.  */
-static YYSIZE_T
-yytnamerr (char *yyres, const char *yystr)
-{
-  if (*yystr == '"')
-    {
-      YYSIZE_T yyn = 0;
-      char const *yyp = yystr;
-
-      for (;;)
-	switch (*++yyp)
-	  {
-	  case '\'':
-	  case ',':
-	    goto do_not_strip_quotes;
-
-	  case '\\':
-	    if (*++yyp != '\\')
-	      goto do_not_strip_quotes;
-	    /* Fall through.  */
-	  default:
-	    if (yyres)
-	      yyres[yyn] = *yyp;
-	    yyn++;
-	    break;
-
-	  case '"':
-	    if (yyres)
-	      yyres[yyn] = '\0';
-	    return yyn;
-	  }
-    do_not_strip_quotes: ;
-    }
 
-  if (! yyres)
-    return yystrlen (yystr);
 
-  return yystpcpy (yyres, yystr) - yyres;
-}
-# endif
 
-/* Copy into YYRESULT an error message about the unexpected token
-   YYCHAR while in state YYSTATE.  Return the number of bytes copied,
-   including the terminating null byte.  If YYRESULT is null, do not
-   copy anything; just return the number of bytes that would be
-   copied.  As a special case, return 0 if an ordinary "syntax error"
-   message will do.  Return YYSIZE_MAXIMUM if overflow occurs during
-   size calculation.  */
-static YYSIZE_T
-yysyntax_error (char *yyresult, int yystate, int yychar)
-{
-  int yyn = yypact[yystate];
 
-  if (! (YYPACT_NINF < yyn && yyn <= YYLAST))
-    return 0;
-  else
-    {
-      int yytype = YYTRANSLATE (yychar);
-      YYSIZE_T yysize0 = yytnamerr (0, yytname[yytype]);
-      YYSIZE_T yysize = yysize0;
-      YYSIZE_T yysize1;
-      int yysize_overflow = 0;
-      enum { YYERROR_VERBOSE_ARGS_MAXIMUM = 5 };
-      char const *yyarg[YYERROR_VERBOSE_ARGS_MAXIMUM];
-      int yyx;
-
-# if 0
-      /* This is so xgettext sees the translatable formats that are
-	 constructed on the fly.  */
-      YY_("syntax error, unexpected %s");
-      YY_("syntax error, unexpected %s, expecting %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s");
-      YY_("syntax error, unexpected %s, expecting %s or %s or %s or %s");
-# endif
-      char *yyfmt;
-      char const *yyf;
-      static char const yyunexpected[] = "syntax error, unexpected %s";
-      static char const yyexpecting[] = ", expecting %s";
-      static char const yyor[] = " or %s";
-      char yyformat[sizeof yyunexpected
-		    + sizeof yyexpecting - 1
-		    + ((YYERROR_VERBOSE_ARGS_MAXIMUM - 2)
-		       * (sizeof yyor - 1))];
-      char const *yyprefix = yyexpecting;
-
-      /* Start YYX at -YYN if negative to avoid negative indexes in
-	 YYCHECK.  */
-      int yyxbegin = yyn < 0 ? -yyn : 0;
-
-      /* Stay within bounds of both yycheck and yytname.  */
-      int yychecklim = YYLAST - yyn + 1;
-      int yyxend = yychecklim < YYNTOKENS ? yychecklim : YYNTOKENS;
-      int yycount = 1;
-
-      yyarg[0] = yytname[yytype];
-      yyfmt = yystpcpy (yyformat, yyunexpected);
-
-      for (yyx = yyxbegin; yyx < yyxend; ++yyx)
-	if (yycheck[yyx + yyn] == yyx && yyx != YYTERROR)
-	  {
-	    if (yycount == YYERROR_VERBOSE_ARGS_MAXIMUM)
-	      {
-		yycount = 1;
-		yysize = yysize0;
-		yyformat[sizeof yyunexpected - 1] = '\0';
-		break;
-	      }
-	    yyarg[yycount++] = yytname[yyx];
-	    yysize1 = yysize + yytnamerr (0, yytname[yyx]);
-	    yysize_overflow |= (yysize1 < yysize);
-	    yysize = yysize1;
-	    yyfmt = yystpcpy (yyfmt, yyprefix);
-	    yyprefix = yyor;
-	  }
-
-      yyf = YY_(yyformat);
-      yysize1 = yysize + yystrlen (yyf);
-      yysize_overflow |= (yysize1 < yysize);
-      yysize = yysize1;
-
-      if (yysize_overflow)
-	return YYSIZE_MAXIMUM;
-
-      if (yyresult)
-	{
-	  /* Avoid sprintf, as that infringes on the user's name space.
-	     Don't have undefined behavior even if the translation
-	     produced a string with the wrong number of "%s"s.  */
-	  char *yyp = yyresult;
-	  int yyi = 0;
-	  while ((*yyp = *yyf) != '\0')
-	    {
-	      if (*yyp == '%' && yyf[1] == 's' && yyi < yycount)
-		{
-		  yyp += yytnamerr (yyp, yyarg[yyi++]);
-		  yyf += 2;
-		}
-	      else
-		{
-		  yyp++;
-		  yyf++;
-		}
-	    }
-	}
-      return yysize;
-    }
-}
-#endif /* YYERROR_VERBOSE */
-
 
 /*-----------------------------------------------.
 | Release the memory associated to this symbol.  |
 `-----------------------------------------------*/
 
-/*ARGSUSED*/
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 static void
-yydestruct (const char *yymsg, int yytype, YYSTYPE *yyvaluep, void *scanner, struct SQLStatement **myStatement)
-#else
-static void
-yydestruct (yymsg, yytype, yyvaluep, scanner, myStatement)
-    const char *yymsg;
-    int yytype;
-    YYSTYPE *yyvaluep;
-    void *scanner;
-    struct SQLStatement **myStatement;
-#endif
+yydestruct (const char *yymsg,
+            yysymbol_kind_t yykind, YYSTYPE *yyvaluep, void *scanner, struct SQLStatement **myStatement)
 {
-  YYUSE (yyvaluep);
-  YYUSE (scanner);
-  YYUSE (myStatement);
-
+  YY_USE (yyvaluep);
+  YY_USE (scanner);
+  YY_USE (myStatement);
   if (!yymsg)
     yymsg = "Deleting";
-  YY_SYMBOL_PRINT (yymsg, yytype, yyvaluep, yylocationp);
-
-  switch (yytype)
-    {
+  YY_SYMBOL_PRINT (yymsg, yykind, yyvaluep, yylocationp);
 
-      default:
-	break;
-    }
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
+  YY_USE (yykind);
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 }
-
-
-/* Prevent warnings from -Wmissing-prototypes.  */
-
-#ifdef YYPARSE_PARAM
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *YYPARSE_PARAM);
-#else
-int yyparse ();
-#endif
-#else /* ! YYPARSE_PARAM */
-#if defined __STDC__ || defined __cplusplus
-int yyparse (void *scanner, struct SQLStatement **myStatement);
-#else
-int yyparse ();
-#endif
-#endif /* ! YYPARSE_PARAM */
 
 
 
@@ -1188,209 +925,193 @@ int yyparse ();
 | yyparse.  |
 `----------*/
 
-#ifdef YYPARSE_PARAM
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
-int
-yyparse (void *YYPARSE_PARAM)
-#else
-int
-yyparse (YYPARSE_PARAM)
-    void *YYPARSE_PARAM;
-#endif
-#else /* ! YYPARSE_PARAM */
-#if (defined __STDC__ || defined __C99__FUNC__ \
-     || defined __cplusplus || defined _MSC_VER)
 int
 yyparse (void *scanner, struct SQLStatement **myStatement)
-#else
-int
-yyparse (scanner, myStatement)
-    void *scanner;
-    struct SQLStatement **myStatement;
-#endif
-#endif
 {
-  /* The look-ahead symbol.  */
+/* Lookahead token kind.  */
 int yychar;
 
-/* The semantic value of the look-ahead symbol.  */
-YYSTYPE yylval;
-
-/* Number of syntax errors so far.  */
-int yynerrs;
-
-  int yystate;
-  int yyn;
-  int yyresult;
-  /* Number of tokens to shift before error messages enabled.  */
-  int yyerrstatus;
-  /* Look-ahead token as an internal (translated) token number.  */
-  int yytoken = 0;
-#if YYERROR_VERBOSE
-  /* Buffer for error messages, and its allocated size.  */
-  char yymsgbuf[128];
-  char *yymsg = yymsgbuf;
-  YYSIZE_T yymsg_alloc = sizeof yymsgbuf;
-#endif
-
-  /* Three stacks and their tools:
-     `yyss': related to states,
-     `yyvs': related to semantic values,
-     `yyls': related to locations.
 
-     Refer to the stacks thru separate pointers, to allow yyoverflow
-     to reallocate them elsewhere.  */
+/* The semantic value of the lookahead symbol.  */
+/* Default value used for initialization, for pacifying older GCCs
+   or non-GCC compilers.  */
+YY_INITIAL_VALUE (static YYSTYPE yyval_default;)
+YYSTYPE yylval YY_INITIAL_VALUE (= yyval_default);
 
-  /* The state stack.  */
-  yytype_int16 yyssa[YYINITDEPTH];
-  yytype_int16 *yyss = yyssa;
-  yytype_int16 *yyssp;
+    /* Number of syntax errors so far.  */
+    int yynerrs = 0;
 
-  /* The semantic value stack.  */
-  YYSTYPE yyvsa[YYINITDEPTH];
-  YYSTYPE *yyvs = yyvsa;
-  YYSTYPE *yyvsp;
+    yy_state_fast_t yystate = 0;
+    /* Number of tokens to shift before error messages enabled.  */
+    int yyerrstatus = 0;
 
+    /* Refer to the stacks through separate pointers, to allow yyoverflow
+       to reallocate them elsewhere.  */
 
+    /* Their size.  */
+    YYPTRDIFF_T yystacksize = YYINITDEPTH;
 
-#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+    /* The state stack: array, bottom, top.  */
+    yy_state_t yyssa[YYINITDEPTH];
+    yy_state_t *yyss = yyssa;
+    yy_state_t *yyssp = yyss;
 
-  YYSIZE_T yystacksize = YYINITDEPTH;
+    /* The semantic value stack: array, bottom, top.  */
+    YYSTYPE yyvsa[YYINITDEPTH];
+    YYSTYPE *yyvs = yyvsa;
+    YYSTYPE *yyvsp = yyvs;
 
+  int yyn;
+  /* The return value of yyparse.  */
+  int yyresult;
+  /* Lookahead symbol kind.  */
+  yysymbol_kind_t yytoken = YYSYMBOL_YYEMPTY;
   /* The variables used to return semantic value and location from the
      action routines.  */
   YYSTYPE yyval;
 
 
+
+#define YYPOPSTACK(N)   (yyvsp -= (N), yyssp -= (N))
+
   /* The number of symbols on the RHS of the reduced rule.
      Keep to zero when no symbol should be popped.  */
   int yylen = 0;
 
   YYDPRINTF ((stderr, "Starting parse\n"));
 
-  yystate = 0;
-  yyerrstatus = 0;
-  yynerrs = 0;
-  yychar = YYEMPTY;		/* Cause a token to be read.  */
-
-  /* Initialize stack pointers.
-     Waste one element of value and location stack
-     so that they stay on the same level as the state stack.
-     The wasted elements are never initialized.  */
-
-  yyssp = yyss;
-  yyvsp = yyvs;
+  yychar = YYEMPTY; /* Cause a token to be read.  */
 
   goto yysetstate;
 
+
 /*------------------------------------------------------------.
-| yynewstate -- Push a new state, which is found in yystate.  |
+| yynewstate -- push a new state, which is found in yystate.  |
 `------------------------------------------------------------*/
- yynewstate:
+yynewstate:
   /* In all cases, when you get here, the value and location stacks
      have just been pushed.  So pushing a state here evens the stacks.  */
   yyssp++;
 
- yysetstate:
-  *yyssp = yystate;
+
+/*--------------------------------------------------------------------.
+| yysetstate -- set current state (the top of the stack) to yystate.  |
+`--------------------------------------------------------------------*/
+yysetstate:
+  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+  YY_ASSERT (0 <= yystate && yystate < YYNSTATES);
+  YY_IGNORE_USELESS_CAST_BEGIN
+  *yyssp = YY_CAST (yy_state_t, yystate);
+  YY_IGNORE_USELESS_CAST_END
+  YY_STACK_PRINT (yyss, yyssp);
 
   if (yyss + yystacksize - 1 <= yyssp)
+#if !defined yyoverflow && !defined YYSTACK_RELOCATE
+    YYNOMEM;
+#else
     {
       /* Get the current used size of the three stacks, in elements.  */
-      YYSIZE_T yysize = yyssp - yyss + 1;
+      YYPTRDIFF_T yysize = yyssp - yyss + 1;
 
-#ifdef yyoverflow
+# if defined yyoverflow
       {
-	/* Give user a chance to reallocate the stack.  Use copies of
-	   these so that the &'s don't force the real ones into
-	   memory.  */
-	YYSTYPE *yyvs1 = yyvs;
-	yytype_int16 *yyss1 = yyss;
-
-
-	/* Each stack pointer address is followed by the size of the
-	   data in use in that stack, in bytes.  This used to be a
-	   conditional around just the two extra args, but that might
-	   be undefined if yyoverflow is a macro.  */
-	yyoverflow (YY_("memory exhausted"),
-		    &yyss1, yysize * sizeof (*yyssp),
-		    &yyvs1, yysize * sizeof (*yyvsp),
-
-		    &yystacksize);
-
-	yyss = yyss1;
-	yyvs = yyvs1;
+        /* Give user a chance to reallocate the stack.  Use copies of
+           these so that the &'s don't force the real ones into
+           memory.  */
+        yy_state_t *yyss1 = yyss;
+        YYSTYPE *yyvs1 = yyvs;
+
+        /* Each stack pointer address is followed by the size of the
+           data in use in that stack, in bytes.  This used to be a
+           conditional around just the two extra args, but that might
+           be undefined if yyoverflow is a macro.  */
+        yyoverflow (YY_("memory exhausted"),
+                    &yyss1, yysize * YYSIZEOF (*yyssp),
+                    &yyvs1, yysize * YYSIZEOF (*yyvsp),
+                    &yystacksize);
+        yyss = yyss1;
+        yyvs = yyvs1;
       }
-#else /* no yyoverflow */
-# ifndef YYSTACK_RELOCATE
-      goto yyexhaustedlab;
-# else
+# else /* defined YYSTACK_RELOCATE */
       /* Extend the stack our own way.  */
       if (YYMAXDEPTH <= yystacksize)
-	goto yyexhaustedlab;
+        YYNOMEM;
       yystacksize *= 2;
       if (YYMAXDEPTH < yystacksize)
-	yystacksize = YYMAXDEPTH;
+        yystacksize = YYMAXDEPTH;
 
       {
-	yytype_int16 *yyss1 = yyss;
-	union yyalloc *yyptr =
-	  (union yyalloc *) YYSTACK_ALLOC (YYSTACK_BYTES (yystacksize));
-	if (! yyptr)
-	  goto yyexhaustedlab;
-	YYSTACK_RELOCATE (yyss);
-	YYSTACK_RELOCATE (yyvs);
-
+        yy_state_t *yyss1 = yyss;
+        union yyalloc *yyptr =
+          YY_CAST (union yyalloc *,
+                   YYSTACK_ALLOC (YY_CAST (YYSIZE_T, YYSTACK_BYTES (yystacksize))));
+        if (! yyptr)
+          YYNOMEM;
+        YYSTACK_RELOCATE (yyss_alloc, yyss);
+        YYSTACK_RELOCATE (yyvs_alloc, yyvs);
 #  undef YYSTACK_RELOCATE
-	if (yyss1 != yyssa)
-	  YYSTACK_FREE (yyss1);
+        if (yyss1 != yyssa)
+          YYSTACK_FREE (yyss1);
       }
 # endif
-#endif /* no yyoverflow */
 
       yyssp = yyss + yysize - 1;
       yyvsp = yyvs + yysize - 1;
 
-
-      YYDPRINTF ((stderr, "Stack size increased to %lu\n",
-		  (unsigned long int) yystacksize));
+      YY_IGNORE_USELESS_CAST_BEGIN
+      YYDPRINTF ((stderr, "Stack size increased to %ld\n",
+                  YY_CAST (long, yystacksize)));
+      YY_IGNORE_USELESS_CAST_END
 
       if (yyss + yystacksize - 1 <= yyssp)
-	YYABORT;
+        YYABORT;
     }
+#endif /* !defined yyoverflow && !defined YYSTACK_RELOCATE */
 
-  YYDPRINTF ((stderr, "Entering state %d\n", yystate));
+
+  if (yystate == YYFINAL)
+    YYACCEPT;
 
   goto yybackup;
 
+
 /*-----------.
 | yybackup.  |
 `-----------*/
 yybackup:
-
   /* Do appropriate processing given the current state.  Read a
-     look-ahead token if we need one and don't already have one.  */
+     lookahead token if we need one and don't already have one.  */
 
-  /* First try to decide what to do without reference to look-ahead token.  */
+  /* First try to decide what to do without reference to lookahead token.  */
   yyn = yypact[yystate];
-  if (yyn == YYPACT_NINF)
+  if (yypact_value_is_default (yyn))
     goto yydefault;
 
-  /* Not known => get a look-ahead token if don't already have one.  */
+  /* Not known => get a lookahead token if don't already have one.  */
 
-  /* YYCHAR is either YYEMPTY or YYEOF or a valid look-ahead symbol.  */
+  /* YYCHAR is either empty, or end-of-input, or a valid lookahead.  */
   if (yychar == YYEMPTY)
     {
-      YYDPRINTF ((stderr, "Reading a token: "));
-      yychar = YYLEX;
+      YYDPRINTF ((stderr, "Reading a token\n"));
+      yychar = yylex (&yylval, scanner);
     }
 
   if (yychar <= YYEOF)
     {
-      yychar = yytoken = YYEOF;
+      yychar = YYEOF;
+      yytoken = YYSYMBOL_YYEOF;
       YYDPRINTF ((stderr, "Now at end of input.\n"));
     }
+  else if (yychar == YYerror)
+    {
+      /* The scanner already issued an error message, process directly
+         to error recovery.  But do not keep the error token as
+         lookahead, it is too special and may lead us to an endless
+         loop in error recovery. */
+      yychar = YYUNDEF;
+      yytoken = YYSYMBOL_YYerror;
+      goto yyerrlab1;
+    }
   else
     {
       yytoken = YYTRANSLATE (yychar);
@@ -1405,30 +1126,26 @@ yybackup:
   yyn = yytable[yyn];
   if (yyn <= 0)
     {
-      if (yyn == 0 || yyn == YYTABLE_NINF)
-	goto yyerrlab;
+      if (yytable_value_is_error (yyn))
+        goto yyerrlab;
       yyn = -yyn;
       goto yyreduce;
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
   /* Count tokens shifted since error; after three, turn off error
      status.  */
   if (yyerrstatus)
     yyerrstatus--;
 
-  /* Shift the look-ahead token.  */
+  /* Shift the lookahead token.  */
   YY_SYMBOL_PRINT ("Shifting", yytoken, &yylval, &yylloc);
-
-  /* Discard the shifted token unless it is eof.  */
-  if (yychar != YYEOF)
-    yychar = YYEMPTY;
-
   yystate = yyn;
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
+  /* Discard the shifted token.  */
+  yychar = YYEMPTY;
   goto yynewstate;
 
 
@@ -1443,14 +1160,14 @@ yydefault:
 
 
 /*-----------------------------.
-| yyreduce -- Do a reduction.  |
+| yyreduce -- do a reduction.  |
 `-----------------------------*/
 yyreduce:
   /* yyn is the number of a rule to reduce with.  */
   yylen = yyr2[yyn];
 
   /* If YYLEN is nonzero, implement the default value of the action:
-     `$$ = $1'.
+     '$$ = $1'.
 
      Otherwise, the following line sets YYVAL to garbage.
      This behavior is undocumented and Bison
@@ -1463,391 +1180,415 @@ yyreduce:
   YY_REDUCE_PRINT (yyn);
   switch (yyn)
     {
-        case 2:
-#line 82 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myStatement) = makeSelectQuery ((yyvsp[(1) - (1)].mySelectQuery));
+  case 2: /* SQLStatement: SelectQuery  */
+#line 82 "Parser.y"
+{
+	(yyval.myStatement) = makeSelectQuery ((yyvsp[0].mySelectQuery));
 	*myStatement = (yyval.myStatement);
-;}
+}
+#line 1190 "Parser.c"
     break;
 
-  case 3:
-#line 88 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myStatement) = makeCreateTable ((yyvsp[(1) - (1)].myCreateTable));
+  case 3: /* SQLStatement: CreateTable  */
+#line 88 "Parser.y"
+{
+	(yyval.myStatement) = makeCreateTable ((yyvsp[0].myCreateTable));
 	*myStatement = (yyval.myStatement);
-;}
+}
+#line 1199 "Parser.c"
     break;
 
-  case 4:
-#line 97 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myCreateTable) = makeTableRegular ((yyvsp[(3) - (6)].myChar), (yyvsp[(5) - (6)].myAttList));	
-;}
+  case 4: /* CreateTable: CREATE TABLE IDENTIFIER '(' AttList ')'  */
+#line 97 "Parser.y"
+{
+	(yyval.myCreateTable) = makeTableRegular ((yyvsp[-3].myChar), (yyvsp[-1].myAttList));	
+}
+#line 1207 "Parser.c"
     break;
 
-  case 5:
-#line 103 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myCreateTable) = makeTableBPlusTree ((yyvsp[(3) - (10)].myChar), (yyvsp[(5) - (10)].myAttList), (yyvsp[(10) - (10)].myChar));
-;}
+  case 5: /* CreateTable: CREATE TABLE IDENTIFIER '(' AttList ')' AS BPLUSTREE ON IDENTIFIER  */
+#line 103 "Parser.y"
+{
+	(yyval.myCreateTable) = makeTableBPlusTree ((yyvsp[-7].myChar), (yyvsp[-5].myAttList), (yyvsp[0].myChar));
+}
+#line 1215 "Parser.c"
     break;
 
-  case 6:
-#line 108 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myAttList) = appendAttList ((yyvsp[(1) - (3)].myAttList), (yyvsp[(3) - (3)].myAttList));
-;}
+  case 6: /* CreateTable: CREATE TABLE IDENTIFIER '(' AttList ')' AS IDENTIFIER  */
+#line 109 "Parser.y"
+{
+	(yyval.myCreateTable) = makeTableOfType ((yyvsp[-5].myChar), (yyvsp[-3].myAttList), (yyvsp[0].myChar));
+}
+#line 1223 "Parser.c"
     break;
 
-  case 7:
-#line 113 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myAttList) = (yyvsp[(1) - (1)].myAttList);
-;}
+  case 7: /* AttList: AttList ',' Att  */
+#line 114 "Parser.y"
+{
+	(yyval.myAttList) = appendAttList ((yyvsp[-2].myAttList), (yyvsp[0].myAttList));
+}
+#line 1231 "Parser.c"
     break;
 
-  case 8:
-#line 119 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myAttList) = makeAttList ((yyvsp[(1) - (2)].myChar), INT);
-;}
+  case 8: /* AttList: Att  */
+#line 119 "Parser.y"
+{
+	(yyval.myAttList) = (yyvsp[0].myAttList);
+}
+#line 1239 "Parser.c"
     break;
 
-  case 9:
-#line 124 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myAttList) = makeAttList ((yyvsp[(1) - (2)].myChar), DOUBLE);
-;}
+  case 9: /* Att: IDENTIFIER INT  */
+#line 125 "Parser.y"
+{
+	(yyval.myAttList) = makeAttList ((yyvsp[-1].myChar), INT);
+}
+#line 1247 "Parser.c"
     break;
 
-  case 10:
-#line 129 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myAttList) = makeAttList ((yyvsp[(1) - (2)].myChar), STRING);
-;}
+  case 10: /* Att: IDENTIFIER DOUBLE  */
+#line 130 "Parser.y"
+{
+	(yyval.myAttList) = makeAttList ((yyvsp[-1].myChar), DOUBLE);
+}
+#line 1255 "Parser.c"
     break;
 
-  case 11:
-#line 134 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myAttList) = makeAttList ((yyvsp[(1) - (2)].myChar), BOOL);
-;}
+  case 11: /* Att: IDENTIFIER STRING  */
+#line 135 "Parser.y"
+{
+	(yyval.myAttList) = makeAttList ((yyvsp[-1].myChar), STRING);
+}
+#line 1263 "Parser.c"
     break;
 
-  case 12:
-#line 144 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.mySelectQuery) = makeQueryWithGroupBy ((yyvsp[(2) - (9)].allValues), (yyvsp[(4) - (9)].myFromList), (yyvsp[(6) - (9)].myCNF), (yyvsp[(9) - (9)].allValues));
-;}
+  case 12: /* Att: IDENTIFIER BOOL  */
+#line 140 "Parser.y"
+{
+	(yyval.myAttList) = makeAttList ((yyvsp[-1].myChar), BOOL);
+}
+#line 1271 "Parser.c"
     break;
 
-  case 13:
-#line 151 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.mySelectQuery) = makeQuery ((yyvsp[(2) - (6)].allValues), (yyvsp[(4) - (6)].myFromList), (yyvsp[(6) - (6)].myCNF));
-;}
+  case 13: /* SelectQuery: SELECT ValueList FROM FromList WHERE CNF GROUP BY ValueList  */
+#line 150 "Parser.y"
+{
+	(yyval.mySelectQuery) = makeQueryWithGroupBy ((yyvsp[-7].allValues), (yyvsp[-5].myFromList), (yyvsp[-3].myCNF), (yyvsp[0].allValues));
+}
+#line 1279 "Parser.c"
     break;
 
-  case 14:
-#line 157 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.mySelectQuery) = makeQueryNoWhere ((yyvsp[(2) - (4)].allValues), (yyvsp[(4) - (4)].myFromList));
-;}
+  case 14: /* SelectQuery: SELECT ValueList FROM FromList WHERE CNF  */
+#line 157 "Parser.y"
+{
+	(yyval.mySelectQuery) = makeQuery ((yyvsp[-4].allValues), (yyvsp[-2].myFromList), (yyvsp[0].myCNF));
+}
+#line 1287 "Parser.c"
     break;
 
-  case 15:
-#line 163 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myFromList) = appendFromList ((yyvsp[(5) - (5)].myFromList), (yyvsp[(1) - (5)].myChar), (yyvsp[(3) - (5)].myChar));
-;}
+  case 15: /* SelectQuery: SELECT ValueList FROM FromList  */
+#line 163 "Parser.y"
+{
+	(yyval.mySelectQuery) = makeQueryNoWhere ((yyvsp[-2].allValues), (yyvsp[0].myFromList));
+}
+#line 1295 "Parser.c"
     break;
 
-  case 16:
-#line 168 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myFromList) = makeFromList ((yyvsp[(1) - (3)].myChar), (yyvsp[(3) - (3)].myChar));
-;}
+  case 16: /* FromList: IDENTIFIER AS IDENTIFIER ',' FromList  */
+#line 169 "Parser.y"
+{
+	(yyval.myFromList) = appendFromList ((yyvsp[0].myFromList), (yyvsp[-4].myChar), (yyvsp[-2].myChar));
+}
+#line 1303 "Parser.c"
     break;
 
-  case 17:
-#line 174 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myCNF) = pushBackDisjunction ((yyvsp[(1) - (3)].myCNF), (yyvsp[(3) - (3)].myValue));	
-;}
+  case 17: /* FromList: IDENTIFIER AS IDENTIFIER  */
+#line 174 "Parser.y"
+{
+	(yyval.myFromList) = makeFromList ((yyvsp[-2].myChar), (yyvsp[0].myChar));
+}
+#line 1311 "Parser.c"
     break;
 
-  case 18:
-#line 179 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myCNF) = pushBackDisjunction ((yyvsp[(1) - (5)].myCNF), (yyvsp[(4) - (5)].myValue));	
-;}
+  case 18: /* CNF: CNF AND Disjunction  */
+#line 180 "Parser.y"
+{
+	(yyval.myCNF) = pushBackDisjunction ((yyvsp[-2].myCNF), (yyvsp[0].myValue));	
+}
+#line 1319 "Parser.c"
     break;
 
-  case 19:
-#line 184 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myCNF) = makeCNF ((yyvsp[(1) - (1)].myValue));
-;}
+  case 19: /* CNF: CNF AND '(' Disjunction ')'  */
+#line 185 "Parser.y"
+{
+	(yyval.myCNF) = pushBackDisjunction ((yyvsp[-4].myCNF), (yyvsp[-1].myValue));	
+}
+#line 1327 "Parser.c"
     break;
 
-  case 20:
-#line 189 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myCNF) = makeCNF ((yyvsp[(2) - (3)].myValue));
-;}
+  case 20: /* CNF: Disjunction  */
+#line 190 "Parser.y"
+{
+	(yyval.myCNF) = makeCNF ((yyvsp[0].myValue));
+}
+#line 1335 "Parser.c"
     break;
 
-  case 21:
-#line 195 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = orr ((yyvsp[(1) - (3)].myValue), (yyvsp[(3) - (3)].myValue));
-;}
+  case 21: /* CNF: '(' Disjunction ')'  */
+#line 195 "Parser.y"
+{
+	(yyval.myCNF) = makeCNF ((yyvsp[-1].myValue));
+}
+#line 1343 "Parser.c"
     break;
 
-  case 22:
-#line 200 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = (yyvsp[(1) - (1)].myValue);
-;}
+  case 22: /* Disjunction: Disjunction OR Comparison  */
+#line 201 "Parser.y"
+{
+	(yyval.myValue) = orr ((yyvsp[-2].myValue), (yyvsp[0].myValue));
+}
+#line 1351 "Parser.c"
     break;
 
-  case 23:
-#line 206 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = gt ((yyvsp[(1) - (3)].myValue), (yyvsp[(3) - (3)].myValue));
-;}
+  case 23: /* Disjunction: Comparison  */
+#line 206 "Parser.y"
+{
+	(yyval.myValue) = (yyvsp[0].myValue);
+}
+#line 1359 "Parser.c"
     break;
 
-  case 24:
-#line 211 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = lt ((yyvsp[(1) - (3)].myValue), (yyvsp[(3) - (3)].myValue));
-;}
+  case 24: /* Comparison: Value '>' Value  */
+#line 212 "Parser.y"
+{
+	(yyval.myValue) = gt ((yyvsp[-2].myValue), (yyvsp[0].myValue));
+}
+#line 1367 "Parser.c"
     break;
 
-  case 25:
-#line 216 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-        (yyval.myValue) = neq ((yyvsp[(1) - (4)].myValue), (yyvsp[(4) - (4)].myValue));
-;}
+  case 25: /* Comparison: Value '<' Value  */
+#line 217 "Parser.y"
+{
+	(yyval.myValue) = lt ((yyvsp[-2].myValue), (yyvsp[0].myValue));
+}
+#line 1375 "Parser.c"
     break;
 
-  case 26:
-#line 221 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = eq ((yyvsp[(1) - (3)].myValue), (yyvsp[(3) - (3)].myValue));
-;}
+  case 26: /* Comparison: Value '<' '>' Value  */
+#line 222 "Parser.y"
+{
+        (yyval.myValue) = neq ((yyvsp[-3].myValue), (yyvsp[0].myValue));
+}
+#line 1383 "Parser.c"
     break;
 
-  case 27:
-#line 226 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = nott ((yyvsp[(2) - (2)].myValue));
-;}
+  case 27: /* Comparison: Value '=' Value  */
+#line 227 "Parser.y"
+{
+	(yyval.myValue) = eq ((yyvsp[-2].myValue), (yyvsp[0].myValue));
+}
+#line 1391 "Parser.c"
     break;
 
-  case 28:
-#line 232 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.allValues) = pushBackValue ((yyvsp[(1) - (3)].allValues), (yyvsp[(3) - (3)].myValue));
-;}
+  case 28: /* Comparison: NOT Comparison  */
+#line 232 "Parser.y"
+{
+	(yyval.myValue) = nott ((yyvsp[0].myValue));
+}
+#line 1399 "Parser.c"
     break;
 
-  case 29:
-#line 237 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.allValues) = makeValueList ((yyvsp[(1) - (1)].myValue));
-;}
+  case 29: /* ValueList: ValueList ',' Value  */
+#line 238 "Parser.y"
+{
+	(yyval.allValues) = pushBackValue ((yyvsp[-2].allValues), (yyvsp[0].myValue));
+}
+#line 1407 "Parser.c"
     break;
 
-  case 30:
-#line 243 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = plus ((yyvsp[(1) - (3)].myValue), (yyvsp[(3) - (3)].myValue));
-;}
+  case 30: /* ValueList: Value  */
+#line 243 "Parser.y"
+{
+	(yyval.allValues) = makeValueList ((yyvsp[0].myValue));
+}
+#line 1415 "Parser.c"
     break;
 
-  case 31:
-#line 248 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = minus ((yyvsp[(1) - (3)].myValue), (yyvsp[(3) - (3)].myValue));
-;}
+  case 31: /* Value: MultExp '+' Value  */
+#line 249 "Parser.y"
+{
+	(yyval.myValue) = plus ((yyvsp[-2].myValue), (yyvsp[0].myValue));
+}
+#line 1423 "Parser.c"
     break;
 
-  case 32:
-#line 253 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = (yyvsp[(1) - (1)].myValue);
-;}
+  case 32: /* Value: MultExp '-' Value  */
+#line 254 "Parser.y"
+{
+	(yyval.myValue) = minus ((yyvsp[-2].myValue), (yyvsp[0].myValue));
+}
+#line 1431 "Parser.c"
     break;
 
-  case 33:
-#line 258 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = sum ((yyvsp[(3) - (4)].myValue));
-;}
+  case 33: /* Value: MultExp  */
+#line 259 "Parser.y"
+{
+	(yyval.myValue) = (yyvsp[0].myValue);
+}
+#line 1439 "Parser.c"
     break;
 
-  case 34:
-#line 263 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = avg ((yyvsp[(3) - (4)].myValue));
-;}
+  case 34: /* Value: SUM '(' Value ')'  */
+#line 264 "Parser.y"
+{
+	(yyval.myValue) = sum ((yyvsp[-1].myValue));
+}
+#line 1447 "Parser.c"
     break;
 
-  case 35:
-#line 269 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = times ((yyvsp[(1) - (3)].myValue), (yyvsp[(3) - (3)].myValue));
-;}
+  case 35: /* Value: AVG '(' Value ')'  */
+#line 269 "Parser.y"
+{
+	(yyval.myValue) = avg ((yyvsp[-1].myValue));
+}
+#line 1455 "Parser.c"
     break;
 
-  case 36:
-#line 274 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = divide ((yyvsp[(1) - (3)].myValue), (yyvsp[(3) - (3)].myValue));
-;}
+  case 36: /* MultExp: Literal '*' MultExp  */
+#line 275 "Parser.y"
+{
+	(yyval.myValue) = times ((yyvsp[-2].myValue), (yyvsp[0].myValue));
+}
+#line 1463 "Parser.c"
     break;
 
-  case 37:
-#line 279 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = (yyvsp[(1) - (1)].myValue);
-;}
+  case 37: /* MultExp: Literal '/' MultExp  */
+#line 280 "Parser.y"
+{
+	(yyval.myValue) = divide ((yyvsp[-2].myValue), (yyvsp[0].myValue));
+}
+#line 1471 "Parser.c"
     break;
 
-  case 38:
-#line 284 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = makeIdentifier ((yyvsp[(1) - (3)].myChar), (yyvsp[(3) - (3)].myChar));
-;}
+  case 38: /* MultExp: Literal  */
+#line 285 "Parser.y"
+{
+	(yyval.myValue) = (yyvsp[0].myValue);
+}
+#line 1479 "Parser.c"
     break;
 
-  case 39:
-#line 289 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = makeDouble ((yyvsp[(1) - (1)].myDouble));
-;}
+  case 39: /* Literal: IDENTIFIER '.' IDENTIFIER  */
+#line 290 "Parser.y"
+{
+	(yyval.myValue) = makeIdentifier ((yyvsp[-2].myChar), (yyvsp[0].myChar));
+}
+#line 1487 "Parser.c"
     break;
 
-  case 40:
-#line 294 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = makeString ((yyvsp[(1) - (1)].myChar));	
-;}
+  case 40: /* Literal: DBL  */
+#line 295 "Parser.y"
+{
+	(yyval.myValue) = makeDouble ((yyvsp[0].myDouble));
+}
+#line 1495 "Parser.c"
     break;
 
-  case 41:
-#line 299 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = makeInt ((yyvsp[(1) - (1)].myInt));
-;}
+  case 41: /* Literal: STR  */
+#line 300 "Parser.y"
+{
+	(yyval.myValue) = makeString ((yyvsp[0].myChar));	
+}
+#line 1503 "Parser.c"
     break;
 
-  case 42:
-#line 304 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
-    {
-	(yyval.myValue) = (yyvsp[(2) - (3)].myValue);
-;}
+  case 42: /* Literal: INTEGER  */
+#line 305 "Parser.y"
+{
+	(yyval.myValue) = makeInt ((yyvsp[0].myInt));
+}
+#line 1511 "Parser.c"
+    break;
+
+  case 43: /* Literal: '(' Value ')'  */
+#line 310 "Parser.y"
+{
+	(yyval.myValue) = (yyvsp[-1].myValue);
+}
+#line 1519 "Parser.c"
     break;
 
 
-/* Line 1267 of yacc.c.  */
-#line 1758 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.c"
+#line 1523 "Parser.c"
+
       default: break;
     }
-  YY_SYMBOL_PRINT ("-> $$ =", yyr1[yyn], &yyval, &yyloc);
+  /* User semantic actions sometimes alter yychar, and that requires
+     that yytoken be updated with the new translation.  We take the
+     approach of translating immediately before every use of yytoken.
+     One alternative is translating here after every semantic action,
+     but that translation would be missed if the semantic action invokes
+     YYABORT, YYACCEPT, or YYERROR immediately after altering yychar or
+     if it invokes YYBACKUP.  In the case of YYABORT or YYACCEPT, an
+     incorrect destructor might then be invoked immediately.  In the
+     case of YYERROR or YYBACKUP, subsequent parser actions might lead
+     to an incorrect destructor call or verbose syntax error message
+     before the lookahead is translated.  */
+  YY_SYMBOL_PRINT ("-> $$ =", YY_CAST (yysymbol_kind_t, yyr1[yyn]), &yyval, &yyloc);
 
   YYPOPSTACK (yylen);
   yylen = 0;
-  YY_STACK_PRINT (yyss, yyssp);
 
   *++yyvsp = yyval;
 
-
-  /* Now `shift' the result of the reduction.  Determine what state
+  /* Now 'shift' the result of the reduction.  Determine what state
      that goes to, based on the state we popped back to and the rule
      number reduced by.  */
-
-  yyn = yyr1[yyn];
-
-  yystate = yypgoto[yyn - YYNTOKENS] + *yyssp;
-  if (0 <= yystate && yystate <= YYLAST && yycheck[yystate] == *yyssp)
-    yystate = yytable[yystate];
-  else
-    yystate = yydefgoto[yyn - YYNTOKENS];
+  {
+    const int yylhs = yyr1[yyn] - YYNTOKENS;
+    const int yyi = yypgoto[yylhs] + *yyssp;
+    yystate = (0 <= yyi && yyi <= YYLAST && yycheck[yyi] == *yyssp
+               ? yytable[yyi]
+               : yydefgoto[yylhs]);
+  }
 
   goto yynewstate;
 
 
-/*------------------------------------.
-| yyerrlab -- here on detecting error |
-`------------------------------------*/
+/*--------------------------------------.
+| yyerrlab -- here on detecting error.  |
+`--------------------------------------*/
 yyerrlab:
+  /* Make sure we have latest lookahead translation.  See comments at
+     user semantic actions for why this is necessary.  */
+  yytoken = yychar == YYEMPTY ? YYSYMBOL_YYEMPTY : YYTRANSLATE (yychar);
   /* If not already recovering from an error, report this error.  */
   if (!yyerrstatus)
     {
       ++yynerrs;
-#if ! YYERROR_VERBOSE
       yyerror (scanner, myStatement, YY_("syntax error"));
-#else
-      {
-	YYSIZE_T yysize = yysyntax_error (0, yystate, yychar);
-	if (yymsg_alloc < yysize && yymsg_alloc < YYSTACK_ALLOC_MAXIMUM)
-	  {
-	    YYSIZE_T yyalloc = 2 * yysize;
-	    if (! (yysize <= yyalloc && yyalloc <= YYSTACK_ALLOC_MAXIMUM))
-	      yyalloc = YYSTACK_ALLOC_MAXIMUM;
-	    if (yymsg != yymsgbuf)
-	      YYSTACK_FREE (yymsg);
-	    yymsg = (char *) YYSTACK_ALLOC (yyalloc);
-	    if (yymsg)
-	      yymsg_alloc = yyalloc;
-	    else
-	      {
-		yymsg = yymsgbuf;
-		yymsg_alloc = sizeof yymsgbuf;
-	      }
-	  }
-
-	if (0 < yysize && yysize <= yymsg_alloc)
-	  {
-	    (void) yysyntax_error (yymsg, yystate, yychar);
-	    yyerror (scanner, myStatement, yymsg);
-	  }
-	else
-	  {
-	    yyerror (scanner, myStatement, YY_("syntax error"));
-	    if (yysize != 0)
-	      goto yyexhaustedlab;
-	  }
-      }
-#endif
     }
 
-
-
   if (yyerrstatus == 3)
     {
-      /* If just tried and failed to reuse look-ahead token after an
-	 error, discard it.  */
+      /* If just tried and failed to reuse lookahead token after an
+         error, discard it.  */
 
       if (yychar <= YYEOF)
-	{
-	  /* Return failure if at end of input.  */
-	  if (yychar == YYEOF)
-	    YYABORT;
-	}
+        {
+          /* Return failure if at end of input.  */
+          if (yychar == YYEOF)
+            YYABORT;
+        }
       else
-	{
-	  yydestruct ("Error: discarding",
-		      yytoken, &yylval, scanner, myStatement);
-	  yychar = YYEMPTY;
-	}
+        {
+          yydestruct ("Error: discarding",
+                      yytoken, &yylval, scanner, myStatement);
+          yychar = YYEMPTY;
+        }
     }
 
-  /* Else will try to reuse look-ahead token after shifting the error
+  /* Else will try to reuse lookahead token after shifting the error
      token.  */
   goto yyerrlab1;
 
@@ -1856,14 +1597,13 @@ yyerrlab:
 | yyerrorlab -- error raised explicitly by YYERROR.  |
 `---------------------------------------------------*/
 yyerrorlab:
+  /* Pacify compilers when the user code never invokes YYERROR and the
+     label yyerrorlab therefore never appears in user code.  */
+  if (0)
+    YYERROR;
+  ++yynerrs;
 
-  /* Pacify compilers like GCC when the user code never invokes
-     YYERROR and the label yyerrorlab therefore never appears in user
-     code.  */
-  if (/*CONSTCOND*/ 0)
-     goto yyerrorlab;
-
-  /* Do not reclaim the symbols of the rule which action triggered
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYERROR.  */
   YYPOPSTACK (yylen);
   yylen = 0;
@@ -1876,42 +1616,42 @@ yyerrorlab:
 | yyerrlab1 -- common code for both syntax error and YYERROR.  |
 `-------------------------------------------------------------*/
 yyerrlab1:
-  yyerrstatus = 3;	/* Each real token shifted decrements this.  */
+  yyerrstatus = 3;      /* Each real token shifted decrements this.  */
 
+  /* Pop stack until we find a state that shifts the error token.  */
   for (;;)
     {
       yyn = yypact[yystate];
-      if (yyn != YYPACT_NINF)
-	{
-	  yyn += YYTERROR;
-	  if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYTERROR)
-	    {
-	      yyn = yytable[yyn];
-	      if (0 < yyn)
-		break;
-	    }
-	}
+      if (!yypact_value_is_default (yyn))
+        {
+          yyn += YYSYMBOL_YYerror;
+          if (0 <= yyn && yyn <= YYLAST && yycheck[yyn] == YYSYMBOL_YYerror)
+            {
+              yyn = yytable[yyn];
+              if (0 < yyn)
+                break;
+            }
+        }
 
       /* Pop the current state because it cannot handle the error token.  */
       if (yyssp == yyss)
-	YYABORT;
+        YYABORT;
 
 
       yydestruct ("Error: popping",
-		  yystos[yystate], yyvsp, scanner, myStatement);
+                  YY_ACCESSING_SYMBOL (yystate), yyvsp, scanner, myStatement);
       YYPOPSTACK (1);
       yystate = *yyssp;
       YY_STACK_PRINT (yyss, yyssp);
     }
 
-  if (yyn == YYFINAL)
-    YYACCEPT;
-
+  YY_IGNORE_MAYBE_UNINITIALIZED_BEGIN
   *++yyvsp = yylval;
+  YY_IGNORE_MAYBE_UNINITIALIZED_END
 
 
   /* Shift the error token.  */
-  YY_SYMBOL_PRINT ("Shifting", yystos[yyn], yyvsp, yylsp);
+  YY_SYMBOL_PRINT ("Shifting", YY_ACCESSING_SYMBOL (yyn), yyvsp, yylsp);
 
   yystate = yyn;
   goto yynewstate;
@@ -1922,53 +1662,56 @@ yyerrlab1:
 `-------------------------------------*/
 yyacceptlab:
   yyresult = 0;
-  goto yyreturn;
+  goto yyreturnlab;
+
 
 /*-----------------------------------.
 | yyabortlab -- YYABORT comes here.  |
 `-----------------------------------*/
 yyabortlab:
   yyresult = 1;
-  goto yyreturn;
+  goto yyreturnlab;
 
-#ifndef yyoverflow
-/*-------------------------------------------------.
-| yyexhaustedlab -- memory exhaustion comes here.  |
-`-------------------------------------------------*/
+
+/*-----------------------------------------------------------.
+| yyexhaustedlab -- YYNOMEM (memory exhaustion) comes here.  |
+`-----------------------------------------------------------*/
 yyexhaustedlab:
   yyerror (scanner, myStatement, YY_("memory exhausted"));
   yyresult = 2;
-  /* Fall through.  */
-#endif
+  goto yyreturnlab;
+
 
-yyreturn:
-  if (yychar != YYEOF && yychar != YYEMPTY)
-     yydestruct ("Cleanup: discarding lookahead",
-		 yytoken, &yylval, scanner, myStatement);
-  /* Do not reclaim the symbols of the rule which action triggered
+/*----------------------------------------------------------.
+| yyreturnlab -- parsing is finished, clean up and return.  |
+`----------------------------------------------------------*/
+yyreturnlab:
+  if (yychar != YYEMPTY)
+    {
+      /* Make sure we have latest lookahead translation.  See comments at
+         user semantic actions for why this is necessary.  */
+      yytoken = YYTRANSLATE (yychar);
+      yydestruct ("Cleanup: discarding lookahead",
+                  yytoken, &yylval, scanner, myStatement);
+    }
+  /* Do not reclaim the symbols of the rule whose action triggered
      this YYABORT or YYACCEPT.  */
   YYPOPSTACK (yylen);
   YY_STACK_PRINT (yyss, yyssp);
   while (yyssp != yyss)
     {
       yydestruct ("Cleanup: popping",
-		  yystos[*yyssp], yyvsp, scanner, myStatement);
+                  YY_ACCESSING_SYMBOL (+*yyssp), yyvsp, scanner, myStatement);
       YYPOPSTACK (1);
     }
 #ifndef yyoverflow
   if (yyss != yyssa)
     YYSTACK_FREE (yyss);
 #endif
-#if YYERROR_VERBOSE
-  if (yymsg != yymsgbuf)
-    YYSTACK_FREE (yymsg);
-#endif
-  /* Make sure YYID is used.  */
-  return YYID (yyresult);
-}
-
 
-#line 309 "/Users/kevin/Documents/Projects/530-database/A7/Main/SQL/source/Parser.y"
+  return yyresult;
+}
 
+#line 315 "Parser.y"
 
 
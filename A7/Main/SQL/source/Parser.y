@@ -104,6 +104,12 @@ CreateTable: CREATE TABLE IDENTIFIER '('
 	$$ = makeTableBPlusTree ($3, $5, $10);
 }
 
+| CREATE TABLE IDENTIFIER '(' 
+		AttList ')' AS IDENTIFIER 
+{
+	$$ = makeTableOfType ($3, $5, $8);
+}
+
 AttList : AttList ',' Att 
 {
 	$$ = appendAttList ($1, $3);
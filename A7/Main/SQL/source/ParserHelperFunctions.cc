@@ -4,6 +4,7 @@
 
 #include <iostream>
 #include <stdlib.h>
+#include <strings.h>
 #include "ExprTree.h"
 #include "../source/Parser.h"
 #include "ParserHelperFunctions.h"
@@ -222,6 +223,18 @@ struct CreateTable *makeTableBPlusTree (char *tableName, struct AttList *fromMe,
 	return returnVal;
 }
 
+struct CreateTable *makeTableOfType (char *tableName, struct AttList *fromMe, char *typeName) {
+	auto returnVal = new CreateTable (string (tableName), fromMe->atts);
+	if (strcasecmp (typeName, "pax") == 0)
+		returnVal->fileType = "heap-pax";
+	else
+		returnVal->fileType = "";
+	free (tableName);
+	free (typeName);
+	delete fromMe;
+	return returnVal;
+}
+
 // structure that stores a list of aliases from a FROM clause
 } // extern
 
@@ -9,6 +9,7 @@
 #include <iostream>
 #include <sstream>
 #include <algorithm>
+#include <cstdlib>
 #include <iterator>
 
 using namespace std;
@@ -22,9 +23,17 @@ int main(int numArgs, char **args)
 {
 
 	// make sure we have the correct arguments
-	if (numArgs != 3)
+	if (numArgs != 3 && numArgs != 4)
 	{
-		cout << "args: catalog_file directory_for_tables\n";
+		cout << "args: catalog_file directory_for_tables [lru|clock|lru2|2q]\n";
+		return 0;
+	}
+
+	// see which page replacement policy we should use
+	MyDB_ReplacementPolicyPtr myPolicy = MyDB_ReplacementPolicy ::makePolicy(numArgs == 4 ? toLower(args[3]) : "lru");
+	if (myPolicy == nullptr)
+	{
+		cout << "Unknown replacement policy " << args[3] << ".\n";
 		return 0;
 	}
 
@@ -32,7 +41,7 @@ int main(int numArgs, char **args)
 	MyDB_CatalogPtr myCatalog = make_shared<MyDB_Catalog>(args[1]);
 
 	// start up the buffer manager
-	MyDB_BufferManagerPtr myMgr = make_shared<MyDB_BufferManager>(131072, 4028, "tempFile");
+	MyDB_BufferManagerPtr myMgr = make_shared<MyDB_BufferManager>(131072, 4028, "tempFile", myPolicy);
 
 	// and create tables for everything in the database
 	static map<string, MyDB_TablePtr> allTables = MyDB_Table ::getAllTables(myCatalog);
@@ -46,9 +55,12 @@ int main(int numArgs, char **args)
 	// load 'em up
 	for (auto &a : allTables)
 	{
-		if (a.second->getFileType() == "heap")
+		if (a.second->isHeap())
 		{
 			allTableReaderWriters[a.first] = make_shared<MyDB_TableReaderWriter>(a.second, myMgr);
+
+			// the heap tables are only ever read by queries, so they are scanned straight out of the OS cache
+			myMgr->setReadOnly(a.second, true);
 		}
 		else if (a.second->getFileType() == "bplustree")
 		{
@@ -57,6 +69,11 @@ int main(int numArgs, char **args)
 		}
 	}
 
+	// start reading in the pages that were buffered when the shell was last shut down, in
+	// the background, so that the first queries do not all have to go to disk
+	string warmFile = string(args[2]) + "/buffer.warm";
+	myMgr->preload(warmFile, allTables);
+
 	// print out the intro notification
 	cout << "\n          Welcome to MyDB v0.1\n\n";
 	cout << "\"Not the worst database in the world\" (tm) \n\n";
@@ -93,7 +110,13 @@ int main(int numArgs, char **args)
 				if (tokens.size() == 1 && (toLower(tokens[0]) == "exit" || toLower(tokens[0]) == "quit"))
 				{
 					cout << "OK, goodbye.\n";
-					// before we get outta here, write everything into the catalog
+					// before we get outta here, make sure that all of the data is on disk...
+					myMgr->flushAll();
+
+					// and remember what was buffered, so that the next run can start out warm
+					myMgr->saveResidentPages(warmFile);
+
+					// and write everything into the catalog
 					for (auto &a : allTables)
 					{
 						a.second->putInCatalog(myCatalog);
@@ -101,6 +124,74 @@ int main(int numArgs, char **args)
 					return 0;
 				}
 
+				// see if someone wants to know what the buffer manager has been up to (or wants
+				// to start counting from zero, so as to see what the next query does)
+				if (tokens.size() == 3 && toLower(tokens[1]) == "buffer" && toLower(tokens[2]) == "stats")
+				{
+					if (toLower(tokens[0]) == "show")
+					{
+						cout << myMgr->stats();
+						break;
+					}
+					else if (toLower(tokens[0]) == "reset")
+					{
+						myMgr->resetStats();
+						cout << "OK, reset the buffer stats.\n";
+						break;
+					}
+				}
+
+				// see if someone wants to grow or shrink the buffer pool
+				if (tokens.size() == 4 && toLower(tokens[0]) == "set" && toLower(tokens[1]) == "buffer" && toLower(tokens[2]) == "size")
+				{
+					cout << "OK, the buffer now has " << myMgr->setNumPages(strtoul(tokens[3].c_str(), nullptr, 10)) << " pages.\n";
+					break;
+				}
+
+				// see if someone wants evicted pages to be kept in compressed form ("SET COMPRESSED CACHE n",
+				// with n in megabytes; zero turns it off)
+				if (tokens.size() == 4 && toLower(tokens[0]) == "set" && toLower(tokens[1]) == "compressed" && toLower(tokens[2]) == "cache")
+				{
+					myMgr->setCompressedCache(strtoul(tokens[3].c_str(), nullptr, 10) * 1024 * 1024);
+					cout << "OK, the compressed cache now holds up to " << tokens[3] << " MB.\n";
+					break;
+				}
+
+				// see if someone wants to give a sub-pool a quota ("SET BUFFER POOL name SIZE n"), or to
+				// move a table (or the temp pages) into one ("SET BUFFER POOL name FOR table")
+				if (tokens.size() == 6 && toLower(tokens[0]) == "set" && toLower(tokens[1]) == "buffer" && toLower(tokens[2]) == "pool")
+				{
+					if (toLower(tokens[4]) == "size")
+					{
+						myMgr->setSubPool(tokens[3], strtoul(tokens[5].c_str(), nullptr, 10));
+						cout << "OK, sub-pool " << tokens[3] << " has a quota of " << tokens[5] << " pages.\n";
+						break;
+					}
+					else if (toLower(tokens[4]) == "for" && toLower(tokens[5]) == "temp")
+					{
+						if (myMgr->useSubPool(nullptr, tokens[3]))
+							cout << "OK, temp pages now go in sub-pool " << tokens[3] << ".\n";
+						break;
+					}
+					else if (toLower(tokens[4]) == "for")
+					{
+						if (allTables.count(tokens[5]) == 0)
+							cout << "Could not find table " << tokens[5] << ".\n";
+						else if (myMgr->useSubPool(allTables[tokens[5]], tokens[3]))
+							cout << "OK, table " << tokens[5] << " is now in sub-pool " << tokens[3] << ".\n";
+						break;
+					}
+				}
+
+				// see if someone wants temp pages to be spread over several directories
+				// ("SET SPILL DIRECTORIES dir1 dir2 ...", or with no directories to go back to one file)
+				if (tokens.size() >= 3 && toLower(tokens[0]) == "set" && toLower(tokens[1]) == "spill" && toLower(tokens[2]) == "directories")
+				{
+					myMgr->setSpillDirectories(vector<string>(tokens.begin() + 3, tokens.end()));
+					cout << "OK, temp pages now go into " << (tokens.size() == 3 ? 1 : tokens.size() - 3) << " file(s).\n";
+					break;
+				}
+
 				if (tokens.size() == 1 && toLower(tokens[0]) == "init")
 				{
 					cout << "OK, initializing all tables.\n";
@@ -118,11 +209,17 @@ int main(int numArgs, char **args)
 
 							// load up the file
 							auto fileName = "./tables/" + string(name) + ".tbl";
+							myMgr->setReadOnly(allTableReaderWriters[name]->getTable(), false);
 							pair<vector<size_t>, size_t> res = allTableReaderWriters[name]->loadFromTextFile(fileName);
 
 							// and record the tuple various counts
 							allTableReaderWriters[name]->getTable()->setDistinctValues(res.first);
 							allTableReaderWriters[name]->getTable()->setTupleCount(res.second);
+
+							// write the loaded pages out in big, sequential writes
+							myMgr->flushTable(allTableReaderWriters[name]->getTable());
+							if (allTableReaderWriters[name]->getTable()->isHeap())
+								myMgr->setReadOnly(allTableReaderWriters[name]->getTable(), true);
 						}
 					}
 					break;
@@ -143,11 +240,17 @@ int main(int numArgs, char **args)
 						cout << "OK, loading " << tokens[1] << " from text file.\n";
 
 						// load up the file
+						myMgr->setReadOnly(allTableReaderWriters[tokens[1]]->getTable(), false);
 						pair<vector<size_t>, size_t> res = allTableReaderWriters[tokens[1]]->loadFromTextFile(tokens[3]);
 
 						// and record the tuple various counts
 						allTableReaderWriters[tokens[1]]->getTable()->setDistinctValues(res.first);
 						allTableReaderWriters[tokens[1]]->getTable()->setTupleCount(res.second);
+
+						// write the loaded pages out in big, sequential writes
+						myMgr->flushTable(allTableReaderWriters[tokens[1]]->getTable());
+						if (allTableReaderWriters[tokens[1]]->getTable()->isHeap())
+							myMgr->setReadOnly(allTableReaderWriters[tokens[1]]->getTable(), true);
 						break;
 					}
 				}
@@ -197,7 +300,7 @@ int main(int numArgs, char **args)
 						if (tableName != "nothing")
 						{
 							allTables[tableName] = temp;
-							if (allTables[tableName]->getFileType() == "heap")
+							if (allTables[tableName]->isHeap())
 							{
 								allTableReaderWriters[tableName] = make_shared<MyDB_TableReaderWriter>(allTables[tableName], myMgr);
 							}
@@ -213,6 +316,10 @@ int main(int numArgs, char **args)
 					else if (final->isSFWQuery())
 					{
 
+						// all of the query's temp pages go into a file of their own, which is deleted
+						// once the query is done with them
+						MyDB_TempSegmentPtr segment = myMgr->startTempSegment();
+
 						LogicalOpPtr myPlan = final->buildLogicalQueryPlan(allTables, allTableReaderWriters);
 						if (myPlan != nullptr)
 						{